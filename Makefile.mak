@@ -43,6 +43,7 @@ endif
 
 # ==================== COMPILER ====================
 CC 		?= gcc
+CXX 	?= g++
 AR 		?= ar
 CFLAGS 	:= -std=c90 -Wall -Wextra -pedantic
 ARFLAGS := rcs
@@ -60,6 +61,10 @@ VECTOR_USE_INLINE			?= OFF
 VECTOR_OPTIMIZE_SIZE		?= OFF
 VECTOR_SMALL_MEMORY 		?= OFF
 VECTOR_USE_CUSTOM_ALLOCATOR	?= OFF
+VECTOR_TRACE 				?= OFF
+VECTOR_HASH_INDEX 			?= OFF
+VECTOR_COW 					?= OFF
+VECTOR_OPENMP 				?= OFF
 VECTOR_RUN_GENERATOR 		?= ON
 
 # ==================== DIRECTORIES ====================
@@ -71,6 +76,7 @@ SCRIPT_DIR 	:= script
 DOC_DIR 	:= doc
 LOG_DIR 	:= log
 BUILD_DIR 	:= build
+BENCH_DIR 	:= bench
 
 # ==================== INSTALLATION PATHS ====================
 ifeq ($(HOST_OS),Windows)
@@ -128,29 +134,53 @@ GENERATED_FILES := \
 	$(GEN_DIR)/vector_aliases.h \
 	$(GEN_DIR)/vector_decl.h \
 	$(GEN_DIR)/vector_impl.c \
+	$(GEN_DIR)/vector_inline.h \
 	$(DOC_DIR)/vector_types.txt \
 	$(LOG_DIR)/vector_gen.txt
 
 # ==================== SOURCE FILES ====================
 LIB_SOURCES := \
 	$(SRC_DIR)/vector.c \
+	$(SRC_DIR)/vector_trace.c \
 	$(PRIV_DIR)/vector_template.c \
 	$(GEN_DIR)/vector_impl.c
 
 PUBLIC_HEADERS := \
 	$(SRC_DIR)/vector.h \
+	$(SRC_DIR)/vector_allocator.h \
+	$(SRC_DIR)/vector_config.h \
 	$(SRC_DIR)/vector_error.h \
 	$(SRC_DIR)/vector_range.h \
-	$(SRC_DIR)/vector_size.h
+	$(SRC_DIR)/vector_size.h \
+	$(SRC_DIR)/vector_trace.h
 
 GEN_HEADERS := \
 	$(GEN_DIR)/vector_aliases.h \
-	$(GEN_DIR)/vector_decl.h
+	$(GEN_DIR)/vector_decl.h \
+	$(GEN_DIR)/vector_inline.h
 
 PRIV_HEADERS := \
+	$(PRIV_DIR)/bit_vector_template.h \
+	$(PRIV_DIR)/dynamic_vector_template.h \
+	$(PRIV_DIR)/segmented_vector_template.h \
+	$(PRIV_DIR)/soa_vector_template.h \
+	$(PRIV_DIR)/static_vector_template.h \
 	$(PRIV_DIR)/template.h \
+	$(PRIV_DIR)/vector_algorithm_template.h \
+	$(PRIV_DIR)/vector_atomic.h \
+	$(PRIV_DIR)/vector_index_template.h \
 	$(PRIV_DIR)/vector_initialize_type.h \
-	$(PRIV_DIR)/vector_template.h
+	$(PRIV_DIR)/vector_simd.h \
+	$(PRIV_DIR)/vector_template.h \
+	$(PRIV_DIR)/vector_traits.h \
+	$(PRIV_DIR)/bit_vector_template.c \
+	$(PRIV_DIR)/dynamic_vector_template.c \
+	$(PRIV_DIR)/segmented_vector_template.c \
+	$(PRIV_DIR)/soa_vector_template.c \
+	$(PRIV_DIR)/static_vector_template.c \
+	$(PRIV_DIR)/vector_algorithm_template.c \
+	$(PRIV_DIR)/vector_index_template.c \
+	$(PRIV_DIR)/vector_template.c
 
 ALL_HEADERS := $(PUBLIC_HEADERS) $(GEN_HEADERS) $(PRIV_HEADERS)
 
@@ -181,6 +211,23 @@ ifneq ($(VECTOR_SMALL_MEMORY),OFF)
     CFLAGS += -DVECTOR_SMALL_MEMORY
 endif
 
+ifneq ($(VECTOR_TRACE),OFF)
+    CFLAGS += -DVECTOR_TRACE
+endif
+
+ifneq ($(VECTOR_HASH_INDEX),OFF)
+    CFLAGS += -DVECTOR_HASH_INDEX
+endif
+
+ifneq ($(VECTOR_COW),OFF)
+    CFLAGS += -DVECTOR_COW
+endif
+
+# Programs linking the library need -fopenmp as well
+ifneq ($(VECTOR_OPENMP),OFF)
+    CFLAGS += -DVECTOR_OPENMP -fopenmp
+endif
+
 INCLUDES := -I$(SRC_DIR) -I$(GEN_DIR) -I$(PRIV_DIR)
 
 ifeq ($(HOST_OS),Windows)
@@ -192,7 +239,7 @@ endif
 COMPILE_FLAGS := $(CFLAGS) $(INCLUDES)
 
 # ==================== PHONY TARGETS ====================
-.PHONY: all clean clean_build clean_gen generate run_generator install uninstall test help info
+.PHONY: all clean clean_build clean_gen generate run_generator install uninstall test help info vector_bench vector_replay vector_bench_compare
 
 # ==================== MAIN TARGET ====================
 all: generate $(BUILD_DIR)/lib$(PROJECT_NAMESPACE).a
@@ -287,6 +334,83 @@ else
 	@$(CC) $(INCLUDES) -MM -MT $(@:.d=.o) $< > $@
 endif
 
+# ==================== BENCHMARKS ====================
+BENCH_BUILD_DIR 	:= $(BUILD_DIR)/bench
+BENCH_RESULTS 		?= $(BUILD_DIR)/bench_results.csv
+BENCH_BASELINE 		?=
+BENCH_THRESHOLD 	?= 10
+BENCH_CFLAGS 		:= -std=gnu99 -O2 -Wall -Wextra $(INCLUDES) -I$(BENCH_DIR)
+BENCH_CXXFLAGS 		:= -O2 -Wall -Wextra -I$(BENCH_DIR)
+
+BENCH_CONFIGS 		:= default lite size8 size16 packed check static
+
+BENCH_FLAGS_default :=
+BENCH_FLAGS_lite 	:= -DVECTOR_LITE
+BENCH_FLAGS_size8 	:= -DVECTOR_8BIT_SIZE
+BENCH_FLAGS_size16 	:= -DVECTOR_16BIT_SIZE
+BENCH_FLAGS_packed 	:= -DVECTOR_USE_PACKED_STRUCT
+BENCH_FLAGS_check 	:= -DVECTOR_CHECK_ON
+BENCH_FLAGS_static 	:= -DVECTOR_NO_DYNAMIC_ALLOC -DVECTOR_MAX_N_VECTORS=4 -DVECTOR_STATIC_BUFFER_SIZE=16384
+
+# Inline hooks versus callbacks, dynamic configurations only
+HOOKS_CONFIGS 		:= default lite
+
+BENCH_BINARIES 		:= $(foreach cfg,$(BENCH_CONFIGS),$(BENCH_BUILD_DIR)/vector_bench_$(cfg)) \
+	$(foreach cfg,$(HOOKS_CONFIGS),$(BENCH_BUILD_DIR)/vector_bench_hooks_$(cfg)) \
+	$(BENCH_BUILD_DIR)/vector_bench_std
+
+# Trace replay, dynamic configurations only: static pools have no heap to measure (make vector_replay TRACE=<file>)
+REPLAY_CONFIGS 		:= default lite size16 packed check
+REPLAY_BINARIES 	:= $(foreach cfg,$(REPLAY_CONFIGS),$(BENCH_BUILD_DIR)/vector_replay_$(cfg))
+REPLAY_RESULTS 		?= $(BUILD_DIR)/replay_results.csv
+TRACE 				?=
+
+define BENCH_RULE
+$(BENCH_BUILD_DIR)/vector_bench_$(1): $(SRC_DIR)/vector.c $(BENCH_DIR)/vector_bench.c $(BENCH_DIR)/vector_bench.h | generate
+	@$(MKDIR) "$(BENCH_BUILD_DIR)"
+	@echo "Compiling benchmark: $(1)"
+	$(CC) $(BENCH_CFLAGS) $(BENCH_FLAGS_$(1)) -DVECTOR_BENCH_CONFIG=\"$(1)\" $(SRC_DIR)/vector.c $(BENCH_DIR)/vector_bench.c -o $$@
+endef
+
+$(foreach cfg,$(BENCH_CONFIGS),$(eval $(call BENCH_RULE,$(cfg))))
+
+define REPLAY_RULE
+$(BENCH_BUILD_DIR)/vector_replay_$(1): $(BENCH_DIR)/vector_replay.c $(BENCH_DIR)/vector_replay_template.c $(BENCH_DIR)/vector_bench.h $(SRC_DIR)/vector_trace.h | generate
+	@$(MKDIR) "$(BENCH_BUILD_DIR)"
+	@echo "Compiling replay: $(1)"
+	$(CC) $(BENCH_CFLAGS) $(BENCH_FLAGS_$(1)) -DVECTOR_BENCH_CONFIG=\"$(1)\" $(BENCH_DIR)/vector_replay.c -o $$@
+endef
+
+$(foreach cfg,$(REPLAY_CONFIGS),$(eval $(call REPLAY_RULE,$(cfg))))
+
+define HOOKS_RULE
+$(BENCH_BUILD_DIR)/vector_bench_hooks_$(1): $(BENCH_DIR)/vector_bench_hooks.c $(BENCH_DIR)/vector_bench.h $(PRIV_HEADERS)
+	@$(MKDIR) "$(BENCH_BUILD_DIR)"
+	@echo "Compiling hooks benchmark: $(1)"
+	$(CC) $(BENCH_CFLAGS) $(BENCH_FLAGS_$(1)) -DVECTOR_BENCH_CONFIG=\"$(1)\" $(BENCH_DIR)/vector_bench_hooks.c -o $$@
+endef
+
+$(foreach cfg,$(HOOKS_CONFIGS),$(eval $(call HOOKS_RULE,$(cfg))))
+
+$(BENCH_BUILD_DIR)/vector_bench_std: $(BENCH_DIR)/vector_bench_std.cpp $(BENCH_DIR)/vector_bench.h
+	@$(MKDIR) "$(BENCH_BUILD_DIR)"
+	@echo "Compiling benchmark: std"
+	$(CXX) $(BENCH_CXXFLAGS) $(BENCH_DIR)/vector_bench_std.cpp -o $@
+
+vector_bench: $(BENCH_BINARIES)
+	@echo "========================================"
+	@echo "Running benchmarks, results in $(BENCH_RESULTS)"
+	@echo "========================================"
+	$(RM) "$(BENCH_RESULTS)"
+	$(foreach bin,$(BENCH_BINARIES),$(bin) -o "$(BENCH_RESULTS)" &&) true
+
+vector_replay: $(REPLAY_BINARIES)
+	@echo "Replaying $(TRACE), results in $(REPLAY_RESULTS)"
+	$(foreach bin,$(REPLAY_BINARIES),$(bin) "$(TRACE)" -o "$(REPLAY_RESULTS)" &&) true
+
+vector_bench_compare:
+	$(PYTHON) $(SCRIPT_DIR)/vector_bench_compare.py "$(BENCH_BASELINE)" "$(BENCH_RESULTS)" --threshold $(BENCH_THRESHOLD)
+
 # ==================== INSTALLATION ====================
 prefix       ?= $(INSTALL_DIR)
 exec_prefix  ?= $(prefix)
@@ -384,6 +508,10 @@ info:
 	@echo "		VECTOR_LITE:           $(VECTOR_LITE)"
 	@echo "		VECTOR_OPTIMIZE_SIZE:  $(VECTOR_OPTIMIZE_SIZE)"
 	@echo "		VECTOR_SMALL_MEMORY:   $(VECTOR_SMALL_MEMORY)"
+	@echo "		VECTOR_TRACE:          $(VECTOR_TRACE)"
+	@echo "		VECTOR_HASH_INDEX:     $(VECTOR_HASH_INDEX)"
+	@echo "		VECTOR_COW:            $(VECTOR_COW)"
+	@echo "		VECTOR_OPENMP:         $(VECTOR_OPENMP)"
 	@echo "		VECTOR_RUN_GENERATOR:  $(VECTOR_RUN_GENERATOR)"
 	@echo "		VECTOR_BUILD_TESTS:    $(VECTOR_BUILD_TESTS)"
 	@echo "========================================"
@@ -403,6 +531,9 @@ help:
 	@echo "		clean_gen	- Remove generated files"
 	@echo "		clean		- Remove all generated and built files"
 	@echo "		info		- Show configuration"
+	@echo "		vector_bench	- Build and run benchmarks for every configuration"
+	@echo "		vector_replay	- Replay TRACE=<file> on every dynamic configuration"
+	@echo "		vector_bench_compare - Compare BENCH_RESULTS against BENCH_BASELINE"
 	@echo "		help		- Show this help"
 	@echo ""
 	@echo "Options (set with VAR=value):"
@@ -410,6 +541,10 @@ help:
 	@echo "		VECTOR_LITE=ON				- Build lite version"
 	@echo "		VECTOR_OPTIMIZE_SIZE=ON		- Optimize for size"
 	@echo "		VECTOR_SMALL_MEMORY=ON		- Optimize for small memory"
+	@echo "		VECTOR_TRACE=ON				- Record operations with vector_trace_open()"
+	@echo "		VECTOR_HASH_INDEX=ON		- Optional hash index for finds"
+	@echo "		VECTOR_COW=ON				- Copy-on-write copy_create_vector"
+	@echo "		VECTOR_OPENMP=ON			- Parallel numeric kernels (OpenMP)"
 	@echo "		VECTOR_RUN_GENERATOR=OFF	- Disable automatic generation"
 	@echo "		VECTOR_BUILD_TESTS=ON		- Enable tests"
 	@echo "		prefix=/path				- Installation prefix"
@@ -0,0 +1,397 @@
+/**
+ * @file      vector_bench.c
+ * @brief     Micro-benchmarks for vector operations
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Measures the cost of the core vector operations for vector_int_t
+ *            across several sizes. The same source is compiled once per
+ *            build configuration (VECTOR_LITE, VECTOR_8BIT_SIZE, ...), the
+ *            configuration name is passed in VECTOR_BENCH_CONFIG.
+ *            A raw array baseline is measured in every configuration.
+ *
+ *            Output is CSV (one row per measurement), appended to the file
+ *            given with -o or written to stdout:
+ *            config,benchmark,impl,size,iterations,ns_per_op
+ *
+ * @see       vector_bench_std.cpp
+ * @see       script/vector_bench_compare.py
+ */
+
+#include "vector.h"
+#include "vector_bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#ifndef VECTOR_BENCH_CONFIG
+#define VECTOR_BENCH_CONFIG		"default"
+#endif // VECTOR_BENCH_CONFIG
+
+
+static const size_t bench_sizes[] = { 16, 128, 1024, 16384, 262144 };
+
+static volatile int bench_sink;
+
+
+static void bench_fill(vector_int_t *vec, size_t size)
+{
+	vector_error_t error;
+
+	for (size_t i = 0; i < size; ++i)
+		BENCH_CALL(vec, emplace_indx, (vector_index_t)i, (int)i, &error);
+}
+
+static vector_int_t *bench_make(size_t size)
+{
+	vector_error_t error = VECTOR_ERROR_SUCCESS;
+	vector_int_t *vec = BENCH_CREATE(size, &error);
+
+	if (vec == NULL)
+	{
+		fprintf(stderr, "[bench] create_vector(%zu) failed: %d\n", size, (int)error);
+		exit(EXIT_FAILURE);
+	}
+
+	bench_fill(vec, size);
+
+	return vec;
+}
+
+static void bench_push_back(FILE *out, size_t size)
+{
+	const size_t reps = bench_reps(size, false);
+	vector_error_t error;
+
+	const uint64_t start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		vector_int_t *vec = BENCH_CREATE(0, &error);
+
+		for (size_t i = 0; i < size; ++i)
+			BENCH_CALL(vec, push_back, (int)i, &error);
+
+		bench_sink += (int)BENCH_CCALL0(vec, size);
+		BENCH_DESTROY(vec);
+	}
+	const uint64_t elapsed = bench_now_ns() - start;
+
+	bench_report(out, VECTOR_BENCH_CONFIG, "push_back", "vector", size, reps, elapsed, reps * size);
+
+	const uint64_t unchecked_start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		vector_int_t *vec = BENCH_CREATE(0, &error);
+
+		for (size_t i = 0; i < size; ++i)
+			vector_push_back_unchecked_int_t(BENCH_SELF(vec), (int)i);
+
+		bench_sink += (int)BENCH_CCALL0(vec, size);
+		BENCH_DESTROY(vec);
+	}
+	const uint64_t unchecked_elapsed = bench_now_ns() - unchecked_start;
+
+	bench_report(out, VECTOR_BENCH_CONFIG, "push_back", "unchecked", size, reps, unchecked_elapsed, reps * size);
+
+	int *raw = (int *)malloc(size * sizeof(int));
+	const uint64_t raw_start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		for (size_t i = 0; i < size; ++i)
+			raw[i] = (int)i;
+
+		bench_sink += raw[size - 1];
+	}
+	const uint64_t raw_elapsed = bench_now_ns() - raw_start;
+	free(raw);
+
+	bench_report(out, VECTOR_BENCH_CONFIG, "push_back", "raw", size, reps, raw_elapsed, reps * size);
+}
+
+#ifndef VECTOR_NO_DYNAMIC_ALLOC
+static void bench_insert_indx(FILE *out, size_t size)
+{
+	const size_t reps = bench_reps(size, true);
+	vector_error_t error;
+
+	const uint64_t start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		vector_int_t *vec = BENCH_CREATE(0, &error);
+		BENCH_CALL(vec, reserve, (vector_index_t)size, &error);
+
+		for (size_t i = 0; i < size; ++i)
+			BENCH_CALL(vec, insert_indx, 0, (int)i, &error);
+
+		bench_sink += (int)BENCH_CCALL0(vec, size);
+		BENCH_DESTROY(vec);
+	}
+	const uint64_t elapsed = bench_now_ns() - start;
+
+	bench_report(out, VECTOR_BENCH_CONFIG, "insert_indx", "vector", size, reps, elapsed, reps * size);
+
+	int *raw = (int *)malloc(size * sizeof(int));
+	const uint64_t raw_start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		for (size_t i = 0; i < size; ++i)
+		{
+			memmove(raw + 1, raw, i * sizeof(int));
+			raw[0] = (int)i;
+		}
+
+		bench_sink += raw[0];
+	}
+	const uint64_t raw_elapsed = bench_now_ns() - raw_start;
+	free(raw);
+
+	bench_report(out, VECTOR_BENCH_CONFIG, "insert_indx", "raw", size, reps, raw_elapsed, reps * size);
+}
+
+static void bench_erase_indx(FILE *out, size_t size)
+{
+	const size_t reps = bench_reps(size, true);
+	vector_error_t error;
+	uint64_t elapsed = 0;
+
+	for (size_t r = 0; r < reps; ++r)
+	{
+		vector_int_t *vec = bench_make(size);
+
+		const uint64_t start = bench_now_ns();
+		for (size_t i = 0; i < size; ++i)
+			BENCH_CALL(vec, erase_indx, 0, &error);
+		elapsed += bench_now_ns() - start;
+
+		bench_sink += (int)BENCH_CCALL0(vec, size);
+		BENCH_DESTROY(vec);
+	}
+
+	bench_report(out, VECTOR_BENCH_CONFIG, "erase_indx", "vector", size, reps, elapsed, reps * size);
+
+	int *raw = (int *)malloc(size * sizeof(int));
+	uint64_t raw_elapsed = 0;
+	for (size_t r = 0; r < reps; ++r)
+	{
+		for (size_t i = 0; i < size; ++i)
+			raw[i] = (int)i;
+
+		const uint64_t start = bench_now_ns();
+		for (size_t i = size; i > 0; --i)
+			memmove(raw, raw + 1, (i - 1) * sizeof(int));
+		raw_elapsed += bench_now_ns() - start;
+
+		bench_sink += raw[0];
+	}
+	free(raw);
+
+	bench_report(out, VECTOR_BENCH_CONFIG, "erase_indx", "raw", size, reps, raw_elapsed, reps * size);
+}
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+
+static void bench_find(FILE *out, size_t size)
+{
+	const size_t reps = bench_reps(size, false);
+	vector_int_t *vec = bench_make(size);
+	uint64_t start;
+
+	/* Worst case for every search: the whole range is scanned. */
+	start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+		bench_sink += (int)BENCH_CCALL(vec, find_first_of, -1);
+	bench_report(out, VECTOR_BENCH_CONFIG, "find_first_of", "vector", size, reps, bench_now_ns() - start, reps * size);
+
+	start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+		bench_sink += (int)BENCH_CCALL(vec, find_last_of, -1);
+	bench_report(out, VECTOR_BENCH_CONFIG, "find_last_of", "vector", size, reps, bench_now_ns() - start, reps * size);
+
+	BENCH_CALL(vec, emplace_indx, (vector_index_t)(size - 1), 1, NULL);
+	{
+		vector_error_t error;
+
+		for (size_t i = 0; i + 1 < size; ++i)
+			BENCH_CALL(vec, emplace_indx, (vector_index_t)i, 0, &error);
+	}
+
+	start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+		bench_sink += (int)BENCH_CCALL(vec, find_first_not_of, 0);
+	bench_report(out, VECTOR_BENCH_CONFIG, "find_first_not_of", "vector", size, reps, bench_now_ns() - start, reps * size);
+
+	BENCH_DESTROY(vec);
+
+	int *raw = (int *)malloc(size * sizeof(int));
+	for (size_t i = 0; i < size; ++i)
+		raw[i] = (int)i;
+
+	start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		ssize_t found = -1;
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			if (raw[i] == -1)
+			{
+				found = (ssize_t)i;
+				break;
+			}
+		}
+
+		bench_sink += (int)found;
+	}
+	bench_report(out, VECTOR_BENCH_CONFIG, "find_first_of", "raw", size, reps, bench_now_ns() - start, reps * size);
+
+	free(raw);
+}
+
+static void bench_copy_create(FILE *out, size_t size)
+{
+	const size_t reps = bench_reps(size, false);
+	vector_int_t *vec = bench_make(size);
+	vector_error_t error;
+
+	const uint64_t start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		vector_int_t *copy = vector_copy_create_vector_int_t(vec, &error);
+
+		bench_sink += (int)BENCH_CCALL0(copy, front);
+		BENCH_DESTROY(copy);
+	}
+	const uint64_t elapsed = bench_now_ns() - start;
+
+	BENCH_DESTROY(vec);
+
+	bench_report(out, VECTOR_BENCH_CONFIG, "copy_create_vector", "vector", size, reps, elapsed, reps * size);
+
+	int *raw = (int *)malloc(size * sizeof(int));
+	for (size_t i = 0; i < size; ++i)
+		raw[i] = (int)i;
+
+	const uint64_t raw_start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		int *copy = (int *)malloc(size * sizeof(int));
+
+		memcpy(copy, raw, size * sizeof(int));
+		bench_sink += copy[0];
+		free(copy);
+	}
+	const uint64_t raw_elapsed = bench_now_ns() - raw_start;
+	free(raw);
+
+	bench_report(out, VECTOR_BENCH_CONFIG, "copy_create_vector", "raw", size, reps, raw_elapsed, reps * size);
+}
+
+static void bench_reverse(FILE *out, size_t size)
+{
+	const size_t reps = bench_reps(size, false);
+	vector_int_t *vec = bench_make(size);
+	vector_error_t error;
+	uint64_t start;
+
+	start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+		BENCH_CALL(vec, reverse_indx, 0, (vector_index_t)size, &error);
+	bench_report(out, VECTOR_BENCH_CONFIG, "reverse_indx", "vector", size, reps, bench_now_ns() - start, reps * size);
+
+	/* end() is not a valid argument for indx(), so the last element stays put. */
+	const vector_iterator_int_t itb = BENCH_CCALL0(vec, begin);
+	const vector_iterator_int_t ite = BENCH_CCALL(vec, it, (vector_index_t)(size - 1), &error);
+
+	start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+		BENCH_CALL(vec, reverse_it, itb, ite, &error);
+	bench_report(out, VECTOR_BENCH_CONFIG, "reverse_it", "vector", size, reps, bench_now_ns() - start, reps * size);
+
+	bench_sink += (int)BENCH_CCALL0(vec, front);
+	BENCH_DESTROY(vec);
+
+	int *raw = (int *)malloc(size * sizeof(int));
+	for (size_t i = 0; i < size; ++i)
+		raw[i] = (int)i;
+
+	start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		for (size_t i = 0, j = size - 1; i < j; ++i, --j)
+		{
+			const int temp = raw[i];
+			raw[i] = raw[j];
+			raw[j] = temp;
+		}
+	}
+	bench_report(out, VECTOR_BENCH_CONFIG, "reverse_indx", "raw", size, reps, bench_now_ns() - start, reps * size);
+
+	bench_sink += raw[0];
+	free(raw);
+}
+
+static void bench_create_destroy(FILE *out, size_t size)
+{
+	const size_t reps = bench_reps(size, false);
+	vector_error_t error;
+
+	const uint64_t start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		vector_int_t *vec = BENCH_CREATE(size, &error);
+
+		bench_sink += (vec != NULL);
+		BENCH_DESTROY(vec);
+	}
+	const uint64_t elapsed = bench_now_ns() - start;
+
+	bench_report(out, VECTOR_BENCH_CONFIG, "create_destroy", "vector", size, reps, elapsed, reps);
+
+	const uint64_t raw_start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		int *raw = (int *)calloc(size, sizeof(int));
+
+		bench_sink += (raw != NULL);
+		free(raw);
+	}
+	const uint64_t raw_elapsed = bench_now_ns() - raw_start;
+
+	bench_report(out, VECTOR_BENCH_CONFIG, "create_destroy", "raw", size, reps, raw_elapsed, reps);
+}
+
+
+int main(int argc, char **argv)
+{
+	FILE *out = bench_open_output(argc, argv);
+
+	if (out == NULL)
+		return EXIT_FAILURE;
+
+	for (size_t s = 0; s < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++s)
+	{
+		const size_t size = bench_sizes[s];
+
+		if (size > VECTOR_BENCH_MAX_SIZE)
+			break;
+
+		bench_push_back(out, size);
+#ifndef VECTOR_NO_DYNAMIC_ALLOC
+		if (size <= VECTOR_BENCH_MAX_QUADRATIC_SIZE)
+		{
+			bench_insert_indx(out, size);
+			bench_erase_indx(out, size);
+		}
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+		bench_find(out, size);
+		bench_copy_create(out, size);
+		bench_reverse(out, size);
+		bench_create_destroy(out, size);
+	}
+
+	bench_close_output(out);
+
+	return EXIT_SUCCESS;
+}
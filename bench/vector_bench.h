@@ -0,0 +1,199 @@
+/**
+ * @file      vector_bench.h
+ * @brief     Timing and reporting helpers shared by the benchmarks
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Monotonic clock, repetition count selection and the CSV
+ *            writer used by every benchmark executable. The header is
+ *            usable from both C and C++ sources.
+ */
+
+#ifndef __VECTOR_BENCH_H__
+#define __VECTOR_BENCH_H__
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+
+#ifndef VECTOR_BENCH_TARGET_OPS
+#define VECTOR_BENCH_TARGET_OPS		(1u << 22)
+#endif // VECTOR_BENCH_TARGET_OPS
+
+#ifndef VECTOR_BENCH_MAX_QUADRATIC_SIZE
+#define VECTOR_BENCH_MAX_QUADRATIC_SIZE	16384
+#endif // VECTOR_BENCH_MAX_QUADRATIC_SIZE
+
+#ifndef VECTOR_BENCH_MAX_SIZE
+#if defined(VECTOR_NO_DYNAMIC_ALLOC)
+#define VECTOR_BENCH_MAX_SIZE		((size_t)VECTOR_STATIC_BUFFER_SIZE)
+#elif defined(VECTOR_SIZE_MAX)
+#define VECTOR_BENCH_MAX_SIZE		((size_t)VECTOR_SIZE_MAX)
+#else
+#define VECTOR_BENCH_MAX_SIZE		((size_t)-1)
+#endif
+#endif // VECTOR_BENCH_MAX_SIZE
+
+#define VECTOR_BENCH_CSV_HEADER \
+	"config,benchmark,impl,size,iterations,ns_per_op\n"
+
+/*
+ * Calls on vector_int_t that compile in every configuration:
+ * free functions with VECTOR_LITE, function pointers otherwise,
+ * VECTOR ** in the dynamic mode and VECTOR * in the static one.
+ */
+#ifdef VECTOR_NO_DYNAMIC_ALLOC
+#define BENCH_SELF(_vec)		(_vec)
+#define BENCH_CSELF(_vec)		((const vector_int_t *)(_vec))
+#else // VECTOR_NO_DYNAMIC_ALLOC
+#define BENCH_SELF(_vec)		(&(_vec))
+#define BENCH_CSELF(_vec)		((const vector_int_t **)&(_vec))
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+
+#ifdef VECTOR_LITE
+#define BENCH_CALL(_vec, _name, ...) \
+	TEMPLATE(vector, TEMPLATE(_name, int_t))(BENCH_SELF(_vec), __VA_ARGS__)
+#define BENCH_CCALL(_vec, _name, ...) \
+	TEMPLATE(vector, TEMPLATE(_name, int_t))(BENCH_CSELF(_vec), __VA_ARGS__)
+#define BENCH_CALL0(_vec, _name) \
+	TEMPLATE(vector, TEMPLATE(_name, int_t))(BENCH_SELF(_vec))
+#define BENCH_CCALL0(_vec, _name) \
+	TEMPLATE(vector, TEMPLATE(_name, int_t))(BENCH_CSELF(_vec))
+#else // VECTOR_LITE
+#define BENCH_CALL(_vec, _name, ...) \
+	(_vec)->_name(BENCH_SELF(_vec), __VA_ARGS__)
+#define BENCH_CCALL(_vec, _name, ...) \
+	(_vec)->_name(BENCH_CSELF(_vec), __VA_ARGS__)
+#define BENCH_CALL0(_vec, _name) \
+	(_vec)->_name(BENCH_SELF(_vec))
+#define BENCH_CCALL0(_vec, _name) \
+	(_vec)->_name(BENCH_CSELF(_vec))
+#endif // VECTOR_LITE
+
+#define BENCH_CREATE(_size, _err) \
+	vector_create_vector_int_t((vector_size_t)(_size), 0, (_err))
+
+#ifdef VECTOR_NO_DYNAMIC_ALLOC
+#define BENCH_DESTROY(_vec) \
+	vector_destroy_vector_int_t((_vec))
+#else // VECTOR_NO_DYNAMIC_ALLOC
+#define BENCH_DESTROY(_vec) \
+	vector_destroy_vector_int_t(&(_vec))
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+
+
+/**
+ * @brief  Monotonic time in nanoseconds
+ */
+static inline uint64_t bench_now_ns(void)
+{
+#if defined(_WIN32) || defined(_WIN64)
+	LARGE_INTEGER freq, count;
+
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&count);
+
+	return (uint64_t)((double)count.QuadPart * 1e9 / (double)freq.QuadPart);
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/**
+ * @brief  Number of repetitions for a workload of @p size operations
+ *
+ * @param  size       Elements touched by one repetition
+ * @param  quadratic  One repetition costs O(size^2) (front insert/erase)
+ */
+static inline size_t bench_reps(size_t size, bool quadratic)
+{
+	const size_t work = quadratic ? size * size : size;
+	const size_t reps = VECTOR_BENCH_TARGET_OPS / (work > 0 ? work : 1);
+
+	return reps > 3 ? reps : 3;
+}
+
+/**
+ * @brief  Open the CSV output selected with "-o <file>" (stdout otherwise)
+ *
+ * @note   The file is opened in append mode so several configurations can
+ *         write into one result file; the header is written only once.
+ */
+static inline FILE *bench_open_output(int argc, char **argv)
+{
+	FILE *out = stdout;
+
+	for (int i = 1; i + 1 < argc; ++i)
+	{
+		if (strcmp(argv[i], "-o") == 0)
+		{
+			out = fopen(argv[i + 1], "a");
+			if (out == NULL)
+			{
+				fprintf(stderr, "[bench] cannot open %s\n", argv[i + 1]);
+				return NULL;
+			}
+		}
+	}
+
+	fseek(out, 0, SEEK_END);
+	if (out == stdout || ftell(out) == 0)
+		fputs(VECTOR_BENCH_CSV_HEADER, out);
+
+	return out;
+}
+
+static inline void bench_close_output(FILE *out)
+{
+	if (out != stdout)
+		fclose(out);
+	else
+		fflush(out);
+}
+
+/**
+ * @brief  Write one CSV row
+ *
+ * @param  elapsed_ns  Total time of all repetitions
+ * @param  ops         Total number of operations in @p elapsed_ns
+ */
+static inline void bench_report(
+	FILE *out,
+	const char *config,
+	const char *benchmark,
+	const char *impl,
+	size_t size,
+	size_t reps,
+	uint64_t elapsed_ns,
+	size_t ops
+)
+{
+	fprintf(
+		out,
+		"%s,%s,%s,%zu,%zu,%.3f\n",
+		config,
+		benchmark,
+		impl,
+		size,
+		reps,
+		(double)elapsed_ns / (double)(ops > 0 ? ops : 1)
+	);
+}
+
+
+#endif // __VECTOR_BENCH_H__
@@ -0,0 +1,220 @@
+/**
+ * @file      vector_bench_hooks.c
+ * @brief     Inline comparison hooks versus comparison callbacks
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Instantiates the vector templates twice for a 16-byte struct:
+ *            once with equal and less hooks bound the way vector_gen.py
+ *            binds them for VECTOR_INITIALIZE_TYPE_HOOKS ("inline"), once
+ *            with hooks that call the same comparators through function
+ *            pointers ("callback"). Both run the same generated
+ *            find_first_of and sort, so the difference is the binding cost.
+ *
+ *            Output rows use the vector_bench.c CSV layout, the benchmark
+ *            names are suffixed with "_point16".
+ *
+ * @see       vector_traits.h
+ * @see       vector_bench.c
+ */
+
+#include "vector_config.h"
+#include "vector_bench.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#ifndef VECTOR_BENCH_CONFIG
+#define VECTOR_BENCH_CONFIG		"default"
+#endif // VECTOR_BENCH_CONFIG
+
+
+typedef struct bench_point
+{
+	int64_t x;
+	int64_t y;
+} bench_point_t;
+
+typedef bool (*bench_point_cmp_t)(const bench_point_t *, const bench_point_t *);
+
+
+static inline bool bench_point_equal(const bench_point_t *a, const bench_point_t *b)
+{
+	return (a->x == b->x) && (a->y == b->y);
+}
+
+static inline bool bench_point_less(const bench_point_t *a, const bench_point_t *b)
+{
+	return (a->x < b->x) || ((a->x == b->x) && (a->y < b->y));
+}
+
+/*
+ * Set in main() from the volatile sources below, so the compiler cannot
+ * turn the calls of the callback instantiation into direct calls.
+ */
+bench_point_cmp_t bench_equal_callback;
+bench_point_cmp_t bench_less_callback;
+
+static bench_point_cmp_t volatile bench_equal_source = bench_point_equal;
+static bench_point_cmp_t volatile bench_less_source = bench_point_less;
+
+
+/* Same expansion as a generated VECTOR_INITIALIZE_TYPE_HOOKS entry */
+#define T bench_point_t
+#define VECTOR_TRAITS (VECTOR_TRAIT_TRIVIAL | VECTOR_TRAIT_BITWISE_EQ)
+#define VECTOR_HOOK_EQUAL bench_point_equal
+#define VECTOR_HOOK_LESS bench_point_less
+#include "vector_template.h"
+#include "vector_template.c"
+#undef VECTOR_HOOK_EQUAL
+#undef VECTOR_HOOK_LESS
+#undef VECTOR_TRAITS
+#undef T
+
+/* The same comparators, called through function pointers */
+typedef bench_point_t bench_point_cb_t;
+
+#define T bench_point_cb_t
+#define VECTOR_TRAITS (VECTOR_TRAIT_TRIVIAL | VECTOR_TRAIT_BITWISE_EQ)
+#define VECTOR_HOOK_EQUAL bench_equal_callback
+#define VECTOR_HOOK_LESS bench_less_callback
+#include "vector_template.h"
+#include "vector_template.c"
+#undef VECTOR_HOOK_EQUAL
+#undef VECTOR_HOOK_LESS
+#undef VECTOR_TRAITS
+#undef T
+
+
+static const size_t bench_sizes[] = { 16, 128, 1024, 16384, 262144 };
+
+static volatile int bench_sink;
+
+
+/* Vector of the inline (bench_point_t) or the callback instantiation */
+#define BENCH_DEFINE_MAKE(_name) \
+static TEMPLATE(vector, _name) *TEMPLATE(bench_make, _name)(const bench_point_t *src, size_t size) \
+{ \
+	vector_error_t error = VECTOR_ERROR_SUCCESS; \
+	TEMPLATE(vector, _name) *vec = TEMPLATE(vector_create_vector, _name)( \
+		(vector_size_t)size, \
+		(bench_point_t){ 0, 0 }, \
+		&error \
+	); \
+ \
+	if (vec == NULL) \
+	{ \
+		fprintf(stderr, "[bench] create_vector(%zu) failed: %d\n", size, (int)error); \
+		exit(EXIT_FAILURE); \
+	} \
+ \
+	memcpy( \
+		TEMPLATE(vector_data, _name)((const TEMPLATE(vector, _name) **)&vec), \
+		src, \
+		size * sizeof(bench_point_t) \
+	); \
+ \
+	return vec; \
+}
+
+BENCH_DEFINE_MAKE(bench_point_t)
+BENCH_DEFINE_MAKE(bench_point_cb_t)
+
+static void bench_find(FILE *out, const bench_point_t *src, size_t size)
+{
+	const size_t reps = bench_reps(size, false);
+	const bench_point_t missing = { -1, -1 };
+	vector_bench_point_t *vec = bench_make_bench_point_t(src, size);
+	vector_bench_point_cb_t *cb_vec = bench_make_bench_point_cb_t(src, size);
+	uint64_t start;
+
+	/* Worst case: the whole range is scanned. */
+	start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+		bench_sink += (int)vector_find_first_of_bench_point_t((const vector_bench_point_t **)&vec, missing);
+	bench_report(out, VECTOR_BENCH_CONFIG, "find_first_of_point16", "inline", size, reps, bench_now_ns() - start, reps * size);
+
+	start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+		bench_sink += (int)vector_find_first_of_bench_point_cb_t((const vector_bench_point_cb_t **)&cb_vec, missing);
+	bench_report(out, VECTOR_BENCH_CONFIG, "find_first_of_point16", "callback", size, reps, bench_now_ns() - start, reps * size);
+
+	vector_destroy_vector_bench_point_cb_t(&cb_vec);
+	vector_destroy_vector_bench_point_t(&vec);
+}
+
+static void bench_sort(FILE *out, const bench_point_t *src, size_t size)
+{
+	const size_t reps = bench_reps(size, false);
+	vector_bench_point_t *vec = bench_make_bench_point_t(src, size);
+	vector_bench_point_cb_t *cb_vec = bench_make_bench_point_cb_t(src, size);
+	bench_point_t *data = vector_data_bench_point_t((const vector_bench_point_t **)&vec);
+	bench_point_t *cb_data = vector_data_bench_point_cb_t((const vector_bench_point_cb_t **)&cb_vec);
+	vector_error_t error;
+	uint64_t start;
+
+	/* Both variants re-copy the unsorted input, the copy is part of the cost. */
+	start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		memcpy(data, src, size * sizeof(bench_point_t));
+		vector_sort_bench_point_t(&vec, &error);
+	}
+	bench_report(out, VECTOR_BENCH_CONFIG, "sort_point16", "inline", size, reps, bench_now_ns() - start, reps * size);
+
+	start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		memcpy(cb_data, src, size * sizeof(bench_point_t));
+		vector_sort_bench_point_cb_t(&cb_vec, &error);
+	}
+	bench_report(out, VECTOR_BENCH_CONFIG, "sort_point16", "callback", size, reps, bench_now_ns() - start, reps * size);
+
+	bench_sink += (int)data[0].x + (int)cb_data[0].x;
+	vector_destroy_vector_bench_point_cb_t(&cb_vec);
+	vector_destroy_vector_bench_point_t(&vec);
+}
+
+
+int main(int argc, char **argv)
+{
+	FILE *out = bench_open_output(argc, argv);
+
+	if (out == NULL)
+		return EXIT_FAILURE;
+
+	bench_equal_callback = bench_equal_source;
+	bench_less_callback = bench_less_source;
+
+	for (size_t s = 0; s < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++s)
+	{
+		const size_t size = bench_sizes[s];
+
+		if (size > VECTOR_BENCH_MAX_SIZE)
+			break;
+
+		bench_point_t *src = (bench_point_t *)malloc(size * sizeof(bench_point_t));
+		uint64_t seed = 88172645463325252ULL;
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			seed ^= seed << 13;
+			seed ^= seed >> 7;
+			seed ^= seed << 17;
+			src[i].x = (int64_t)(seed % size);
+			src[i].y = (int64_t)i;
+		}
+
+		bench_find(out, src, size);
+		bench_sort(out, src, size);
+
+		free(src);
+	}
+
+	bench_close_output(out);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,196 @@
+/**
+ * @file      vector_bench_std.cpp
+ * @brief     std::vector baseline for the vector micro-benchmarks
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Runs the workloads of vector_bench.c against std::vector<int>
+ *            and writes rows with config "baseline" and impl "std" in the
+ *            same CSV format, so both can be compared side by side.
+ *
+ * @see       vector_bench.c
+ */
+
+#include "vector_bench.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+
+#define VECTOR_BENCH_CONFIG		"baseline"
+
+
+static const size_t bench_sizes[] = { 16, 128, 1024, 16384, 262144 };
+
+static volatile int bench_sink;
+
+
+static void bench_push_back(FILE *out, size_t size)
+{
+	const size_t reps = bench_reps(size, false);
+
+	const uint64_t start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		std::vector<int> vec;
+
+		for (size_t i = 0; i < size; ++i)
+			vec.push_back((int)i);
+
+		bench_sink += (int)vec.size();
+	}
+
+	bench_report(out, VECTOR_BENCH_CONFIG, "push_back", "std", size, reps, bench_now_ns() - start, reps * size);
+}
+
+static void bench_insert_indx(FILE *out, size_t size)
+{
+	const size_t reps = bench_reps(size, true);
+
+	const uint64_t start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		std::vector<int> vec;
+		vec.reserve(size);
+
+		for (size_t i = 0; i < size; ++i)
+			vec.insert(vec.begin(), (int)i);
+
+		bench_sink += (int)vec.size();
+	}
+
+	bench_report(out, VECTOR_BENCH_CONFIG, "insert_indx", "std", size, reps, bench_now_ns() - start, reps * size);
+}
+
+static void bench_erase_indx(FILE *out, size_t size)
+{
+	const size_t reps = bench_reps(size, true);
+	uint64_t elapsed = 0;
+
+	for (size_t r = 0; r < reps; ++r)
+	{
+		std::vector<int> vec(size);
+
+		const uint64_t start = bench_now_ns();
+		for (size_t i = 0; i < size; ++i)
+			vec.erase(vec.begin());
+		elapsed += bench_now_ns() - start;
+
+		bench_sink += (int)vec.size();
+	}
+
+	bench_report(out, VECTOR_BENCH_CONFIG, "erase_indx", "std", size, reps, elapsed, reps * size);
+}
+
+static void bench_find(FILE *out, size_t size)
+{
+	const size_t reps = bench_reps(size, false);
+	std::vector<int> vec(size);
+	uint64_t start;
+
+	for (size_t i = 0; i < size; ++i)
+		vec[i] = (int)i;
+
+	start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+		bench_sink += (int)(std::find(vec.begin(), vec.end(), -1) - vec.begin());
+	bench_report(out, VECTOR_BENCH_CONFIG, "find_first_of", "std", size, reps, bench_now_ns() - start, reps * size);
+
+	start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+		bench_sink += (int)(std::find(vec.rbegin(), vec.rend(), -1) - vec.rbegin());
+	bench_report(out, VECTOR_BENCH_CONFIG, "find_last_of", "std", size, reps, bench_now_ns() - start, reps * size);
+
+	std::fill(vec.begin(), vec.end(), 0);
+	vec[size - 1] = 1;
+
+	start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		bench_sink += (int)(std::find_if(
+			vec.begin(),
+			vec.end(),
+			[](int value) { return value != 0; }
+		) - vec.begin());
+	}
+	bench_report(out, VECTOR_BENCH_CONFIG, "find_first_not_of", "std", size, reps, bench_now_ns() - start, reps * size);
+}
+
+static void bench_copy_create(FILE *out, size_t size)
+{
+	const size_t reps = bench_reps(size, false);
+	const std::vector<int> vec(size, 1);
+
+	const uint64_t start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		std::vector<int> copy(vec);
+
+		bench_sink += copy.front();
+	}
+
+	bench_report(out, VECTOR_BENCH_CONFIG, "copy_create_vector", "std", size, reps, bench_now_ns() - start, reps * size);
+}
+
+static void bench_reverse(FILE *out, size_t size)
+{
+	const size_t reps = bench_reps(size, false);
+	std::vector<int> vec(size);
+
+	for (size_t i = 0; i < size; ++i)
+		vec[i] = (int)i;
+
+	const uint64_t start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+		std::reverse(vec.begin(), vec.end());
+
+	bench_report(out, VECTOR_BENCH_CONFIG, "reverse_indx", "std", size, reps, bench_now_ns() - start, reps * size);
+
+	bench_sink += vec.front();
+}
+
+static void bench_create_destroy(FILE *out, size_t size)
+{
+	const size_t reps = bench_reps(size, false);
+
+	const uint64_t start = bench_now_ns();
+	for (size_t r = 0; r < reps; ++r)
+	{
+		std::vector<int> vec(size);
+
+		bench_sink += (int)vec.size();
+	}
+
+	bench_report(out, VECTOR_BENCH_CONFIG, "create_destroy", "std", size, reps, bench_now_ns() - start, reps);
+}
+
+
+int main(int argc, char **argv)
+{
+	FILE *out = bench_open_output(argc, argv);
+
+	if (out == NULL)
+		return EXIT_FAILURE;
+
+	for (size_t s = 0; s < sizeof(bench_sizes) / sizeof(bench_sizes[0]); ++s)
+	{
+		const size_t size = bench_sizes[s];
+
+		bench_push_back(out, size);
+		if (size <= VECTOR_BENCH_MAX_QUADRATIC_SIZE)
+		{
+			bench_insert_indx(out, size);
+			bench_erase_indx(out, size);
+		}
+		bench_find(out, size);
+		bench_copy_create(out, size);
+		bench_reverse(out, size);
+		bench_create_destroy(out, size);
+	}
+
+	bench_close_output(out);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,445 @@
+/**
+ * @file      vector_replay.c
+ * @brief     Replay of a recorded vector operation trace
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Re-executes a trace written by a VECTOR_TRACE build (see
+ *            vector_trace.h) against the configuration this tool is
+ *            compiled with and reports throughput, peak heap usage and
+ *            allocator calls as one CSV row:
+ *            config,trace,ops,seconds,ops_per_sec,peak_bytes,malloc,realloc,free
+ *
+ *            Every traced type is replayed on an opaque element of its own
+ *            size (the smallest of REPLAY_ELEMENT_SIZES that holds it, a
+ *            rounded size is reported on stderr), so the replayed heap
+ *            matches the traced one. Element values are not recorded,
+ *            searches are reproduced by planting a marker at the recorded
+ *            result index so they scan the same number of elements.
+ *
+ *            The allocator under test is selected at compile time with
+ *            VECTOR_REPLAY_MALLOC / VECTOR_REPLAY_REALLOC / VECTOR_REPLAY_FREE
+ *            (malloc/realloc/free by default).
+ *
+ * @note      Dynamic configurations only. A trace records pointer-to-pointer
+ *            calls on heap vectors of any number and size, and the report is
+ *            heap traffic; static pools have a fixed VECTOR_MAX_N_VECTORS x
+ *            VECTOR_STATIC_BUFFER_SIZE per type and no heap to measure.
+ *
+ * @see       vector_trace.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vector_bench.h"
+#include "vector_trace.h"
+
+
+#ifdef VECTOR_NO_DYNAMIC_ALLOC
+#error "vector_replay replays heap vectors, build it without VECTOR_NO_DYNAMIC_ALLOC"
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+
+
+#ifndef VECTOR_REPLAY_MALLOC
+#define VECTOR_REPLAY_MALLOC(_size) 			malloc((_size))
+#endif // VECTOR_REPLAY_MALLOC
+
+#ifndef VECTOR_REPLAY_REALLOC
+#define VECTOR_REPLAY_REALLOC(_ptr, _size) 		realloc((_ptr), (_size))
+#endif // VECTOR_REPLAY_REALLOC
+
+#ifndef VECTOR_REPLAY_FREE
+#define VECTOR_REPLAY_FREE(_ptr) 				free((_ptr))
+#endif // VECTOR_REPLAY_FREE
+
+#ifndef VECTOR_BENCH_CONFIG
+#define VECTOR_BENCH_CONFIG		"default"
+#endif // VECTOR_BENCH_CONFIG
+
+/* Every block carries its size so the live heap can be tracked. */
+#define REPLAY_HEADER_SIZE		16
+
+
+typedef struct replay_stats
+{
+	size_t malloc_calls;
+	size_t realloc_calls;
+	size_t free_calls;
+	size_t live_bytes;
+	size_t peak_bytes;
+} replay_stats_t;
+
+
+static replay_stats_t replay_stats;
+
+
+static void *replay_malloc(size_t size)
+{
+	unsigned char *block = (unsigned char *)VECTOR_REPLAY_MALLOC(size + REPLAY_HEADER_SIZE);
+
+	++replay_stats.malloc_calls;
+	if (block == NULL)
+		return NULL;
+
+	memcpy(block, &size, sizeof(size));
+	replay_stats.live_bytes += size;
+	if (replay_stats.live_bytes > replay_stats.peak_bytes)
+		replay_stats.peak_bytes = replay_stats.live_bytes;
+
+	return block + REPLAY_HEADER_SIZE;
+}
+
+static void *replay_realloc(void *ptr, size_t size)
+{
+	unsigned char *block = (ptr != NULL)
+		? (unsigned char *)ptr - REPLAY_HEADER_SIZE
+		: NULL;
+	size_t old_size = 0;
+
+	if (block != NULL)
+		memcpy(&old_size, block, sizeof(old_size));
+
+	++replay_stats.realloc_calls;
+	block = (unsigned char *)VECTOR_REPLAY_REALLOC(block, size + REPLAY_HEADER_SIZE);
+	if (block == NULL)
+		return NULL;
+
+	memcpy(block, &size, sizeof(size));
+	replay_stats.live_bytes += size - old_size;
+	if (replay_stats.live_bytes > replay_stats.peak_bytes)
+		replay_stats.peak_bytes = replay_stats.live_bytes;
+
+	return block + REPLAY_HEADER_SIZE;
+}
+
+static void replay_free(void *ptr)
+{
+	if (ptr == NULL)
+		return;
+
+	unsigned char *block = (unsigned char *)ptr - REPLAY_HEADER_SIZE;
+	size_t size;
+
+	memcpy(&size, block, sizeof(size));
+	++replay_stats.free_calls;
+	replay_stats.live_bytes -= size;
+
+	VECTOR_REPLAY_FREE(block);
+}
+
+
+/* Source of the range operations, kept out of the statistics */
+static unsigned char *replay_scratch_data = NULL;
+static size_t replay_scratch_size = 0;
+
+static volatile int replay_sink;
+
+
+static const void *replay_scratch(size_t size)
+{
+	if (size > replay_scratch_size)
+	{
+		replay_scratch_data = (unsigned char *)realloc(replay_scratch_data, size);
+		if (replay_scratch_data == NULL)
+		{
+			fprintf(stderr, "[replay] out of memory\n");
+			exit(EXIT_FAILURE);
+		}
+
+		memset(replay_scratch_data + replay_scratch_size, 0, size - replay_scratch_size);
+		replay_scratch_size = size;
+	}
+
+	return replay_scratch_data;
+}
+
+
+/*
+ * The library below is compiled into this translation unit, the standard
+ * headers are already included, so only its own allocation calls are
+ * redirected to the counting wrappers.
+ */
+#define malloc(_size) 			replay_malloc((_size))
+#define realloc(_ptr, _size) 	replay_realloc((_ptr), (_size))
+#define free(_ptr) 				replay_free((_ptr))
+
+#include "vector_config.h"
+#include "vector_traits.h"
+
+/* Element sizes in bytes, ascending, one instantiation below for each */
+#define REPLAY_ELEMENT_SIZES(_X) \
+	_X(1) _X(2) _X(4) _X(8) _X(12) _X(16) _X(24) _X(32) \
+	_X(48) _X(64) _X(96) _X(128) _X(256) _X(512) _X(1024)
+
+#define REPLAY_ELEMENT_SIZE 1
+#include "vector_replay_template.c"
+#undef REPLAY_ELEMENT_SIZE
+#define REPLAY_ELEMENT_SIZE 2
+#include "vector_replay_template.c"
+#undef REPLAY_ELEMENT_SIZE
+#define REPLAY_ELEMENT_SIZE 4
+#include "vector_replay_template.c"
+#undef REPLAY_ELEMENT_SIZE
+#define REPLAY_ELEMENT_SIZE 8
+#include "vector_replay_template.c"
+#undef REPLAY_ELEMENT_SIZE
+#define REPLAY_ELEMENT_SIZE 12
+#include "vector_replay_template.c"
+#undef REPLAY_ELEMENT_SIZE
+#define REPLAY_ELEMENT_SIZE 16
+#include "vector_replay_template.c"
+#undef REPLAY_ELEMENT_SIZE
+#define REPLAY_ELEMENT_SIZE 24
+#include "vector_replay_template.c"
+#undef REPLAY_ELEMENT_SIZE
+#define REPLAY_ELEMENT_SIZE 32
+#include "vector_replay_template.c"
+#undef REPLAY_ELEMENT_SIZE
+#define REPLAY_ELEMENT_SIZE 48
+#include "vector_replay_template.c"
+#undef REPLAY_ELEMENT_SIZE
+#define REPLAY_ELEMENT_SIZE 64
+#include "vector_replay_template.c"
+#undef REPLAY_ELEMENT_SIZE
+#define REPLAY_ELEMENT_SIZE 96
+#include "vector_replay_template.c"
+#undef REPLAY_ELEMENT_SIZE
+#define REPLAY_ELEMENT_SIZE 128
+#include "vector_replay_template.c"
+#undef REPLAY_ELEMENT_SIZE
+#define REPLAY_ELEMENT_SIZE 256
+#include "vector_replay_template.c"
+#undef REPLAY_ELEMENT_SIZE
+#define REPLAY_ELEMENT_SIZE 512
+#include "vector_replay_template.c"
+#undef REPLAY_ELEMENT_SIZE
+#define REPLAY_ELEMENT_SIZE 1024
+#include "vector_replay_template.c"
+#undef REPLAY_ELEMENT_SIZE
+
+#undef malloc
+#undef realloc
+#undef free
+
+
+typedef struct replay_kind
+{
+	size_t element_size;
+	void (*record)(void **, const void *, const vector_trace_record_t *);
+	void (*destroy)(void **);
+} replay_kind_t;
+
+#define REPLAY_KIND(_size) \
+	{ _size, TEMPLATE(replay_record, TEMPLATE(replay_e, _size)), TEMPLATE(replay_destroy, TEMPLATE(replay_e, _size)) },
+
+static const replay_kind_t replay_kinds[] = { REPLAY_ELEMENT_SIZES(REPLAY_KIND) };
+
+#define REPLAY_N_KINDS 			(sizeof(replay_kinds) / sizeof(replay_kinds[0]))
+
+/* Kind of the records whose type is not declared or too large */
+#define REPLAY_NO_KIND 			UINT16_MAX
+
+
+typedef struct replay_vector
+{
+	void *vec;
+	uint16_t kind;
+} replay_vector_t;
+
+typedef struct replay_state
+{
+	replay_vector_t *vectors;
+	size_t n_vectors;
+	uint16_t kinds[VECTOR_TRACE_TYPE_OVERFLOW];
+	size_t skipped;
+} replay_state_t;
+
+
+static uint16_t replay_kind_of(size_t element_size)
+{
+	for (uint16_t k = 0; k < REPLAY_N_KINDS; ++k)
+		if (replay_kinds[k].element_size >= element_size)
+			return k;
+
+	return REPLAY_NO_KIND;
+}
+
+static replay_vector_t *replay_slot(replay_state_t *state, uint32_t vector_id)
+{
+	if (vector_id >= state->n_vectors)
+	{
+		size_t n = state->n_vectors > 0 ? state->n_vectors : 64;
+
+		while (n <= vector_id)
+			n *= 2;
+
+		/* Bookkeeping of the tool itself is kept out of the statistics. */
+		state->vectors = (replay_vector_t *)realloc(state->vectors, n * sizeof(*state->vectors));
+		memset(state->vectors + state->n_vectors, 0, (n - state->n_vectors) * sizeof(*state->vectors));
+		state->n_vectors = n;
+	}
+
+	return &state->vectors[vector_id];
+}
+
+static void replay_record(replay_state_t *state, const vector_trace_record_t *record)
+{
+	const uint16_t kind = (record->type_id < VECTOR_TRACE_TYPE_OVERFLOW)
+		? state->kinds[record->type_id]
+		: REPLAY_NO_KIND;
+
+	if (kind == REPLAY_NO_KIND)
+	{
+		++state->skipped;
+
+		return;
+	}
+
+	replay_vector_t *slot = replay_slot(state, record->vector_id);
+	const void *source = NULL;
+
+	if (record->op == VECTOR_TRACE_OP_COPY_CREATE)
+	{
+		const replay_vector_t *other = replay_slot(state, record->index);
+
+		/* replay_slot() may have moved the table */
+		slot = &state->vectors[record->vector_id];
+		if (other->kind == kind)
+			source = other->vec;
+	}
+
+	if (slot->vec != NULL && slot->kind != kind)
+	{
+		++state->skipped;
+
+		return;
+	}
+
+	slot->kind = kind;
+	replay_kinds[kind].record(&slot->vec, source, record);
+}
+
+
+int main(int argc, char **argv)
+{
+	if (argc < 2)
+	{
+		fprintf(stderr, "usage: %s <trace> [-o <result.csv>]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	FILE *trace = fopen(argv[1], "rb");
+	if (trace == NULL)
+	{
+		fprintf(stderr, "[replay] cannot open %s\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+
+	vector_trace_header_t header;
+	if (fread(&header, sizeof(header), 1, trace) != 1
+		|| header.magic != VECTOR_TRACE_MAGIC
+		|| header.version != VECTOR_TRACE_VERSION
+		|| header.record_size != sizeof(vector_trace_record_t))
+	{
+		fprintf(stderr, "[replay] %s is not a vector trace\n", argv[1]);
+		fclose(trace);
+		return EXIT_FAILURE;
+	}
+
+	/* Types are declared by the trace, anything else is not replayed. */
+	static replay_state_t state;
+
+	memset(state.kinds, 0xFF, sizeof(state.kinds));
+
+	/* Load everything first so file I/O is not part of the measurement. */
+	vector_trace_record_t *records = NULL;
+	size_t n_records = 0, allocated = 0;
+	vector_trace_record_t record;
+
+	while (fread(&record, sizeof(record), 1, trace) == 1)
+	{
+		if (record.op == VECTOR_TRACE_OP_TYPE)
+		{
+			char alias[256] = { 0 };
+			const size_t length = record.size < sizeof(alias) - 1 ? record.size : sizeof(alias) - 1;
+
+			if (fread(alias, 1, length, trace) != length)
+				break;
+			fseek(trace, (long)(record.size - length), SEEK_CUR);
+
+			const uint16_t kind = replay_kind_of(record.index);
+
+			if (record.type_id < VECTOR_TRACE_TYPE_OVERFLOW)
+				state.kinds[record.type_id] = kind;
+
+			if (kind == REPLAY_NO_KIND)
+				fprintf(stderr, "[replay] type %u: %s (%u bytes) is too large, not replayed\n", record.type_id, alias, record.index);
+			else if (replay_kinds[kind].element_size != record.index)
+				fprintf(stderr, "[replay] type %u: %s (%u bytes) replayed as %zu bytes\n", record.type_id, alias, record.index, replay_kinds[kind].element_size);
+			else
+				fprintf(stderr, "[replay] type %u: %s (%u bytes)\n", record.type_id, alias, record.index);
+			continue;
+		}
+
+		if (n_records == allocated)
+		{
+			allocated = allocated > 0 ? allocated * 2 : 4096;
+			records = (vector_trace_record_t *)realloc(records, allocated * sizeof(*records));
+		}
+
+		records[n_records++] = record;
+	}
+	fclose(trace);
+
+	memset(&replay_stats, 0, sizeof(replay_stats));
+
+	const uint64_t start = bench_now_ns();
+	for (size_t i = 0; i < n_records; ++i)
+		replay_record(&state, &records[i]);
+	const uint64_t elapsed = bench_now_ns() - start;
+
+	const replay_stats_t stats = replay_stats;
+	const double seconds = (double)elapsed / 1e9;
+
+	if (state.skipped > 0)
+		fprintf(stderr, "[replay] %zu records of undeclared or too large types skipped\n", state.skipped);
+
+	for (size_t i = 0; i < state.n_vectors; ++i)
+		if (state.vectors[i].vec != NULL)
+			replay_kinds[state.vectors[i].kind].destroy(&state.vectors[i].vec);
+	free(state.vectors);
+	free(replay_scratch_data);
+	free(records);
+
+	FILE *out = stdout;
+	for (int i = 2; i + 1 < argc; ++i)
+		if (strcmp(argv[i], "-o") == 0)
+			out = fopen(argv[i + 1], "a");
+	if (out == NULL)
+		return EXIT_FAILURE;
+
+	fseek(out, 0, SEEK_END);
+	if (out == stdout || ftell(out) == 0)
+		fputs("config,trace,ops,seconds,ops_per_sec,peak_bytes,malloc,realloc,free\n", out);
+
+	fprintf(
+		out,
+		"%s,%s,%zu,%.6f,%.0f,%zu,%zu,%zu,%zu\n",
+		VECTOR_BENCH_CONFIG,
+		argv[1],
+		n_records,
+		seconds,
+		seconds > 0 ? (double)n_records / seconds : 0.0,
+		stats.peak_bytes,
+		stats.malloc_calls,
+		stats.realloc_calls,
+		stats.free_calls
+	);
+
+	bench_close_output(out);
+
+	return EXIT_SUCCESS;
+}
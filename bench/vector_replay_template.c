@@ -0,0 +1,196 @@
+/**
+ * @file      vector_replay_template.c
+ * @brief     Replay of trace records on elements of one size
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Included by vector_replay.c once per REPLAY_ELEMENT_SIZE:
+ *            instantiates the vector templates for an opaque element of
+ *            that many bytes and defines replay_record_/replay_destroy_ for
+ *            it, so every traced type is replayed with its own element size.
+ *
+ * @note      This file should not be included directly.
+ *
+ * @see       vector_replay.c
+ */
+
+#ifdef REPLAY_ELEMENT_SIZE
+
+#include "template.h"
+
+
+#define T 						TEMPLATE(replay_e, REPLAY_ELEMENT_SIZE)
+#define REPLAY_VECTOR 			TEMPLATE(vector, T)
+#define REPLAY_CALL(_name) 		TEMPLATE(vector, TEMPLATE(_name, T))
+#define REPLAY_SPAN_T 			TEMPLATE(vector_span, T)
+#define REPLAY_SPAN(_name) 		TEMPLATE(vector_span, TEMPLATE(_name, T))
+#define REPLAY_FUNC(_name) 		TEMPLATE(_name, T)
+
+
+typedef struct T
+{
+	unsigned char bytes[REPLAY_ELEMENT_SIZE];
+} T;
+
+#define VECTOR_TRAITS (VECTOR_TRAIT_TRIVIAL | VECTOR_TRAIT_BITWISE_EQ | VECTOR_TRAIT_ZERO_IS_DEFAULT)
+#include "vector_template.h"
+#include "vector_template.c"
+#undef VECTOR_TRAITS
+
+
+/* Zeroed source of the range operations, count elements long */
+static REPLAY_SPAN_T REPLAY_FUNC(replay_range)(uint32_t count)
+{
+	return REPLAY_SPAN(from)(
+		(const T *)replay_scratch((size_t)count * sizeof(T)),
+		(vector_size_t)count
+	);
+}
+
+/* Plant a non-zero marker at the recorded result so the search stops there. */
+static void REPLAY_FUNC(replay_find)(REPLAY_VECTOR **self, const vector_trace_record_t *record)
+{
+	const REPLAY_VECTOR **cself = (const REPLAY_VECTOR **)self;
+	const vector_index_t found = (vector_index_t)(int32_t)record->index;
+	const bool marked = (found >= 0
+		&& (vector_size_t)found < REPLAY_CALL(size)(cself));
+	T zero, marker;
+
+	memset(&zero, 0, sizeof(zero));
+	memset(&marker, 1, sizeof(marker));
+
+	if (marked)
+		REPLAY_CALL(emplace_indx)(self, found, marker, NULL);
+
+	switch (record->op)
+	{
+	case VECTOR_TRACE_OP_FIND_FIRST_NOT_OF:
+		replay_sink += (int)REPLAY_CALL(find_first_not_of)(cself, zero);
+		break;
+	case VECTOR_TRACE_OP_FIND_LAST_NOT_OF:
+		replay_sink += (int)REPLAY_CALL(find_last_not_of)(cself, zero);
+		break;
+	case VECTOR_TRACE_OP_FIND_FIRST_OF:
+		replay_sink += (int)REPLAY_CALL(find_first_of)(cself, marker);
+		break;
+	default:
+		replay_sink += (int)REPLAY_CALL(find_last_of)(cself, marker);
+		break;
+	}
+
+	if (marked)
+		REPLAY_CALL(emplace_indx)(self, found, zero, NULL);
+}
+
+/*
+ * *slot is the vector of the record, source the vector a COPY_CREATE
+ * record copies (NULL when it is not replayed with this element size).
+ */
+static void REPLAY_FUNC(replay_record)(
+	void **slot,
+	const void *source,
+	const vector_trace_record_t *record
+)
+{
+	REPLAY_VECTOR **self = (REPLAY_VECTOR **)slot;
+	const REPLAY_VECTOR **cself = (const REPLAY_VECTOR **)slot;
+	const vector_index_t index = (vector_index_t)(int32_t)record->index;
+	const vector_index_t arg = (vector_index_t)(int32_t)record->arg;
+	T zero;
+
+	memset(&zero, 0, sizeof(zero));
+
+	if (record->op != VECTOR_TRACE_OP_CREATE
+		&& record->op != VECTOR_TRACE_OP_COPY_CREATE
+		&& *self == NULL)
+	{
+		return;
+	}
+
+	switch ((vector_trace_op_t)record->op)
+	{
+	case VECTOR_TRACE_OP_CREATE:
+		*self = REPLAY_CALL(create_vector)((vector_size_t)record->size, zero, NULL);
+		break;
+	case VECTOR_TRACE_OP_COPY_CREATE:
+		if (source != NULL)
+			*self = REPLAY_CALL(copy_create_vector)((const REPLAY_VECTOR *)source, NULL);
+		break;
+	case VECTOR_TRACE_OP_MOVE_CREATE:
+		*self = REPLAY_CALL(move_create_vector)(self, NULL);
+		break;
+	case VECTOR_TRACE_OP_DESTROY:
+		REPLAY_CALL(destroy_vector)(self);
+		*self = NULL;
+		break;
+	case VECTOR_TRACE_OP_ASSIGN:
+		REPLAY_CALL(assign)(self, (vector_size_t)record->index, zero, NULL);
+		break;
+	case VECTOR_TRACE_OP_ASSIGN_RANGE:
+		REPLAY_CALL(assign_span)(self, REPLAY_FUNC(replay_range)(record->index), NULL);
+		break;
+	case VECTOR_TRACE_OP_AT:
+		replay_sink += (int)REPLAY_CALL(at)(cself, index, NULL).bytes[0];
+		break;
+	case VECTOR_TRACE_OP_CLEAR:
+		REPLAY_CALL(clear)(self);
+		break;
+	case VECTOR_TRACE_OP_EMPLACE:
+		REPLAY_CALL(emplace_indx)(self, index, zero, NULL);
+		break;
+	case VECTOR_TRACE_OP_EMPLACE_RANGE:
+		REPLAY_CALL(emplace_span_indx)(self, index, REPLAY_FUNC(replay_range)(record->arg), NULL);
+		break;
+	case VECTOR_TRACE_OP_ERASE:
+		REPLAY_CALL(erase_indx)(self, index, NULL);
+		break;
+	case VECTOR_TRACE_OP_FIND_FIRST_NOT_OF:
+	case VECTOR_TRACE_OP_FIND_LAST_NOT_OF:
+	case VECTOR_TRACE_OP_FIND_FIRST_OF:
+	case VECTOR_TRACE_OP_FIND_LAST_OF:
+		REPLAY_FUNC(replay_find)(self, record);
+		break;
+	case VECTOR_TRACE_OP_INSERT:
+		REPLAY_CALL(insert_indx)(self, index, zero, NULL);
+		break;
+	case VECTOR_TRACE_OP_INSERT_RANGE:
+		REPLAY_CALL(insert_span_indx)(self, index, REPLAY_FUNC(replay_range)(record->arg), NULL);
+		break;
+	case VECTOR_TRACE_OP_POP_BACK:
+		REPLAY_CALL(pop_back)(self);
+		break;
+	case VECTOR_TRACE_OP_PUSH_BACK:
+		REPLAY_CALL(push_back)(self, zero, NULL);
+		break;
+	case VECTOR_TRACE_OP_RESERVE:
+		REPLAY_CALL(reserve)(self, index, NULL);
+		break;
+	case VECTOR_TRACE_OP_RESIZE:
+		REPLAY_CALL(resize)(self, (vector_size_t)record->index, NULL);
+		break;
+	case VECTOR_TRACE_OP_REVERSE:
+		REPLAY_CALL(reverse_indx)(self, index, arg, NULL);
+		break;
+	case VECTOR_TRACE_OP_SWAP:
+		REPLAY_CALL(swap_indx)(self, index, arg, NULL);
+		break;
+	default:
+		break;
+	}
+}
+
+static void REPLAY_FUNC(replay_destroy)(void **slot)
+{
+	REPLAY_CALL(destroy_vector)((REPLAY_VECTOR **)slot);
+}
+
+
+#undef REPLAY_FUNC
+#undef REPLAY_SPAN
+#undef REPLAY_SPAN_T
+#undef REPLAY_CALL
+#undef REPLAY_VECTOR
+#undef T
+
+#endif // REPLAY_ELEMENT_SIZE
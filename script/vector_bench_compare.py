@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+"""
+Vector Benchmark Comparator
+Compares two CSV result files produced by the vector_bench target
+and reports measurements that regressed past a threshold.
+"""
+
+import argparse
+import csv
+import sys
+from pathlib import Path
+from typing import Dict, Tuple
+
+# ==================== CONFIGURATION ====================
+VERSION = "1.0.1"
+
+KEY_FIELDS = ('config', 'benchmark', 'impl', 'size')
+
+ESC = '\x1b'
+
+class Colors:
+    """ANSI color codes for terminal output"""
+    CYAN = f'{ESC}[96m'
+    RED = f'{ESC}[91m'
+    GREEN = f'{ESC}[92m'
+    END = f'{ESC}[0m'
+    BOLD = f'{ESC}[1m'
+
+# ==================== LOADING ====================
+def load_results(path: Path) -> Dict[Tuple[str, ...], float]:
+    """Load a result file into {(config, benchmark, impl, size): ns_per_op}"""
+    results = {}
+
+    with open(path, newline='', encoding='utf-8') as f:
+        for row in csv.DictReader(f):
+            # Result files may be concatenated, skip repeated headers
+            if row['config'] == 'config':
+                continue
+            key = tuple(row[field] for field in KEY_FIELDS)
+            results[key] = float(row['ns_per_op'])
+
+    return results
+
+# ==================== COMPARISON ====================
+def compare(baseline: dict, current: dict, threshold: float, show_all: bool) -> int:
+    """Print the comparison table and return the number of regressions"""
+    regressions = 0
+    common = sorted(set(baseline) & set(current), key=lambda k: (k[0], k[1], k[2], int(k[3])))
+
+    print(f"{Colors.CYAN}{'config':<10} {'benchmark':<20} {'impl':<8} {'size':>8} "
+          f"{'base ns':>10} {'curr ns':>10} {'change':>9}{Colors.END}")
+
+    for key in common:
+        base, curr = baseline[key], current[key]
+        change = (curr - base) / base * 100.0 if base > 0 else 0.0
+        regressed = change > threshold
+
+        if regressed:
+            regressions += 1
+
+        if regressed or show_all or change < -threshold:
+            color = Colors.RED if regressed else (Colors.GREEN if change < -threshold else '')
+            end = Colors.END if color else ''
+            print(f"{color}{key[0]:<10} {key[1]:<20} {key[2]:<8} {key[3]:>8} "
+                  f"{base:>10.3f} {curr:>10.3f} {change:>+8.1f}%{end}")
+
+    missing = set(baseline) - set(current)
+    if missing:
+        print(f"\n{len(missing)} measurement(s) from the baseline are missing in the current results")
+
+    print(f"\n{Colors.BOLD}Compared: {len(common)}, regressions (> {threshold:.1f}%): {regressions}{Colors.END}")
+
+    return regressions
+
+# ==================== MAIN ====================
+def main():
+    parser = argparse.ArgumentParser(description='Vector Benchmark Comparator')
+    parser.add_argument('baseline', type=Path, help='Baseline result file (CSV)')
+    parser.add_argument('current', type=Path, help='Current result file (CSV)')
+    parser.add_argument('--threshold', type=float, default=10.0,
+                       help='Regression threshold in percent (default: 10)')
+    parser.add_argument('--all', action='store_true',
+                       help='Print every measurement, not only changes past the threshold')
+
+    args = parser.parse_args()
+
+    for path in (args.baseline, args.current):
+        if not path.exists():
+            print(f"{Colors.RED}[ERROR] {path} not found!{Colors.END}")
+            sys.exit(2)
+
+    regressions = compare(
+        load_results(args.baseline),
+        load_results(args.current),
+        args.threshold,
+        args.all
+    )
+
+    sys.exit(1 if regressions > 0 else 0)
+
+if __name__ == '__main__':
+    main()
@@ -63,6 +63,7 @@ if not exist "%H_FILE%" (
 :: Generated files
 set "DECL_H_FILE=%GEN_DIR%\vector_decl.h"
 set "IMPL_C_FILE=%GEN_DIR%\vector_impl.c"
+set "INLINE_H_FILE=%GEN_DIR%\vector_inline.h"
 set "ALIASES_H_FILE=%GEN_DIR%\vector_aliases.h"
 set "TYPES_TXT_FILE=%DOC_DIR%\vector_types.txt"
 set "DEBUG_TXT_FILE=%LOG_DIR%\vector_gen.txt"
@@ -74,6 +75,7 @@ echo.
 echo %BOLD%Output files:%RESET%
 echo %TAB%Declaration          :: %DECL_H_FILE%
 echo %TAB%Implementation       :: %IMPL_C_FILE%
+echo %TAB%Header-only          :: %INLINE_H_FILE%
 echo %TAB%Aliases              :: %ALIASES_H_FILE%
 echo %TAB%Documentation        :: %TYPES_TXT_FILE%
 echo %TAB%Debug                :: %DEBUG_TXT_FILE%
@@ -107,7 +109,7 @@ for /f "usebackq delims=" %%a in ("%H_FILE%") do (
     :: Search for initialization macros
     echo !LINE! | findstr /r "VECTOR_INITIALIZE_[A-Z_]*([^)]*)" >nul
     if !errorlevel! equ 0 (
-        for /f "tokens=2 delims=()" %%b in ("!LINE!") do (
+        for /f "tokens=2 delims=()," %%b in ("!LINE!") do (
             set "RAW_TYPE=%%b"
             
             if defined RAW_TYPE (
@@ -206,7 +208,7 @@ echo.
 echo %BOLD%[3/4] Generating files...%RESET%
 
 :: 3.1 Generate vector_aliases.h
-echo %TAB%[1/4] vector_aliases.h
+echo %TAB%[1/5] vector_aliases.h
 
 (
     echo /**
@@ -251,7 +253,7 @@ for /f "usebackq tokens=1,2 delims=|" %%a in ("%PAIRS_TEMP_FILE%") do (
 echo #endif // __VECTOR_ALIASES_H__ >> "%ALIASES_H_FILE%"
 
 :: 3.2 Generate vector_decl.h
-echo %TAB%[2/4] vector_decl.h
+echo %TAB%[2/5] vector_decl.h
 
 (
 	echo /**
@@ -315,7 +317,7 @@ for /f "usebackq tokens=1,2 delims=|" %%a in ("%PAIRS_TEMP_FILE%") do (
 ) >> "%DECL_H_FILE%"
 
 :: 3.3 Generate vector_impl.c
-echo %TAB%[3/4] vector_impl.c
+echo %TAB%[3/5] vector_impl.c
 
 (
     echo /**
@@ -373,8 +375,73 @@ for /f "usebackq tokens=1,2 delims=|" %%a in ("%PAIRS_TEMP_FILE%") do (
     echo #endif
 ) >> "%IMPL_C_FILE%"
 
-:: 3.4 Generate documentation
-echo %TAB%[4/4] vector_types.txt
+:: 3.4 Generate vector_inline.h
+echo %TAB%[4/5] vector_inline.h
+
+(
+    echo /**
+    echo  * @file      	vector_inline.h
+    echo  * @brief     	Header-only vector implementations
+	echo  * 			This file contains the implementations of all vector operations
+    echo  * 			for each type defined in the system as static inline functions.
+	echo  * @author    	Generated by vector_gen.bat
+    echo  *
+    echo  * @date      	%DATE% %TIME%
+    echo  * @version   	%VERSION%
+    echo  *
+    echo  * @details   	Included from vector.h when VECTOR_HEADER_ONLY is defined,
+    echo  *            	so calls into the %PAIR_COUNT% vector types can be inlined and
+    echo  *            	vectorized without LTO. vector_impl.c is not compiled then.
+    echo  *
+    echo  * @note      	This file is automatically generated
+    echo  * @warning   	DO NOT EDIT THIS FILE MANUALLY.
+    echo  *            	Any manual changes will be lost on regeneration.
+    echo  *
+    echo  * @see       	vector_template.c
+    echo  * @see       	vector_impl.c
+    echo  */
+    echo.
+    echo #ifndef __VECTOR_INLINE_H__
+    echo #define __VECTOR_INLINE_H__
+    echo.
+    echo #ifdef VECTOR_HEADER_ONLY
+    echo.
+    echo #include "vector_decl.h"
+    echo.
+    echo #ifdef T
+    echo #define _OLD_T T
+    echo #undef T
+    echo #endif
+    echo.
+) > "%INLINE_H_FILE%"
+
+for /f "usebackq tokens=1,2 delims=|" %%a in ("%PAIRS_TEMP_FILE%") do (
+    for /f "tokens=*" %%r in ("%%a") do (
+        for /f "tokens=*" %%c in ("%%b") do (
+            (
+                echo /* Type: %%r -^> %%c */
+                echo #define T %%c
+                echo #include "vector_template.c"
+                echo #undef T
+                echo.
+            ) >> "%INLINE_H_FILE%"
+        )
+    )
+)
+
+(
+    echo #ifdef _OLD_T
+    echo #define T _OLD_T
+    echo #undef _OLD_T
+    echo #endif
+    echo.
+    echo #endif // VECTOR_HEADER_ONLY
+    echo.
+    echo #endif // __VECTOR_INLINE_H__
+) >> "%INLINE_H_FILE%"
+
+:: 3.5 Generate documentation
+echo %TAB%[5/5] vector_types.txt
 
 :: Add padding for better appearance
 set /a MAX_RAW_LEN+=1
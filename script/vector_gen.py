@@ -16,7 +16,7 @@ from datetime import datetime
 from pathlib import Path
 import argparse
 import shutil
-from typing import List, Tuple, Set, Optional
+from typing import Dict, List, Tuple, Set, Optional
 
 # ==================== CONFIGURATION ====================
 if platform.system() == "Windows":
@@ -26,6 +26,24 @@ if platform.system() == "Windows":
 
 VERSION = "1.0.1"
 
+TRAIT_NAMES = ('TRIVIAL', 'BITWISE_EQ', 'ORDERED', 'ZERO_IS_DEFAULT', 'RADIX', 'ARITHMETIC')
+
+INTEGER_TYPE_NAMES = {'', 'int', 'char', 'short', 'long', 'long long', 'bool', '_Bool', 'size_t', 'ssize_t', 'ptrdiff_t'}
+INTEGER_TYPE_PATTERN = r'u?int(_least|_fast)?(8|16|32|64|ptr|max)_t'
+FLOAT_TYPE_NAMES = {'float', 'double'}
+
+HOOK_NAMES = ('EQUAL', 'LESS', 'HASH')
+
+BIT_TYPE_NAMES = {'bool', '_Bool'}
+
+SOA_FIELD_PATTERN = r'(.*?[\s*])([A-Za-z_][A-Za-z0-9_]*)'
+
+SECTION_PATTERN = r'[.A-Za-z_$][.A-Za-z0-9_$]*'
+
+# Element sizes of builtin types that do not depend on the target
+FIXED_TYPE_SIZES = {'char': 1, 'bool': 1, '_Bool': 1, 'short': 2, 'int': 4,
+                    'float': 4, 'double': 8, 'long long': 8}
+
 # ==================== TYPE PARSER ====================
 class CTypeParser:
     """Parses C types and generates aliases"""
@@ -130,6 +148,37 @@ class CTypeParser:
             alias = alias[:-1]
         
         return alias
+    
+    def infer_traits(self, parsed: dict) -> List[str]:
+        """Infer traits of builtin types, user types get none"""
+        if parsed['pointers'] > 0:
+            return ['TRIVIAL', 'BITWISE_EQ', 'ORDERED', 'ZERO_IS_DEFAULT']
+        if parsed['qualifiers']['struct']:
+            return []
+        
+        type_name = parsed['type_name']
+        if type_name in BIT_TYPE_NAMES:
+            return [t for t in TRAIT_NAMES if t != 'ARITHMETIC']
+        if type_name in INTEGER_TYPE_NAMES or re.fullmatch(INTEGER_TYPE_PATTERN, type_name):
+            return list(TRAIT_NAMES)
+        if type_name in FLOAT_TYPE_NAMES:
+            return ['TRIVIAL', 'ORDERED', 'ZERO_IS_DEFAULT', 'ARITHMETIC']
+        return []
+    
+    def parse_traits(self, traits_str: str) -> List[str]:
+        """Parse 'A | VECTOR_TRAIT_B' list of VECTOR_INITIALIZE_TYPE_EX"""
+        traits = []
+        for name in traits_str.split('|'):
+            name = name.strip()
+            if name.startswith('VECTOR_TRAIT_'):
+                name = name[len('VECTOR_TRAIT_'):]
+            if name in ('', 'NONE'):
+                continue
+            if name not in TRAIT_NAMES:
+                raise ValueError(f"unknown trait '{name}'")
+            if name not in traits:
+                traits.append(name)
+        return traits
 
 # ==================== GENERATOR ====================
 ESC = '\x1b'
@@ -148,6 +197,12 @@ class VectorGenerator:
         """Initialize generator"""
         self.parser = CTypeParser()
         self.types: List[Tuple[str, str]] = []
+        self.traits: Dict[str, List[str]] = {}
+        self.hooks: Dict[str, Dict[str, str]] = {}
+        self.bits: Set[str] = set()
+        self.soa: List[Tuple[str, str, List[Tuple[str, str]]]] = []
+        self.segmented: List[Tuple[str, str, List[str]]] = []
+        self.pools: Dict[str, Dict[str, str]] = {}
         self.start_time = time.time()
         
         self.script_dir = Path(__file__).parent.resolve()
@@ -200,45 +255,270 @@ class VectorGenerator:
         
         content = self.header_file.read_text(encoding='utf-8')
         
-        pattern = r'VECTOR_INITIALIZE_[A-Z_]*\s*\(\s*([^)]+)\s*\)'
+        pattern = r'VECTOR_INITIALIZE_([A-Z_]*)\s*\(\s*([^)]+)\s*\)'
         matches = re.findall(pattern, content)
         
         seen = set()
         self.types.clear()
         
-        for match in matches:
-            original = match.strip()
+        self.traits.clear()
+        self.hooks.clear()
+        self.bits.clear()
+        self.soa.clear()
+        soa_seen = set()
+        self.segmented.clear()
+        segmented_seen = set()
+        self.pools.clear()
+        pool_types: List[Tuple[str, dict]] = []
+        
+        for macro, match in matches:
+            args = [arg.strip() for arg in match.split(',')]
+            original = args[0]
+            traits_str = args[1] if len(args) > 1 else ''
+            if macro == 'SOA':
+                if original and original not in soa_seen:
+                    soa_seen.add(original)
+                    alias = self.parser.parse_type(original)['alias'] + '_t'
+                    try:
+                        fields = self.parse_soa_fields(args[1:])
+                    except ValueError as e:
+                        print(f"{Colors.RED}[ERROR] {original}: {e}{Colors.END}")
+                        return False
+                    self.soa.append((original, alias, fields))
+                    print(f"\t[SoA] Found type: {original} ({', '.join(n for _, n in fields)})")
+                continue
+            if macro == 'TYPE_POOL':
+                parsed = self.parser.parse_type(original)
+                alias = parsed['alias'] + '_t'
+                try:
+                    self.pools[alias] = self.parse_pool(args)
+                except ValueError as e:
+                    print(f"{Colors.RED}[ERROR] {original}: {e}{Colors.END}")
+                    return False
+                pool_types.append((original, parsed))
+                print(f"\t[Pool] Found type: {original}")
+                continue
+            if macro == 'TYPE_SEGMENTED':
+                if original and original not in segmented_seen:
+                    segmented_seen.add(original)
+                    parsed = self.parser.parse_type(original)
+                    if len(args) != 1:
+                        print(f"{Colors.RED}[ERROR] {original}: VECTOR_INITIALIZE_TYPE_SEGMENTED expects only the type{Colors.END}")
+                        return False
+                    alias = parsed['alias'] + '_t'
+                    self.segmented.append((original, alias, self.parser.infer_traits(parsed)))
+                    print(f"\t[Segmented] Found type: {original}")
+                continue
             if original and original not in seen:
                 seen.add(original)
                 parsed = self.parser.parse_type(original)
                 alias = parsed['alias'] + '_t'
+                
+                try:
+                    if traits_str:
+                        traits = self.parser.parse_traits(traits_str)
+                    else:
+                        traits = self.parser.infer_traits(parsed)
+                    hooks = self.parse_hooks(macro, args[2:])
+                    if macro == 'TYPE_BITS':
+                        self.check_bits(parsed, args)
+                        self.bits.add(alias)
+                except ValueError as e:
+                    print(f"{Colors.RED}[ERROR] {original}: {e}{Colors.END}")
+                    return False
+                
                 self.types.append((original, alias))
+                self.traits[alias] = traits
+                self.hooks[alias] = hooks
                 
                 print(f"\t[{len(self.types)}] Found type: {original}")
         
-        if not self.types:
+        # A pool declares its type unless another macro did
+        for original, parsed in pool_types:
+            if original not in seen:
+                seen.add(original)
+                alias = parsed['alias'] + '_t'
+                self.types.append((original, alias))
+                self.traits[alias] = self.parser.infer_traits(parsed)
+                self.hooks[alias] = {}
+                print(f"\t[{len(self.types)}] Found type: {original}")
+        
+        if not self.types and not self.soa and not self.segmented:
             print(f"{Colors.RED}[ERROR] No types found!{Colors.END}")
             return False
         
-        print(f"\n\tFound unique types: {len(self.types)}\n")
+        print(f"\n\tFound unique types: {len(self.types) + len(self.soa) + len(self.segmented)}\n")
         return True
     
     def display_aliases(self):
         """Display generated aliases in formatted table"""
         print(f"{Colors.BOLD}[2/3] Generating aliases...{Colors.END}")
         
-        max_original = max(len(t[0]) for t in self.types)
-        max_alias = max(len(t[1]) for t in self.types)
+        entries = [(original, alias) for original, alias in self.types]
+        entries += [(original, alias) for original, alias, _ in self.soa]
+        entries += [(original, alias) for original, alias, _ in self.segmented]
+        max_original = max(len(t[0]) for t in entries)
         
-        for i, (original, alias) in enumerate(self.types, 1):
+        for i, (original, alias) in enumerate(entries, 1):
             padded_original = original.ljust(max_original)
-            print(f"\t[{i}/{len(self.types)}] {padded_original} --> {alias}")
+            print(f"\t[{i}/{len(entries)}] {padded_original} --> {alias}")
         
-        print(f"\n\tGenerated aliases: {len(self.types)}\n")
+        print(f"\n\tGenerated aliases: {len(entries)}\n")
+    
+    def parse_hooks(self, macro: str, args: List[str]) -> Dict[str, str]:
+        """Bind equal/less/hash of VECTOR_INITIALIZE_TYPE_HOOKS, empty arguments stay unbound"""
+        if macro != 'TYPE_HOOKS':
+            return {}
+        if len(args) != len(HOOK_NAMES):
+            raise ValueError("VECTOR_INITIALIZE_TYPE_HOOKS expects type, traits, equal, less, hash")
+        
+        hooks = {}
+        for name, func in zip(HOOK_NAMES, args):
+            if not func:
+                continue
+            if not re.fullmatch(r'[A-Za-z_][A-Za-z0-9_]*', func):
+                raise ValueError(f"hook '{func}' is not an identifier")
+            hooks[name] = func
+        return hooks
+    
+    def parse_pool(self, args: List[str]) -> Dict[str, str]:
+        """Pool size and placement of VECTOR_INITIALIZE_TYPE_POOL, empty arguments keep the defaults"""
+        if len(args) != 5:
+            raise ValueError("VECTOR_INITIALIZE_TYPE_POOL expects type, n_vectors, buffer_size, section, align")
+        
+        pool = {}
+        for name, value in zip(('n_vectors', 'buffer_size'), args[1:3]):
+            if not value:
+                continue
+            if not re.fullmatch(r'[1-9][0-9]*[uU]?', value):
+                raise ValueError(f"{name} '{value}' is not a positive integer")
+            pool[name] = value.rstrip('uU')
+        
+        section = args[3].strip('"')
+        if section:
+            if not re.fullmatch(SECTION_PATTERN, section):
+                raise ValueError(f"section '{section}' is not a section name")
+            pool['section'] = section
+        
+        align = args[4]
+        if align:
+            if not re.fullmatch(r'[1-9][0-9]*', align) or int(align) & (int(align) - 1):
+                raise ValueError(f"align '{align}' is not a power of two")
+            pool['align'] = align
+        return pool
+    
+    def element_size(self, original: str) -> Optional[int]:
+        """Size of a builtin type when it is the same on every target"""
+        parsed = self.parser.parse_type(original)
+        if parsed['pointers'] > 0 or parsed['qualifiers']['struct'] or parsed['qualifiers']['long']:
+            return None
+        if parsed['qualifiers']['long_long']:
+            return 8
+        if parsed['qualifiers']['short']:
+            return 2
+        type_name = parsed['type_name'] or 'int'
+        match = re.fullmatch(r'u?int(8|16|32|64)_t', type_name)
+        if match:
+            return int(match.group(1)) // 8
+        return FIXED_TYPE_SIZES.get(type_name)
+    
+    def parse_soa_fields(self, args: List[str]) -> List[Tuple[str, str]]:
+        """Parse the 'type name' field list of VECTOR_INITIALIZE_SOA"""
+        fields = []
+        names = set()
+        for arg in args:
+            match = re.fullmatch(SOA_FIELD_PATTERN, arg)
+            if not match or not match.group(1).strip():
+                raise ValueError(f"field '{arg}' is not 'type name'")
+            field_type, name = match.group(1).strip(), match.group(2)
+            if name in names:
+                raise ValueError(f"duplicate field '{name}'")
+            names.add(name)
+            fields.append((field_type, name))
+        if not fields:
+            raise ValueError("VECTOR_INITIALIZE_SOA expects at least one field")
+        return fields
+    
+    def write_soa(self, f, alias: str, fields: List[Tuple[str, str]], template: str):
+        """SoA type block: row type as T and the field list as an X-macro"""
+        columns = ' '.join(f'_X({field_type}, {name})' for field_type, name in fields)
+        f.write(f"#define T {alias}\n")
+        f.write(f"#define VECTOR_SOA_FIELDS(_X) {columns}\n")
+        f.write(f'#include "{template}"\n')
+        f.write(f"#undef VECTOR_SOA_FIELDS\n")
+        f.write(f"#undef T\n\n")
+    
+    def write_segmented(self, f, alias: str, traits: List[str], template: str):
+        """Segmented type block: T with inferred traits and VECTOR_SEGMENTED"""
+        traits_expr = '(' + ' | '.join(f'VECTOR_TRAIT_{t}' for t in traits) + ')' if traits else 'VECTOR_TRAIT_NONE'
+        f.write(f"#define T {alias}\n")
+        f.write(f"#define VECTOR_TRAITS {traits_expr}\n")
+        f.write(f"#define VECTOR_SEGMENTED\n")
+        f.write(f'#include "{template}"\n')
+        f.write(f"#undef VECTOR_SEGMENTED\n")
+        f.write(f"#undef VECTOR_TRAITS\n")
+        f.write(f"#undef T\n\n")
+    
+    def check_bits(self, parsed: dict, args: List[str]):
+        """VECTOR_INITIALIZE_TYPE_BITS takes a single boolean type"""
+        if len(args) != 1:
+            raise ValueError("VECTOR_INITIALIZE_TYPE_BITS expects only the type")
+        if parsed['pointers'] > 0 or parsed['type_name'] not in BIT_TYPE_NAMES:
+            raise ValueError("VECTOR_INITIALIZE_TYPE_BITS expects bool or _Bool")
+    
+    def write_type_defines(self, f, alias: str):
+        """Per-type macros around a template include"""
+        f.write(f"#define T {alias}\n")
+        f.write(f"#define VECTOR_TRAITS {self.traits_expr(alias)}\n")
+        for name, func in self.hooks.get(alias, {}).items():
+            f.write(f"#define VECTOR_HOOK_{name} {func}\n")
+        if alias in self.bits:
+            f.write(f"#define VECTOR_BIT_PACKED\n")
+        pool = self.pools.get(alias, {})
+        if 'n_vectors' in pool:
+            f.write(f"#define VECTOR_TYPE_MAX_N_VECTORS {pool['n_vectors']}\n")
+        if 'buffer_size' in pool:
+            f.write(f"#define VECTOR_TYPE_STATIC_BUFFER_SIZE {pool['buffer_size']}\n")
+        if 'align' in pool:
+            f.write(f"#define VECTOR_TYPE_STATIC_ALIGN {pool['align']}\n")
+        placement = self.pool_placement(pool)
+        if placement:
+            f.write(f"#define VECTOR_TYPE_POOL_PLACEMENT {placement}\n")
+    
+    def write_type_undefs(self, f, alias: str):
+        """Undo write_type_defines()"""
+        pool = self.pools.get(alias, {})
+        if self.pool_placement(pool):
+            f.write(f"#undef VECTOR_TYPE_POOL_PLACEMENT\n")
+        if 'align' in pool:
+            f.write(f"#undef VECTOR_TYPE_STATIC_ALIGN\n")
+        if 'buffer_size' in pool:
+            f.write(f"#undef VECTOR_TYPE_STATIC_BUFFER_SIZE\n")
+        if 'n_vectors' in pool:
+            f.write(f"#undef VECTOR_TYPE_MAX_N_VECTORS\n")
+        if alias in self.bits:
+            f.write(f"#undef VECTOR_BIT_PACKED\n")
+        for name in self.hooks.get(alias, {}):
+            f.write(f"#undef VECTOR_HOOK_{name}\n")
+        f.write(f"#undef VECTOR_TRAITS\n")
+        f.write(f"#undef T\n\n")
+    
+    def pool_placement(self, pool: Dict[str, str]) -> str:
+        """VECTOR_SECTION() of a pool, empty for the default placement"""
+        if 'section' in pool:
+            return f'VECTOR_SECTION("{pool["section"]}")'
+        return ''
+    
+    def traits_expr(self, alias: str) -> str:
+        """C expression for VECTOR_TRAITS of a type"""
+        traits = self.traits.get(alias, [])
+        if not traits:
+            return 'VECTOR_TRAIT_NONE'
+        return '(' + ' | '.join(f'VECTOR_TRAIT_{t}' for t in traits) + ')'
     
     def generate_aliases_h(self, output_file: Path):
         """Generate vector_aliases.h"""
-        print("\t[1/4] vector_aliases.h")
+        print("\t[1/6] vector_aliases.h")
         
         now = datetime.now().strftime("%Y-%m-%d %H:%M:%S")
         
@@ -269,12 +549,37 @@ class VectorGenerator:
 #ifndef __VECTOR_ALIASES_H__
 #define __VECTOR_ALIASES_H__
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
 """)
             
                 for original, alias in self.types:
                     f.write(f"/* Type: {original} */\n")
                     f.write(f"typedef {original} {alias};\n\n")
                 
+                aliases = {alias for _, alias in self.types}
+                for original, alias, _ in self.soa:
+                    if alias not in aliases:
+                        aliases.add(alias)
+                        f.write(f"/* SoA type: {original} */\n")
+                        f.write(f"typedef {original} {alias};\n\n")
+                
+                for original, alias, _ in self.segmented:
+                    if alias not in aliases:
+                        aliases.add(alias)
+                        f.write(f"/* Segmented type: {original} */\n")
+                        f.write(f"typedef {original} {alias};\n\n")
+                
+                arithmetic = [alias for _, alias in self.types
+                              if 'ARITHMETIC' in self.traits.get(alias, [])]
+                f.write("/* Source types of vector_convert_from_S_T() */\n")
+                f.write("#define VECTOR_ARITHMETIC_TYPES(_X)")
+                for alias in arithmetic:
+                    f.write(f" \\\n\t_X({alias})")
+                f.write("\n\n")
+                
                 f.write("#endif // __VECTOR_ALIASES_H__\n")
             
         except Exception as e:
@@ -283,7 +588,7 @@ class VectorGenerator:
     
     def generate_decl_h(self, output_file: Path):
         """Generate vector_decl.h"""
-        print("\t[2/4] vector_decl.h")
+        print("\t[2/6] vector_decl.h")
         
         try:
             with open(output_file, 'w', encoding='utf-8') as f:
@@ -326,9 +631,17 @@ class VectorGenerator:
             
                 for original, alias in self.types:
                     f.write(f"/* Type: {original} -> {alias} */\n")
-                    f.write(f"#define T {alias}\n")
+                    self.write_type_defines(f, alias)
                     f.write(f'#include "vector_template.h"\n')
-                    f.write(f"#undef T\n\n")
+                    self.write_type_undefs(f, alias)
+                
+                for original, alias, fields in self.soa:
+                    f.write(f"/* SoA type: {original} -> {alias} */\n")
+                    self.write_soa(f, alias, fields, 'vector_template.h')
+                
+                for original, alias, traits in self.segmented:
+                    f.write(f"/* Segmented type: {original} -> {alias} */\n")
+                    self.write_segmented(f, alias, traits, 'vector_template.h')
                 
                 f.write("""#ifdef _OLD_T
 #define T _OLD_T
@@ -344,7 +657,7 @@ class VectorGenerator:
     
     def generate_impl_c(self, output_file: Path):
         """Generate vector_impl.c"""
-        print("\t[3/4] vector_impl.c")
+        print("\t[3/6] vector_impl.c")
         
         try: 
             with open(output_file, 'w', encoding='utf-8') as f:
@@ -384,14 +697,92 @@ class VectorGenerator:
             
                 for original, alias in self.types:
                     f.write(f"/* Type: {original} -> {alias} */\n")
-                    f.write(f"#define T {alias}\n")
+                    self.write_type_defines(f, alias)
                     f.write(f'#include "vector_template.c"\n')
-                    f.write(f"#undef T\n\n")
+                    self.write_type_undefs(f, alias)
+                
+                for original, alias, fields in self.soa:
+                    f.write(f"/* SoA type: {original} -> {alias} */\n")
+                    self.write_soa(f, alias, fields, 'vector_template.c')
+                
+                for original, alias, traits in self.segmented:
+                    f.write(f"/* Segmented type: {original} -> {alias} */\n")
+                    self.write_segmented(f, alias, traits, 'vector_template.c')
                 
                 f.write("""#ifdef _OLD_T
 #define T _OLD_T
 #undef _OLD_T
 #endif
+""")
+
+        except Exception as e:
+            print(f"\t\tError writing {output_file.name}: {e}")
+            raise
+    
+    def generate_inline_h(self, output_file: Path):
+        """Generate vector_inline.h"""
+        print("\t[4/6] vector_inline.h")
+        
+        try: 
+            with open(output_file, 'w', encoding='utf-8') as f:
+                f.write(f"""/**
+ * @file        vector_inline.h
+ * @brief       Header-only vector implementations
+ *              This file contains the implementations of all vector operations
+ *              for each type defined in the system as static inline functions.
+ * @author      Generated by vector_gen.py
+ *
+ * @date        {datetime.now().strftime("%Y-%m-%d %H:%M:%S")}
+ * @version     {VERSION}
+ *
+ * @details     Included from vector.h when VECTOR_HEADER_ONLY is defined,
+ *              so calls into the {len(self.types)} vector types can be inlined and
+ *              vectorized without LTO. vector_impl.c is not compiled then.
+ *
+ * @note        This file is automatically generated
+ * @warning     DO NOT EDIT THIS FILE MANUALLY.
+ *              Any manual changes will be lost on regeneration.
+ *
+ * @see         vector_template.c
+ * @see         vector_impl.c
+ */
+
+#ifndef __VECTOR_INLINE_H__
+#define __VECTOR_INLINE_H__
+
+#ifdef VECTOR_HEADER_ONLY
+
+#include "vector_decl.h"
+
+#ifdef T
+#define _OLD_T T
+#undef T
+#endif
+
+""")
+            
+                for original, alias in self.types:
+                    f.write(f"/* Type: {original} -> {alias} */\n")
+                    self.write_type_defines(f, alias)
+                    f.write(f'#include "vector_template.c"\n')
+                    self.write_type_undefs(f, alias)
+                
+                for original, alias, fields in self.soa:
+                    f.write(f"/* SoA type: {original} -> {alias} */\n")
+                    self.write_soa(f, alias, fields, 'vector_template.c')
+                
+                for original, alias, traits in self.segmented:
+                    f.write(f"/* Segmented type: {original} -> {alias} */\n")
+                    self.write_segmented(f, alias, traits, 'vector_template.c')
+                
+                f.write("""#ifdef _OLD_T
+#define T _OLD_T
+#undef _OLD_T
+#endif
+
+#endif // VECTOR_HEADER_ONLY
+
+#endif // __VECTOR_INLINE_H__
 """)
 
         except Exception as e:
@@ -400,7 +791,7 @@ class VectorGenerator:
     
     def generate_documentation(self, output_file: Path):
         """Generate vector_types.txt documentation"""
-        print("\t[4/4] vector_types.txt")
+        print("\t[5/6] vector_types.txt")
         
         try:
             with open(output_file, 'w', encoding='utf-8') as f:
@@ -409,21 +800,97 @@ class VectorGenerator:
 \tVECTOR TYPES
 {'='*20}
 
-Total types: {len(self.types)}
+Total types: {len(self.types) + len(self.soa) + len(self.segmented)}
 
 """)
             
-                max_original = max(len(t[0]) for t in self.types)
-                max_alias = max(len(t[1]) for t in self.types)
+                entries = self.types + self.soa + self.segmented
+                max_original = max(len(t[0]) for t in entries)
+                max_alias = max(len(t[1]) for t in entries)
                 
                 header_original = "Original type".ljust(max_original + 2)
                 header_alias = "Alias".ljust(max_alias)
-                f.write(f"{header_original} | {header_alias}\n")
+                f.write(f"{header_original} | {header_alias} | Traits\n")
+                
+                f.write(f"{'-' * (max_original + 2)}-+-{'-' * max_alias}-+-{'-' * 6}\n")
+                
+                for original, alias in self.types:
+                    traits = ' | '.join(self.traits.get(alias, [])) or 'NONE'
+                    if alias in self.bits:
+                        traits += ' (bit-packed)'
+                    f.write(f"{original.ljust(max_original + 2)} | {alias.ljust(max_alias)} | {traits}\n")
                 
-                f.write(f"{'-' * (max_original + 2)}-+-{'-' * max_alias}\n")
+                for original, alias, fields in self.soa:
+                    columns = ', '.join(f'{t} {n}' for t, n in fields)
+                    f.write(f"{original.ljust(max_original + 2)} | {alias.ljust(max_alias)} | SoA: {columns}\n")
+                
+                for original, alias, traits in self.segmented:
+                    traits = ' | '.join(traits) or 'NONE'
+                    f.write(f"{original.ljust(max_original + 2)} | {alias.ljust(max_alias)} | {traits} (segmented)\n")
+            
+        except Exception as e:
+            print(f"\t\tError writing {output_file.name}: {e}")
+            raise
+    
+    def generate_pools_report(self, output_file: Path):
+        """Generate vector_pools.txt, the static footprint of every type"""
+        print("\t[6/6] vector_pools.txt")
+        
+        try:
+            with open(output_file, 'w', encoding='utf-8') as f:
+                f.write(f"""
+{'='*20}
+\tSTATIC POOLS
+{'='*20}
+
+Used with VECTOR_NO_DYNAMIC_ALLOC. Per type: vectors, arena elements per
+vector, section of the arena, alignment of every vector buffer, and the
+arena size. Pools sized by the global options and types whose size depends
+on the target are given symbolically; the exact footprint including slots,
+free lists and alignment padding is vector_static_footprint_T() at run time.
+
+""")
                 
+                rows = [('Alias', 'Vectors', 'Elements', 'Section', 'Align', 'Arena')]
+                total = 0
+                # Arenas sized by the global options, per element count expression
+                terms: Dict[str, Tuple[int, List[str]]] = {}
+                # Every type of self.types has a pool, bool_t included
                 for original, alias in self.types:
-                    f.write(f"{original.ljust(max_original + 2)} | {alias}\n")
+                    pool = self.pools.get(alias, {})
+                    n_vectors = pool.get('n_vectors', 'VECTOR_MAX_N_VECTORS')
+                    buffer_size = pool.get('buffer_size', 'VECTOR_STATIC_BUFFER_SIZE')
+                    size = self.element_size(original)
+                    if 'n_vectors' in pool and 'buffer_size' in pool:
+                        elements = str(int(n_vectors) * int(buffer_size))
+                    else:
+                        elements = f"{n_vectors} x {buffer_size}"
+                    if elements.isdigit() and size is not None:
+                        arena = f"{int(elements) * size} B"
+                        total += int(elements) * size
+                    else:
+                        unit = f"{size} B" if size is not None else f"sizeof({original})"
+                        arena = f"{elements} x {unit}"
+                        known, symbolic = terms.get(elements, (0, []))
+                        if size is not None:
+                            terms[elements] = (known + size, symbolic)
+                        else:
+                            terms[elements] = (known, symbolic + [unit])
+                    rows.append((alias, n_vectors, buffer_size, pool.get('section', '-'),
+                                 pool.get('align', '-'), arena))
+                
+                widths = [max(len(str(row[i])) for row in rows) for i in range(len(rows[0]))]
+                for i, row in enumerate(rows):
+                    f.write(' | '.join(str(cell).ljust(width) for cell, width in zip(row, widths)).rstrip() + '\n')
+                    if i == 0:
+                        f.write('-+-'.join('-' * width for width in widths) + '\n')
+                
+                parts = [f"{total} B"] if total or not terms else []
+                for elements, (known, symbolic) in terms.items():
+                    units = ([f"{known} B"] if known else []) + symbolic
+                    per_element = units[0] if len(units) == 1 else f"({' + '.join(units)})"
+                    parts.append(f"{elements} x {per_element}")
+                f.write(f"\nTotal arenas: {' + '.join(parts)}\n")
             
         except Exception as e:
             print(f"\t\tError writing {output_file.name}: {e}")
@@ -443,7 +910,21 @@ Total types: {len(self.types)}
                     f.write(f"  Alias: {alias}\n")
                     f.write(f"  Pointers: {parsed['pointers']}\n")
                     f.write(f"  Qualifiers: {parsed['qualifiers']}\n")
-                    f.write(f"  Type name: {parsed['type_name']}\n\n")
+                    f.write(f"  Type name: {parsed['type_name']}\n")
+                    f.write(f"  Traits: {self.traits_expr(alias)}\n")
+                    f.write(f"  Hooks: {self.hooks.get(alias, {})}\n")
+                    f.write(f"  Bit-packed: {alias in self.bits}\n")
+                    f.write(f"  Pool: {self.pools.get(alias, {})}\n\n")
+                
+                for original, alias, fields in self.soa:
+                    f.write(f"SoA: {original}\n")
+                    f.write(f"  Alias: {alias}\n")
+                    f.write(f"  Fields: {fields}\n\n")
+                
+                for original, alias, traits in self.segmented:
+                    f.write(f"Segmented: {original}\n")
+                    f.write(f"  Alias: {alias}\n")
+                    f.write(f"  Traits: {traits}\n\n")
 
         except Exception as e:
             print(f"\t\tError writing {output_file.name}: {e}")
@@ -459,8 +940,10 @@ Total types: {len(self.types)}
         print(f"Output files:")
         print(f"\tDeclaration          :: {self.gen_dir / 'vector_decl.h'}")
         print(f"\tImplementation       :: {self.gen_dir / 'vector_impl.c'}")
+        print(f"\tHeader-only          :: {self.gen_dir / 'vector_inline.h'}")
         print(f"\tAliases              :: {self.gen_dir / 'vector_aliases.h'}")
         print(f"\tDocumentation        :: {self.doc_dir / 'vector_types.txt'}")
+        print(f"\tStatic pools         :: {self.doc_dir / 'vector_pools.txt'}")
         print(f"\tDebug                :: {self.log_dir / 'vector_gen.txt'}\n")
         
         if not self.extract_types():
@@ -473,7 +956,9 @@ Total types: {len(self.types)}
         self.generate_aliases_h(self.gen_dir / 'vector_aliases.h')
         self.generate_decl_h(self.gen_dir / 'vector_decl.h')
         self.generate_impl_c(self.gen_dir / 'vector_impl.c')
+        self.generate_inline_h(self.gen_dir / 'vector_inline.h')
         self.generate_documentation(self.doc_dir / 'vector_types.txt')
+        self.generate_pools_report(self.doc_dir / 'vector_pools.txt')
         self.generate_debug(self.log_dir / 'vector_gen.txt')
         
         self.print_footer()
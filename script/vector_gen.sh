@@ -217,6 +217,7 @@ echo
 H_FILE="$SRC_DIR/vector.h"
 DECL_H_FILE="$GEN_DIR/vector_decl.h"
 IMPL_C_FILE="$GEN_DIR/vector_impl.c"
+INLINE_H_FILE="$GEN_DIR/vector_inline.h"
 ALIASES_H_FILE="$GEN_DIR/vector_aliases.h"
 TYPES_TXT_FILE="$DOC_DIR/vector_types.txt"
 DEBUG_TXT_FILE="$LOG_DIR/vector_gen.txt"
@@ -235,6 +236,7 @@ echo -e "${BOLD}Files:${RESET}"
 echo -e "${TAB}Input:  $H_FILE"
 echo -e "${TAB}Output: $DECL_H_FILE"
 echo -e "${TAB}        $IMPL_C_FILE"
+echo -e "${TAB}        $INLINE_H_FILE"
 echo -e "${TAB}        $ALIASES_H_FILE"
 echo -e "${TAB}        $TYPES_TXT_FILE"
 echo -e "${TAB}        $DEBUG_TXT_FILE"
@@ -251,6 +253,7 @@ while IFS= read -r line; do
     # Find VECTOR_INITIALIZE_* macros
     if [[ "$line" =~ VECTOR_INITIALIZE_[A-Z_]*\(([^)]*)\) ]]; then
         raw_type="${BASH_REMATCH[1]}"
+        raw_type="${raw_type%%,*}"  # Drop VECTOR_INITIALIZE_TYPE_EX traits
         raw_type="$(echo "$raw_type" | xargs)"  # Trim
         
         # Check for duplicates
@@ -315,7 +318,7 @@ echo
 echo -e "${BOLD}[3/4] Generating files...${RESET}"
 
 # 3.1 Generate vector_aliases.h
-echo -e "${TAB}[1/4] vector_aliases.h"
+echo -e "${TAB}[1/5] vector_aliases.h"
 
 {
     cat << EOF
@@ -356,7 +359,7 @@ EOF
 } > "$ALIASES_H_FILE"
 
 # 3.2 Generate vector_decl.h
-echo -e "${TAB}[2/4] vector_decl.h"
+echo -e "${TAB}[2/5] vector_decl.h"
 
 {
     cat << EOF
@@ -416,7 +419,7 @@ EOF
 } > "$DECL_H_FILE"
 
 # 3.3 Generate vector_impl.c
-echo -e "${TAB}[3/4] vector_impl.c"
+echo -e "${TAB}[3/5] vector_impl.c"
 
 {
     cat << EOF
@@ -468,8 +471,67 @@ EOF
     echo "#endif"
 } > "$IMPL_C_FILE"
 
-# 3.4 Generate documentation
-echo -e "${TAB}[4/4] vector_types.txt"
+# 3.4 Generate vector_inline.h
+echo -e "${TAB}[4/5] vector_inline.h"
+
+{
+    cat << EOF
+/**
+ * @file        vector_inline.h
+ * @brief       Header-only vector implementations
+ *              This file contains the implementations of all vector operations
+ *              for each type defined in the system as static inline functions.
+ * @author      Generated by vector_gen.sh
+ *
+ * @date        $(date '+%Y-%m-%d %H:%M:%S')
+ * @version     $VERSION
+ *
+ * @details     Included from vector.h when VECTOR_HEADER_ONLY is defined,
+ *              so calls into the $PAIR_COUNT vector types can be inlined and
+ *              vectorized without LTO. vector_impl.c is not compiled then.
+ *
+ * @note        This file is automatically generated
+ * @warning     DO NOT EDIT THIS FILE MANUALLY.
+ *              Any manual changes will be lost on regeneration.
+ *
+ * @see         vector_template.c
+ * @see         vector_impl.c
+ */
+
+#ifndef __VECTOR_INLINE_H__
+#define __VECTOR_INLINE_H__
+
+#ifdef VECTOR_HEADER_ONLY
+
+#include "vector_decl.h"
+
+#ifdef T
+#define _OLD_T T
+#undef T
+#endif
+
+EOF
+
+    while IFS='|' read -r original alias; do
+        echo "/* Type: $original -> $alias */"
+        echo "#define T $alias"
+        echo "#include \"vector_template.c\""
+        echo "#undef T"
+        echo
+    done < "$PAIRS_TEMP_FILE"
+
+    echo "#ifdef _OLD_T"
+    echo "#define T _OLD_T"
+    echo "#undef _OLD_T"
+    echo "#endif"
+    echo
+    echo "#endif // VECTOR_HEADER_ONLY"
+    echo
+    echo "#endif // __VECTOR_INLINE_H__"
+} > "$INLINE_H_FILE"
+
+# 3.5 Generate documentation
+echo -e "${TAB}[5/5] vector_types.txt"
 
 {
     cat << EOF
@@ -503,7 +565,7 @@ EOF
     done < "$PAIRS_TEMP_FILE"
 } > "$TYPES_TXT_FILE"
 
-# 3.5 Generate debug info
+# 3.6 Generate debug info
 {
     echo "Vector Generator Debug Log"
     echo "Generated: $(date '+%Y-%m-%d %H:%M:%S')"
@@ -3,7 +3,7 @@
  * @brief       Intermediate typedefs for vector types
  * @author      Generated by vector_gen.py
  *
- * @date        2026-02-23 20:15:56
+ * @date        2026-10-18 12:28:03
  * @version     1.0.1
  *
  * @details     This file provides typedefs that map original C types
@@ -23,10 +23,22 @@
 #ifndef __VECTOR_ALIASES_H__
 #define __VECTOR_ALIASES_H__
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
 /* Type: int */
 typedef int int_t;
 
 /* Type: char */
 typedef char char_t;
 
+/* Type: bool */
+typedef bool bool_t;
+
+/* Source types of vector_convert_from_S_T() */
+#define VECTOR_ARITHMETIC_TYPES(_X) \
+	_X(int_t) \
+	_X(char_t)
+
 #endif // __VECTOR_ALIASES_H__
@@ -5,10 +5,10 @@
  *              for each type defined in the system.
  * @author      Generated by vector_gen.py
  *
- * @date        2026-02-23 20:15:56
+ * @date        2026-10-18 12:28:03
  * @version     1.0.1
  *
- * @details     Implementations for 2 vector types:
+ * @details     Implementations for 3 vector types:
  *              - Memory management (create/destroy)
  *              - Element access (at, front, back)
  *              - Modifiers (push, pop, insert, erase)
@@ -32,12 +32,34 @@
 
 /* Type: int -> int_t */
 #define T int_t
+#define VECTOR_TRAITS (VECTOR_TRAIT_TRIVIAL | VECTOR_TRAIT_BITWISE_EQ | VECTOR_TRAIT_ORDERED | VECTOR_TRAIT_ZERO_IS_DEFAULT | VECTOR_TRAIT_RADIX | VECTOR_TRAIT_ARITHMETIC)
 #include "vector_template.c"
+#undef VECTOR_TRAITS
 #undef T
 
 /* Type: char -> char_t */
 #define T char_t
+#define VECTOR_TRAITS (VECTOR_TRAIT_TRIVIAL | VECTOR_TRAIT_BITWISE_EQ | VECTOR_TRAIT_ORDERED | VECTOR_TRAIT_ZERO_IS_DEFAULT | VECTOR_TRAIT_RADIX | VECTOR_TRAIT_ARITHMETIC)
 #include "vector_template.c"
+#undef VECTOR_TRAITS
+#undef T
+
+/* Type: bool -> bool_t */
+#define T bool_t
+#define VECTOR_TRAITS (VECTOR_TRAIT_TRIVIAL | VECTOR_TRAIT_BITWISE_EQ | VECTOR_TRAIT_ORDERED | VECTOR_TRAIT_ZERO_IS_DEFAULT | VECTOR_TRAIT_RADIX)
+#define VECTOR_BIT_PACKED
+#include "vector_template.c"
+#undef VECTOR_BIT_PACKED
+#undef VECTOR_TRAITS
+#undef T
+
+/* Segmented type: int -> int_t */
+#define T int_t
+#define VECTOR_TRAITS (VECTOR_TRAIT_TRIVIAL | VECTOR_TRAIT_BITWISE_EQ | VECTOR_TRAIT_ORDERED | VECTOR_TRAIT_ZERO_IS_DEFAULT | VECTOR_TRAIT_RADIX | VECTOR_TRAIT_ARITHMETIC)
+#define VECTOR_SEGMENTED
+#include "vector_template.c"
+#undef VECTOR_SEGMENTED
+#undef VECTOR_TRAITS
 #undef T
 
 #ifdef _OLD_T
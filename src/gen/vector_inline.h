@@ -0,0 +1,74 @@
+/**
+ * @file        vector_inline.h
+ * @brief       Header-only vector implementations
+ *              This file contains the implementations of all vector operations
+ *              for each type defined in the system as static inline functions.
+ * @author      Generated by vector_gen.py
+ *
+ * @date        2026-10-18 12:28:03
+ * @version     1.0.1
+ *
+ * @details     Included from vector.h when VECTOR_HEADER_ONLY is defined,
+ *              so calls into the 3 vector types can be inlined and
+ *              vectorized without LTO. vector_impl.c is not compiled then.
+ *
+ * @note        This file is automatically generated
+ * @warning     DO NOT EDIT THIS FILE MANUALLY.
+ *              Any manual changes will be lost on regeneration.
+ *
+ * @see         vector_template.c
+ * @see         vector_impl.c
+ */
+
+#ifndef __VECTOR_INLINE_H__
+#define __VECTOR_INLINE_H__
+
+#ifdef VECTOR_HEADER_ONLY
+
+#include "vector_decl.h"
+
+#ifdef T
+#define _OLD_T T
+#undef T
+#endif
+
+/* Type: int -> int_t */
+#define T int_t
+#define VECTOR_TRAITS (VECTOR_TRAIT_TRIVIAL | VECTOR_TRAIT_BITWISE_EQ | VECTOR_TRAIT_ORDERED | VECTOR_TRAIT_ZERO_IS_DEFAULT | VECTOR_TRAIT_RADIX | VECTOR_TRAIT_ARITHMETIC)
+#include "vector_template.c"
+#undef VECTOR_TRAITS
+#undef T
+
+/* Type: char -> char_t */
+#define T char_t
+#define VECTOR_TRAITS (VECTOR_TRAIT_TRIVIAL | VECTOR_TRAIT_BITWISE_EQ | VECTOR_TRAIT_ORDERED | VECTOR_TRAIT_ZERO_IS_DEFAULT | VECTOR_TRAIT_RADIX | VECTOR_TRAIT_ARITHMETIC)
+#include "vector_template.c"
+#undef VECTOR_TRAITS
+#undef T
+
+/* Type: bool -> bool_t */
+#define T bool_t
+#define VECTOR_TRAITS (VECTOR_TRAIT_TRIVIAL | VECTOR_TRAIT_BITWISE_EQ | VECTOR_TRAIT_ORDERED | VECTOR_TRAIT_ZERO_IS_DEFAULT | VECTOR_TRAIT_RADIX)
+#define VECTOR_BIT_PACKED
+#include "vector_template.c"
+#undef VECTOR_BIT_PACKED
+#undef VECTOR_TRAITS
+#undef T
+
+/* Segmented type: int -> int_t */
+#define T int_t
+#define VECTOR_TRAITS (VECTOR_TRAIT_TRIVIAL | VECTOR_TRAIT_BITWISE_EQ | VECTOR_TRAIT_ORDERED | VECTOR_TRAIT_ZERO_IS_DEFAULT | VECTOR_TRAIT_RADIX | VECTOR_TRAIT_ARITHMETIC)
+#define VECTOR_SEGMENTED
+#include "vector_template.c"
+#undef VECTOR_SEGMENTED
+#undef VECTOR_TRAITS
+#undef T
+
+#ifdef _OLD_T
+#define T _OLD_T
+#undef _OLD_T
+#endif
+
+#endif // VECTOR_HEADER_ONLY
+
+#endif // __VECTOR_INLINE_H__
@@ -0,0 +1,913 @@
+/**
+ * @file      bit_vector_template.c
+ * @brief     Template implementation of bit-packed boolean vectors
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Elements are packed into 64-bit words, bit i lives in word i / 64
+ *            at position i % 64. Searches skip uniform words with
+ *            vector_simd_find_word() and locate the bit with ctz/clz, count()
+ *            uses popcnt, the bulk operations run on two words per SSE2
+ *            instruction.
+ *
+ *            Invariant: bits at positions >= size are 0 in every allocated
+ *            word. Every function that shrinks the vector or writes whole
+ *            words clears them again.
+ *
+ * @note      This file should not be included directly.
+ *            Use the generated vector_impl.c instead.
+ *
+ * @see       bit_vector_template.h
+ */
+
+#ifdef T
+
+#include "template.h"
+#include "vector_simd.h"
+#include "vector_allocator.h"
+#include "vector_error.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+
+struct VECTOR_PACKED_STRUCT TEMPLATE(vector_private_t, T)
+{
+	uint64_t *__words;
+    vector_size_t __size;
+    vector_size_t __allocated_size;
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+    const vector_allocator_t *__allocator;
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+};
+
+
+#ifndef VECTOR
+#define VECTOR 				TEMPLATE(vector, T)
+#endif // VECTOR
+
+#ifndef VECTOR_FUNC
+#define VECTOR_FUNC(_name) 	TEMPLATE(vector, TEMPLATE(_name, T))
+#endif // VECTOR_FUNC
+
+#ifndef PRIVATE
+#define PRIVATE(_range)		((_range)->__private)
+#endif // PRIVATE
+
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+
+#ifndef VECTOR_MALLOC
+#define VECTOR_MALLOC(_self, _size) \
+	PRIVATE((_self))->__allocator->malloc((_size));
+#endif // VECTOR_MALLOC
+
+#ifndef VECTOR_REALLOC
+#define VECTOR_REALLOC(_self, _ptr, _size) \
+	PRIVATE((_self))->__allocator->realloc((_ptr), (_size));
+#endif // VECTOR_REALLOC
+
+#ifndef VECTOR_FREE
+#define VECTOR_FREE(_self, _ptr) \
+	PRIVATE((_self))->__allocator->free((_ptr));
+#endif // VECTOR_FREE
+
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+
+#ifndef VECTOR_MALLOC
+#define VECTOR_MALLOC(_self, _size) 		malloc((_size));
+#endif // VECTOR_MALLOC
+
+#ifndef VECTOR_REALLOC
+#define VECTOR_REALLOC(_self, _ptr, _size) 	realloc((_ptr), (_size));
+#endif // VECTOR_REALLOC
+
+#ifndef VECTOR_FREE
+#define VECTOR_FREE(_self, _ptr) 			free((_ptr));
+#endif // VECTOR_FREE
+
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+
+/*
+ * Own check macros: VECTOR_CHECK_* of the element templates outlive the
+ * first T and expect a T * data pointer. VECTOR_BIT_REQUIRE stays with
+ * VECTOR_CHECK_ON off, for allocation results and capacity limits.
+ */
+#ifndef VECTOR_BIT_REQUIRE
+#define VECTOR_BIT_REQUIRE(_cond, _err_ptr, _err, _ret) \
+    do { \
+        if (!(_cond)) { \
+            if ((_err_ptr) != NULL) \
+                *(_err_ptr) = (_err); \
+            return _ret; \
+        } \
+    } while (0);
+#endif // VECTOR_BIT_REQUIRE
+
+#ifdef VECTOR_CHECK_ON
+
+#ifndef VECTOR_BIT_CHECK
+#define VECTOR_BIT_CHECK(_cond, _err_ptr, _err, _ret) \
+    do { \
+        if (!(_cond)) { \
+            if ((_err_ptr) != NULL) \
+                *(_err_ptr) = (_err); \
+            return _ret; \
+        } \
+    } while (0);
+#endif // VECTOR_BIT_CHECK
+
+#else // VECTOR_CHECK_ON
+
+#ifndef VECTOR_BIT_CHECK
+#define VECTOR_BIT_CHECK(_cond, _err_ptr, _err, _ret) ;
+#endif // VECTOR_BIT_CHECK
+
+#endif // VECTOR_CHECK_ON
+
+#ifndef VECTOR_BIT_CHECK_INDEX
+#define VECTOR_BIT_CHECK_INDEX(_range, _indx, _err_ptr, _ret) \
+    VECTOR_BIT_CHECK( \
+        ((_indx) >= 0) && ((vector_size_t)(_indx) < PRIVATE((_range))->__size), \
+        _err_ptr, \
+        VECTOR_ERROR_INDEX, \
+        _ret \
+    )
+#endif // VECTOR_BIT_CHECK_INDEX
+
+#ifndef VECTOR_BIT_WORDS
+#define VECTOR_BIT_WORDS(_bits) 		(((size_t)(_bits) + 63) / 64)
+#endif // VECTOR_BIT_WORDS
+
+#ifndef VECTOR_BIT_WORD
+#define VECTOR_BIT_WORD(_range, _index) \
+	(PRIVATE((_range))->__words[(size_t)(_index) / 64])
+#endif // VECTOR_BIT_WORD
+
+#ifndef VECTOR_BIT_MASK
+#define VECTOR_BIT_MASK(_index) 		(1ULL << ((size_t)(_index) % 64))
+#endif // VECTOR_BIT_MASK
+
+#ifndef VECTOR_BIT_GET
+#define VECTOR_BIT_GET(_range, _index) \
+	((VECTOR_BIT_WORD((_range), (_index)) & VECTOR_BIT_MASK((_index))) != 0)
+#endif // VECTOR_BIT_GET
+
+#ifndef VECTOR_BIT_FILL
+#define VECTOR_BIT_FILL(_value) 		((_value) ? ~0ULL : 0ULL)
+#endif // VECTOR_BIT_FILL
+
+
+static VECTOR_INLINE void VECTOR_FUNC(bit_set)(
+	VECTOR *vec,
+	size_t index,
+	bool value
+)
+{
+	if (value)
+		VECTOR_BIT_WORD(vec, index) |= VECTOR_BIT_MASK(index);
+	else
+		VECTOR_BIT_WORD(vec, index) &= ~VECTOR_BIT_MASK(index);
+}
+
+/* Bits [begin, end) set to value, whole words with memset */
+static VECTOR_INLINE void VECTOR_FUNC(bit_fill)(
+	VECTOR *vec,
+	size_t begin,
+	size_t end,
+	bool value
+)
+{
+	uint64_t *words = PRIVATE(vec)->__words;
+
+	while (begin < end && (begin % 64) != 0)
+		VECTOR_FUNC(bit_set)(vec, begin++, value);
+
+	if (begin < end)
+	{
+		const size_t whole = (end - begin) / 64;
+
+		memset(words + begin / 64, value ? 0xFF : 0x00, whole * sizeof(uint64_t));
+		begin += whole * 64;
+	}
+
+	while (begin < end)
+		VECTOR_FUNC(bit_set)(vec, begin++, value);
+}
+
+/* Clear the bits of the last word past size (the invariant) */
+static VECTOR_INLINE void VECTOR_FUNC(bit_trim)(VECTOR *vec)
+{
+	const vector_size_t size = PRIVATE(vec)->__size;
+
+	if ((size % 64) != 0)
+		PRIVATE(vec)->__words[size / 64] &= VECTOR_BIT_MASK(size) - 1;
+}
+
+static VECTOR_INLINE bool VECTOR_FUNC(ensure_capacity)(
+	VECTOR **self,
+	vector_size_t required,
+	vector_error_t *error
+)
+{
+    VECTOR *vec = *self;
+
+    if (required <= PRIVATE(vec)->__allocated_size)
+        return true;
+
+    size_t new_capacity = PRIVATE(vec)->__allocated_size;
+
+    if (new_capacity == 0)
+        new_capacity = 64 * VECTOR_INITIAL_CAPACITY;
+
+    while (new_capacity < required)
+        new_capacity *= VECTOR_GROWTH_FACTOR;
+
+    new_capacity = VECTOR_BIT_WORDS(new_capacity) * 64;
+
+    if (new_capacity > VECTOR_SIZE_MAX)
+    	new_capacity = ((size_t)VECTOR_SIZE_MAX / 64) * 64;
+
+    VECTOR_BIT_REQUIRE(new_capacity >= required, error, VECTOR_ERROR_CAPACITY, false)
+
+    const size_t old_words = VECTOR_BIT_WORDS(PRIVATE(vec)->__allocated_size);
+    const size_t new_words = new_capacity / 64;
+
+    uint64_t *words = (uint64_t *)VECTOR_REALLOC(
+		vec,
+    	PRIVATE(vec)->__words,
+		new_words * sizeof(uint64_t)
+    );
+
+    VECTOR_BIT_REQUIRE(words != NULL, error, VECTOR_ERROR_ALLOC, false)
+
+    memset(words + old_words, 0, (new_words - old_words) * sizeof(uint64_t));
+
+    PRIVATE(vec)->__words = words;
+    PRIVATE(vec)->__allocated_size = (vector_size_t)new_capacity;
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+
+    return true;
+}
+
+
+VECTOR_API VECTOR *VECTOR_FUNC(create_vector)(
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+	const vector_allocator_t *alloc,
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+	vector_size_t init_size,
+	T init_value,
+	vector_error_t *error
+)
+{
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+	if (alloc == NULL)
+		alloc = vector_default_allocator();
+
+	VECTOR *new_vec = (VECTOR *)alloc->malloc(sizeof(VECTOR));
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+	VECTOR *new_vec = (VECTOR *)VECTOR_MALLOC(NULL, sizeof(VECTOR));
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+	VECTOR_BIT_REQUIRE(new_vec != NULL, error, VECTOR_ERROR_ALLOC, NULL)
+
+    PRIVATE(new_vec) =
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+    	(TEMPLATE(vector_private, T) *)alloc->malloc(sizeof(TEMPLATE(vector_private, T)));
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+		(TEMPLATE(vector_private, T) *)VECTOR_MALLOC(NULL, sizeof(TEMPLATE(vector_private, T)));
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+	if (PRIVATE(new_vec) == NULL)
+	{
+		if (error != NULL)
+			*error = VECTOR_ERROR_ALLOC;
+
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+		alloc->free(new_vec);
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+		VECTOR_FREE(NULL, new_vec);
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+
+        return NULL;
+    }
+
+    PRIVATE(new_vec)->__words = NULL;
+    PRIVATE(new_vec)->__size = 0;
+    PRIVATE(new_vec)->__allocated_size = 0;
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+    PRIVATE(new_vec)->__allocator = alloc;
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+
+    if (init_size > 0)
+	{
+        if (!VECTOR_FUNC(ensure_capacity)(&new_vec, init_size, error))
+		{
+			VECTOR_FUNC(destroy_vector)(&new_vec);
+
+            return NULL;
+        }
+
+        PRIVATE(new_vec)->__size = init_size;
+        VECTOR_FUNC(bit_fill)(new_vec, 0, init_size, init_value != 0);
+        VECTOR_FUNC(bit_trim)(new_vec);
+    }
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+
+    return new_vec;
+}
+
+VECTOR_API VECTOR *VECTOR_FUNC(copy_create_vector)(
+	const VECTOR *other,
+	vector_error_t *error
+)
+{
+	VECTOR_BIT_CHECK(other != NULL, error, VECTOR_ERROR_NULL, NULL)
+
+	VECTOR *new_vec = VECTOR_FUNC(create_vector)(
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+		PRIVATE(other)->__allocator,
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+		0,
+		0,
+		error
+	);
+
+	if (new_vec == NULL)
+		return NULL;
+
+	if (!VECTOR_FUNC(ensure_capacity)(&new_vec, PRIVATE(other)->__size, error))
+	{
+		VECTOR_FUNC(destroy_vector)(&new_vec);
+
+		return NULL;
+	}
+
+	if (PRIVATE(other)->__size > 0)
+	{
+		memcpy(
+			PRIVATE(new_vec)->__words,
+			PRIVATE(other)->__words,
+			VECTOR_BIT_WORDS(PRIVATE(other)->__size) * sizeof(uint64_t)
+		);
+	}
+
+	PRIVATE(new_vec)->__size = PRIVATE(other)->__size;
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+
+	return new_vec;
+}
+
+VECTOR_API VECTOR *VECTOR_FUNC(move_create_vector)(
+	VECTOR **other,
+	vector_error_t *error
+)
+{
+	VECTOR_BIT_CHECK(other != NULL, error, VECTOR_ERROR_NULL, NULL)
+	VECTOR_BIT_CHECK(*other != NULL, error, VECTOR_ERROR_NULL, NULL)
+
+	VECTOR *new_vec = *other;
+
+	*other = NULL;
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+
+    return new_vec;
+}
+
+VECTOR_API void VECTOR_FUNC(destroy_vector)(VECTOR **self)
+{
+    if (self == NULL || *self == NULL)
+		return;
+
+    VECTOR *vec = *self;
+
+    if (PRIVATE(vec) != NULL)
+    {
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+    	const vector_allocator_t *alloc = PRIVATE(vec)->__allocator;
+
+    	if (PRIVATE(vec)->__words != NULL)
+    		alloc->free(PRIVATE(vec)->__words);
+
+    	alloc->free(PRIVATE(vec));
+    	alloc->free(vec);
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+    	if (PRIVATE(vec)->__words != NULL)
+    		VECTOR_FREE(vec, PRIVATE(vec)->__words);
+
+    	VECTOR_FREE(vec, PRIVATE(vec));
+    	VECTOR_FREE(vec, vec);
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+    }
+
+    *self = NULL;
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(assign)(
+	VECTOR **self,
+	vector_size_t count,
+	T value,
+	vector_error_t *error
+)
+{
+	VECTOR_FUNC(clear)(self);
+	VECTOR_FUNC(resize_with)(self, count, value, error);
+}
+
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(at)(
+	const VECTOR **self,
+	vector_index_t index,
+	vector_error_t *error
+)
+{
+	VECTOR_BIT_CHECK_INDEX(*self, index, error, (T)0)
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+
+    return (T)VECTOR_BIT_GET(*self, index);
+}
+
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(back)(const VECTOR **self)
+{
+    return (T)VECTOR_BIT_GET(*self, PRIVATE(*self)->__size - 1);
+}
+
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(capacity)(const VECTOR **self)
+{
+    return PRIVATE(*self)->__allocated_size;
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(clear)(VECTOR **self)
+{
+	VECTOR *vec = *self;
+
+	if (PRIVATE(vec)->__size > 0)
+		memset(PRIVATE(vec)->__words, 0, VECTOR_BIT_WORDS(PRIVATE(vec)->__size) * sizeof(uint64_t));
+
+    PRIVATE(vec)->__size = 0;
+}
+
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(count)(const VECTOR **self)
+{
+	return (vector_size_t)vector_simd_popcount(
+		PRIVATE(*self)->__words,
+		VECTOR_BIT_WORDS(PRIVATE(*self)->__size)
+	);
+}
+
+VECTOR_API VECTOR_INLINE uint64_t *VECTOR_FUNC(data)(const VECTOR **self)
+{
+    return PRIVATE(*self)->__words;
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(emplace_indx)(
+	VECTOR **self,
+	vector_index_t index,
+	T value,
+	vector_error_t *error
+)
+{
+	VECTOR_BIT_CHECK_INDEX(*self, index, error, )
+
+	VECTOR_FUNC(bit_set)(*self, (size_t)index, value != 0);
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API VECTOR_INLINE bool VECTOR_FUNC(empty)(const VECTOR **self)
+{
+    return (PRIVATE(*self)->__size == 0);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(erase_indx)(
+	VECTOR **self,
+	vector_index_t index,
+	vector_error_t *error
+)
+{
+	VECTOR_BIT_CHECK_INDEX(*self, index, error, )
+
+	VECTOR *vec = *self;
+	uint64_t *words = PRIVATE(vec)->__words;
+	const size_t first = (size_t)index / 64;
+	const size_t last = VECTOR_BIT_WORDS(PRIVATE(vec)->__size);
+	const uint64_t low = VECTOR_BIT_MASK(index) - 1;
+
+	/* Bits above index move down by one, each word takes bit 0 of the next */
+	words[first] = (words[first] & low) | ((words[first] >> 1) & ~low);
+
+	for (size_t w = first; w + 1 < last; ++w)
+	{
+		words[w] |= words[w + 1] << 63;
+		words[w + 1] >>= 1;
+	}
+
+	--PRIVATE(vec)->__size;
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+}
+
+/* First bit equal to value, VECTOR_INVALID_INDEX if none */
+static VECTOR_INLINE vector_index_t VECTOR_FUNC(bit_find)(
+	const VECTOR *vec,
+	bool value
+)
+{
+	const uint64_t *words = PRIVATE(vec)->__words;
+	const size_t count = VECTOR_BIT_WORDS(PRIVATE(vec)->__size);
+	const uint64_t skip = VECTOR_BIT_FILL(!value);
+	const size_t w = vector_simd_find_word(words, 0, count, skip);
+
+	if (w == count)
+		return VECTOR_INVALID_INDEX;
+
+	const size_t index = w * 64 + vector_ctz64(words[w] ^ skip);
+
+	/* Zero padding of the last word matches value 0 */
+	return (index < PRIVATE(vec)->__size) ? (vector_index_t)index : VECTOR_INVALID_INDEX;
+}
+
+/* Last bit equal to value, VECTOR_INVALID_INDEX if none */
+static VECTOR_INLINE vector_index_t VECTOR_FUNC(bit_rfind)(
+	const VECTOR *vec,
+	bool value
+)
+{
+	const uint64_t *words = PRIVATE(vec)->__words;
+	const vector_size_t size = PRIVATE(vec)->__size;
+	const uint64_t skip = VECTOR_BIT_FILL(!value);
+	size_t count = VECTOR_BIT_WORDS(size);
+
+	if (count == 0)
+		return VECTOR_INVALID_INDEX;
+
+	/* Partial last word: only bits below size take part */
+	if ((size % 64) != 0)
+	{
+		const uint64_t hit = (words[count - 1] ^ skip) & (VECTOR_BIT_MASK(size) - 1);
+
+		if (hit != 0)
+			return (vector_index_t)((count - 1) * 64 + 63 - vector_clz64(hit));
+
+		--count;
+	}
+
+	const size_t w = vector_simd_rfind_word(words, 0, count, skip);
+
+	if (w == count)
+		return VECTOR_INVALID_INDEX;
+
+	return (vector_index_t)(w * 64 + 63 - vector_clz64(words[w] ^ skip));
+}
+
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_not_of)(
+	const VECTOR **self,
+	T value
+)
+{
+	return VECTOR_FUNC(bit_find)(*self, value == 0);
+}
+
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_not_of)(
+	const VECTOR **self,
+	T value
+)
+{
+	return VECTOR_FUNC(bit_rfind)(*self, value == 0);
+}
+
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_of)(
+	const VECTOR **self,
+	T value
+)
+{
+	return VECTOR_FUNC(bit_find)(*self, value != 0);
+}
+
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_of)(
+	const VECTOR **self,
+	T value
+)
+{
+	return VECTOR_FUNC(bit_rfind)(*self, value != 0);
+}
+
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(front)(const VECTOR **self)
+{
+    return (T)VECTOR_BIT_GET(*self, 0);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(insert_indx)(
+	VECTOR **self,
+	vector_index_t before,
+	T value,
+	vector_error_t *error
+)
+{
+	VECTOR_BIT_CHECK(
+		(before >= 0) && ((vector_size_t)before <= PRIVATE(*self)->__size),
+		error,
+		VECTOR_ERROR_INDEX,
+	)
+
+	if (!VECTOR_FUNC(ensure_capacity)(self, PRIVATE(*self)->__size + 1, error))
+		return;
+
+	VECTOR *vec = *self;
+	uint64_t *words = PRIVATE(vec)->__words;
+	const size_t first = (size_t)before / 64;
+	const uint64_t low = VECTOR_BIT_MASK(before) - 1;
+
+	++PRIVATE(vec)->__size;
+
+	/* Bits from before on move up by one, each word passes bit 63 on */
+	for (size_t w = VECTOR_BIT_WORDS(PRIVATE(vec)->__size) - 1; w > first; --w)
+		words[w] = (words[w] << 1) | (words[w - 1] >> 63);
+
+	words[first] = (words[first] & low) | ((words[first] << 1) & ~low);
+
+	VECTOR_FUNC(bit_set)(vec, (size_t)before, value != 0);
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(pop_back)(VECTOR **self)
+{
+	VECTOR *vec = *self;
+
+	if (PRIVATE(vec)->__size > 0)
+	{
+		--PRIVATE(vec)->__size;
+
+		VECTOR_FUNC(bit_set)(vec, PRIVATE(vec)->__size, false);
+	}
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(push_back)(
+	VECTOR **self,
+	T value,
+	vector_error_t *error
+)
+{
+	if (!VECTOR_FUNC(ensure_capacity)(self, PRIVATE(*self)->__size + 1, error))
+		return;
+
+	VECTOR *vec = *self;
+
+	/* The new bit is 0 by the invariant */
+	if (value != 0)
+		VECTOR_BIT_WORD(vec, PRIVATE(vec)->__size) |= VECTOR_BIT_MASK(PRIVATE(vec)->__size);
+
+	++PRIVATE(vec)->__size;
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(reserve)(
+	VECTOR **self,
+	vector_size_t new_capacity,
+	vector_error_t *error
+)
+{
+	VECTOR_FUNC(ensure_capacity)(self, new_capacity, error);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(resize)(
+	VECTOR **self,
+	vector_size_t new_size,
+	vector_error_t *error
+)
+{
+	VECTOR_FUNC(resize_with)(self, new_size, 0, error);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(resize_with)(
+	VECTOR **self,
+	vector_size_t new_size,
+	T value,
+	vector_error_t *error
+)
+{
+	if (!VECTOR_FUNC(ensure_capacity)(self, new_size, error))
+		return;
+
+	VECTOR *vec = *self;
+	const vector_size_t old_size = PRIVATE(vec)->__size;
+
+	if (new_size > old_size)
+		VECTOR_FUNC(bit_fill)(vec, old_size, new_size, value != 0);
+	else
+		VECTOR_FUNC(bit_fill)(vec, new_size, old_size, false);
+
+	PRIVATE(vec)->__size = new_size;
+
+	VECTOR_FUNC(bit_trim)(vec);
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+/* Bit reversal of a word (swap halves, quarters, ... single bits) */
+static VECTOR_INLINE uint64_t VECTOR_FUNC(bit_reverse_word)(uint64_t word)
+{
+	word = ((word >> 1) & 0x5555555555555555ULL) | ((word & 0x5555555555555555ULL) << 1);
+	word = ((word >> 2) & 0x3333333333333333ULL) | ((word & 0x3333333333333333ULL) << 2);
+	word = ((word >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((word & 0x0F0F0F0F0F0F0F0FULL) << 4);
+	word = ((word >> 8) & 0x00FF00FF00FF00FFULL) | ((word & 0x00FF00FF00FF00FFULL) << 8);
+	word = ((word >> 16) & 0x0000FFFF0000FFFFULL) | ((word & 0x0000FFFF0000FFFFULL) << 16);
+
+	return (word >> 32) | (word << 32);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(reverse_indx)(
+	VECTOR **self,
+	vector_index_t begin_index,
+	vector_index_t end_index,
+	vector_error_t *error
+)
+{
+	VECTOR *vec = *self;
+
+	VECTOR_BIT_CHECK(
+		(begin_index >= 0) && (begin_index <= end_index)
+			&& ((vector_size_t)end_index <= PRIVATE(vec)->__size),
+		error,
+		VECTOR_ERROR_INDEX,
+	)
+
+	if (begin_index == 0 && (vector_size_t)end_index == PRIVATE(vec)->__size && end_index > 0)
+	{
+		/*
+		 * Whole vector: reverse the word order and the bits of every word,
+		 * then shift the result down by the padding of the last word.
+		 */
+		uint64_t *words = PRIVATE(vec)->__words;
+		const size_t count = VECTOR_BIT_WORDS(end_index);
+		const unsigned shift = (unsigned)(count * 64 - (size_t)end_index);
+
+		for (size_t lo = 0, hi = count - 1; lo < hi; ++lo, --hi)
+		{
+			const uint64_t temp = words[lo];
+
+			words[lo] = VECTOR_FUNC(bit_reverse_word)(words[hi]);
+			words[hi] = VECTOR_FUNC(bit_reverse_word)(temp);
+		}
+
+		if ((count % 2) != 0)
+			words[count / 2] = VECTOR_FUNC(bit_reverse_word)(words[count / 2]);
+
+		if (shift != 0)
+		{
+			for (size_t w = 0; w + 1 < count; ++w)
+				words[w] = (words[w] >> shift) | (words[w + 1] << (64 - shift));
+
+			words[count - 1] >>= shift;
+		}
+	}
+	else if (end_index > begin_index)
+	{
+		size_t lo = (size_t)begin_index;
+		size_t hi = (size_t)end_index - 1;
+
+		for (; lo < hi; ++lo, --hi)
+		{
+			const bool a = VECTOR_BIT_GET(vec, lo);
+			const bool b = VECTOR_BIT_GET(vec, hi);
+
+			if (a != b)
+			{
+				VECTOR_BIT_WORD(vec, lo) ^= VECTOR_BIT_MASK(lo);
+				VECTOR_BIT_WORD(vec, hi) ^= VECTOR_BIT_MASK(hi);
+			}
+		}
+	}
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(size)(const VECTOR **self)
+{
+    return PRIVATE(*self)->__size;
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(swap_indx)(
+	VECTOR **self,
+	vector_index_t index_a,
+	vector_index_t index_b,
+	vector_error_t *error
+)
+{
+	VECTOR_BIT_CHECK_INDEX(*self, index_a, error, )
+	VECTOR_BIT_CHECK_INDEX(*self, index_b, error, )
+
+	VECTOR *vec = *self;
+
+	if (VECTOR_BIT_GET(vec, index_a) != VECTOR_BIT_GET(vec, index_b))
+	{
+		VECTOR_BIT_WORD(vec, index_a) ^= VECTOR_BIT_MASK(index_a);
+		VECTOR_BIT_WORD(vec, index_b) ^= VECTOR_BIT_MASK(index_b);
+	}
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+/*
+ * Bulk operations: both vectors keep their padding bits at 0, so the
+ * last word needs no masking for any of the four operations.
+ */
+#ifndef VECTOR_BIT_BULK
+#define VECTOR_BIT_BULK(_self, _range, _error, _op) \
+	do { \
+		VECTOR_BIT_CHECK((_range) != NULL, (_error), VECTOR_ERROR_NULL, ) \
+		VECTOR_BIT_CHECK( \
+			PRIVATE(*(_self))->__size == PRIVATE((_range))->__size, \
+			(_error), \
+			VECTOR_ERROR_INDEX, \
+		) \
+		\
+		const vector_size_t _size = \
+			(PRIVATE(*(_self))->__size < PRIVATE((_range))->__size) \
+				? PRIVATE(*(_self))->__size \
+				: PRIVATE((_range))->__size; \
+		\
+		_op( \
+			PRIVATE(*(_self))->__words, \
+			PRIVATE((_range))->__words, \
+			VECTOR_BIT_WORDS(_size) \
+		); \
+		\
+		if ((_error) != NULL) \
+			*(_error) = VECTOR_ERROR_SUCCESS; \
+	} while (0)
+#endif // VECTOR_BIT_BULK
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(and_range)(
+	VECTOR **self,
+	const VECTOR *range,
+	vector_error_t *error
+)
+{
+	VECTOR_BIT_BULK(self, range, error, vector_simd_and_words);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(or_range)(
+	VECTOR **self,
+	const VECTOR *range,
+	vector_error_t *error
+)
+{
+	VECTOR_BIT_BULK(self, range, error, vector_simd_or_words);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(xor_range)(
+	VECTOR **self,
+	const VECTOR *range,
+	vector_error_t *error
+)
+{
+	VECTOR_BIT_BULK(self, range, error, vector_simd_xor_words);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(andnot_range)(
+	VECTOR **self,
+	const VECTOR *range,
+	vector_error_t *error
+)
+{
+	VECTOR_BIT_BULK(self, range, error, vector_simd_andnot_words);
+}
+
+
+#undef VECTOR
+#undef VECTOR_FUNC
+#undef PRIVATE
+#undef VECTOR_MALLOC
+#undef VECTOR_REALLOC
+#undef VECTOR_FREE
+#undef VECTOR_BIT_REQUIRE
+#undef VECTOR_BIT_CHECK
+#undef VECTOR_BIT_CHECK_INDEX
+#undef VECTOR_BIT_WORDS
+#undef VECTOR_BIT_WORD
+#undef VECTOR_BIT_MASK
+#undef VECTOR_BIT_GET
+#undef VECTOR_BIT_FILL
+#undef VECTOR_BIT_BULK
+
+
+#endif // T
@@ -0,0 +1,210 @@
+/**
+ * @file      bit_vector_template.h
+ * @brief     Template declarations for bit-packed boolean vectors
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Types initialized with VECTOR_INITIALIZE_TYPE_BITS() are stored
+ *            as 64 bits per word instead of one T per element. The method
+ *            set follows the dynamic vector (push_back, at, emplace_indx,
+ *            find_*_of, reverse_indx, resize_with, ...) with indices in bits;
+ *            there are no iterators, data() returns the words.
+ *
+ *            Element values are normalized to 0/1 (value != 0). Bits past
+ *            size() in the last word are always 0, so data() can be used for
+ *            whole-word reads.
+ *
+ *            Bulk and_range/or_range/xor_range/andnot_range combine two bit
+ *            vectors of the same size word by word.
+ *
+ * @note      Functions are free functions in both LITE and non-LITE builds.
+ *            Only dynamic vectors are packed: with VECTOR_NO_DYNAMIC_ALLOC
+ *            the type is generated as an ordinary static vector.
+ *
+ * @see       bit_vector_template.c
+ * @see       vector_simd.h
+ */
+
+#ifdef T
+
+#include "template.h"
+#include "vector_allocator.h"
+#include "vector_error.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+#ifndef VECTOR_T
+#define VECTOR_T 				TEMPLATE(vector_t, T)
+#endif // VECTOR_T
+
+#ifndef VECTOR
+#define VECTOR 					TEMPLATE(vector, T)
+#endif // VECTOR
+
+#ifndef VECTOR_FUNC
+#define VECTOR_FUNC(_name) 		TEMPLATE(vector, TEMPLATE(_name, T))
+#endif // VECTOR_FUNC
+
+
+typedef struct TEMPLATE(vector_private_t, T) TEMPLATE(vector_private, T);
+
+typedef struct VECTOR_T VECTOR;
+struct VECTOR_PACKED_STRUCT VECTOR_T
+{
+	TEMPLATE(vector_private, T) *__private;
+};
+
+VECTOR_API VECTOR *VECTOR_FUNC(create_vector)(
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+	const vector_allocator_t *alloc,
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+	vector_size_t init_size,
+	T init_value,
+	vector_error_t *
+);
+VECTOR_API VECTOR *VECTOR_FUNC(copy_create_vector)(
+	const VECTOR *self,
+	vector_error_t *error
+);
+VECTOR_API VECTOR *VECTOR_FUNC(move_create_vector)(VECTOR **self, vector_error_t *);
+VECTOR_API void VECTOR_FUNC(destroy_vector)(VECTOR **self);
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(assign)(
+    VECTOR **self,
+    vector_size_t count,
+    T value,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(at)(
+	const VECTOR **self,
+	vector_index_t index,
+	vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(back)(const VECTOR **self);
+/**
+ * @brief  Allocated bits (a multiple of 64)
+ */
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(capacity)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(clear)(VECTOR **self);
+/**
+ * @brief  Number of set bits
+ */
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(count)(const VECTOR **self);
+/**
+ * @brief  Packed words, bit i is (data[i / 64] >> (i % 64)) & 1
+ */
+VECTOR_API VECTOR_INLINE uint64_t *VECTOR_FUNC(data)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(emplace_indx)(
+    VECTOR **self,
+    vector_index_t index,
+    T value,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE bool VECTOR_FUNC(empty)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(erase_indx)(
+    VECTOR **self,
+    vector_index_t index,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_not_of)(
+	const VECTOR **self,
+	T value
+);
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_not_of)(
+	const VECTOR **self,
+	T value
+);
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_of)(
+	const VECTOR **self,
+	T value
+);
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_of)(
+	const VECTOR **self,
+	T value
+);
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(front)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(insert_indx)(
+    VECTOR **self,
+    vector_index_t before,
+    T value,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(pop_back)(VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(push_back)(
+    VECTOR **self,
+    T value,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(reserve)(
+    VECTOR **self,
+    vector_size_t new_capacity,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(resize)(
+    VECTOR **self,
+    vector_size_t new_size,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(resize_with)(
+    VECTOR **self,
+    vector_size_t new_size,
+    T value,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(reverse_indx)(
+    VECTOR **self,
+    vector_index_t begin_index,
+    vector_index_t end_index,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(size)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(swap_indx)(
+    VECTOR **self,
+    vector_index_t index_a,
+    vector_index_t index_b,
+    vector_error_t *error
+);
+
+/**
+ * @brief  self &= range (sizes must match)
+ */
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(and_range)(
+    VECTOR **self,
+    const VECTOR *range,
+    vector_error_t *error
+);
+/**
+ * @brief  self |= range (sizes must match)
+ */
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(or_range)(
+    VECTOR **self,
+    const VECTOR *range,
+    vector_error_t *error
+);
+/**
+ * @brief  self ^= range (sizes must match)
+ */
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(xor_range)(
+    VECTOR **self,
+    const VECTOR *range,
+    vector_error_t *error
+);
+/**
+ * @brief  self &= ~range (sizes must match)
+ */
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(andnot_range)(
+    VECTOR **self,
+    const VECTOR *range,
+    vector_error_t *error
+);
+
+
+#undef VECTOR_T
+#undef VECTOR
+#undef VECTOR_FUNC
+
+
+#endif // T
@@ -19,8 +19,15 @@
 #ifdef T
 
 #include "template.h"
+#include "vector_traits.h"
 #include "vector_allocator.h"
 #include "vector_error.h"
+#ifdef VECTOR_TRACE
+#include "vector_trace.h"
+#endif // VECTOR_TRACE
+#ifdef VECTOR_COW
+#include "vector_atomic.h"
+#endif // VECTOR_COW
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -36,6 +43,15 @@ struct VECTOR_PACKED_STRUCT TEMPLATE(vector_private_t, T)
 #ifdef VECTOR_USE_CUSTOM_ALLOCATOR
     vector_allocator_t *__allocator;
 #endif // VECTOR_USE_CUSTOM_ALLOCATOR
+#ifdef VECTOR_TRACE
+    uint32_t __trace_id;
+#endif // VECTOR_TRACE
+#if VECTOR_HAS_INDEX
+    struct TEMPLATE(vector_hash_index_t, T) *__index;
+#endif // VECTOR_HAS_INDEX
+#ifdef VECTOR_COW
+    vector_atomic_count_t *__shared;
+#endif // VECTOR_COW
 };
 
 
@@ -51,6 +67,15 @@ struct VECTOR_PACKED_STRUCT TEMPLATE(vector_private_t, T)
 #define VECTOR_ITERATOR		TEMPLATE(vector_iterator, T)
 #endif // VECTOR_ITERATOR
 
+#ifndef VECTOR_SPAN
+#define VECTOR_SPAN			TEMPLATE(vector_span, T)
+#endif // VECTOR_SPAN
+
+#ifndef VECTOR_SPAN_DATA
+#define VECTOR_SPAN_DATA(_span, _index) \
+	((_span).data[(size_t)(_index) * (_span).stride])
+#endif // VECTOR_SPAN_DATA
+
 #ifndef PRIVATE
 #define PRIVATE(_range)		((_range)->__private)
 #endif // PRIVATE
@@ -145,7 +170,8 @@ typedef T * TEMPLATE(vector_iterator, T);
 #ifndef VECTOR_CHECK_ENSURE_CAPACITY
 #define VECTOR_CHECK_ENSURE_CAPACITY(_range, _size, _err_ptr, _ret) \
     VECTOR_CHECK( \
-        VECTOR_FUNC(ensure_capacity)((_range), (_size), (_err_ptr)), \
+        VECTOR_LIKELY((_size) <= PRIVATE(*(_range))->__allocated_size) \
+        || VECTOR_FUNC(ensure_capacity)((_range), (_size), (_err_ptr)), \
         _err_ptr, \
         VECTOR_ERROR_CAPACITY, \
         _ret \
@@ -180,8 +206,12 @@ typedef T * TEMPLATE(vector_iterator, T);
 #define VECTOR_CHECK_DATA(_data, _err_ptr, _ret) ;
 #endif // VECTOR_CHECK_DATA
 
+/* Growing is not a check: the buffer grows with the checks off too */
 #ifndef VECTOR_CHECK_ENSURE_CAPACITY
-#define VECTOR_CHECK_ENSURE_CAPACITY(_range, _size, _err_ptr, _ret) ;
+#define VECTOR_CHECK_ENSURE_CAPACITY(_range, _size, _err_ptr, _ret) \
+	if (VECTOR_UNLIKELY((_size) > PRIVATE(*(_range))->__allocated_size) \
+		&& !VECTOR_FUNC(ensure_capacity)((_range), (_size), (_err_ptr))) \
+		return _ret;
 #endif // VECTOR_CHECK_ENSURE_CAPACITY
 
 #ifndef VECTOR_CHECK_INPUT_RANGE
@@ -200,6 +230,39 @@ typedef T * TEMPLATE(vector_iterator, T);
 	(PRIVATE((_range))->__data)
 #endif // VECTOR_BEGIN
 
+#ifndef VECTOR_SIZE
+#define VECTOR_SIZE(_range) \
+	(PRIVATE((_range))->__size)
+#endif // VECTOR_SIZE
+
+#ifdef VECTOR_TRACE
+
+#ifndef VECTOR_TRACE_OP_ARG
+#define VECTOR_TRACE_OP_ARG(_range, _op, _index, _arg) \
+	vector_trace_record( \
+		PRIVATE((_range))->__trace_id, \
+		VECTOR_FUNC(trace_type)(), \
+		(_op), \
+		(_index), \
+		(_arg), \
+		PRIVATE((_range))->__size, \
+		PRIVATE((_range))->__allocated_size \
+	);
+#endif // VECTOR_TRACE_OP_ARG
+
+#else // VECTOR_TRACE
+
+#ifndef VECTOR_TRACE_OP_ARG
+#define VECTOR_TRACE_OP_ARG(_range, _op, _index, _arg) ;
+#endif // VECTOR_TRACE_OP_ARG
+
+#endif // VECTOR_TRACE
+
+#ifndef VECTOR_TRACE_OP
+#define VECTOR_TRACE_OP(_range, _op, _index) \
+	VECTOR_TRACE_OP_ARG(_range, _op, _index, 0)
+#endif // VECTOR_TRACE_OP
+
 
 static VECTOR_INLINE bool VECTOR_FUNC(ensure_capacity)(
     VECTOR **self,
@@ -207,6 +270,216 @@ static VECTOR_INLINE bool VECTOR_FUNC(ensure_capacity)(
     vector_error_t *error
 );
 
+/*
+ * Element fill and copy: memset for zero values of ZERO_IS_DEFAULT types
+ * and 1-byte TRIVIAL types, memmove for TRIVIAL types, assignment loops
+ * otherwise. Copies may overlap when a vector is its own range.
+ */
+static VECTOR_INLINE void VECTOR_FUNC(fill)(
+	T *dst,
+	vector_size_t count,
+	T value
+)
+{
+#if VECTOR_HAS_TRAIT(ZERO_IS_DEFAULT)
+	static const T zero;
+
+	if (memcmp(&value, &zero, sizeof(T)) == 0)
+	{
+		memset(dst, 0, count * sizeof(T));
+
+		return;
+	}
+#endif // VECTOR_HAS_TRAIT(ZERO_IS_DEFAULT)
+
+#if VECTOR_HAS_TRAIT(TRIVIAL)
+	if (sizeof(T) == 1)
+	{
+		memset(dst, *(const unsigned char *)&value, count);
+
+		return;
+	}
+#endif // VECTOR_HAS_TRAIT(TRIVIAL)
+
+	for (vector_size_t i = 0; i < count; ++i)
+		dst[i] = value;
+}
+
+static VECTOR_INLINE void VECTOR_FUNC(copy)(
+	T *dst,
+	const T *src,
+	vector_size_t count
+)
+{
+#if VECTOR_HAS_TRAIT(TRIVIAL)
+	memmove(dst, src, count * sizeof(T));
+#else // VECTOR_HAS_TRAIT(TRIVIAL)
+	if (dst <= src)
+	{
+		for (vector_size_t i = 0; i < count; ++i)
+			dst[i] = src[i];
+	}
+	else
+	{
+		for (vector_size_t i = count; i > 0; --i)
+			dst[i - 1] = src[i - 1];
+	}
+#endif // VECTOR_HAS_TRAIT(TRIVIAL)
+}
+
+#ifdef VECTOR_TRACE
+static uint16_t VECTOR_FUNC(trace_type)(void)
+{
+	static int32_t type_id = -1;
+
+	if (type_id < 0)
+		type_id = vector_trace_type(STRINGIFY(T), sizeof(T));
+
+	return (uint16_t)type_id;
+}
+#endif // VECTOR_TRACE
+
+#if VECTOR_HAS_INDEX
+
+#include "vector_index_template.c"
+
+#ifndef VECTOR_INDEX_DIRTY
+#define VECTOR_INDEX_DIRTY(_range) \
+	VECTOR_FUNC(index_dirty)((_range));
+#endif // VECTOR_INDEX_DIRTY
+
+#else // VECTOR_HAS_INDEX
+
+#ifndef VECTOR_INDEX_DIRTY
+#define VECTOR_INDEX_DIRTY(_range) ;
+#endif // VECTOR_INDEX_DIRTY
+
+#endif // VECTOR_HAS_INDEX
+
+#ifdef VECTOR_COW
+
+/*
+ * Copy-on-write: copy_create_vector() shares the buffer and counts its owners
+ * in __shared. Before the first write a sharing vector copies the elements
+ * into a buffer of the given capacity and only then drops its reference, so
+ * the last owner never writes while another one still reads.
+ */
+static bool VECTOR_FUNC(cow_detach)(
+	VECTOR *vec,
+	vector_size_t capacity,
+	vector_error_t *error
+)
+{
+	vector_atomic_count_t *shared = PRIVATE(vec)->__shared;
+
+	if (vector_atomic_load(shared) == 1)
+	{
+		VECTOR_FREE(vec, shared);
+		PRIVATE(vec)->__shared = NULL;
+
+		return true;
+	}
+
+	T *data = (T *)VECTOR_MALLOC(vec, capacity * sizeof(T))
+
+	/* Checked even with VECTOR_CHECK_ON off: the copy would go to NULL */
+	if (data == NULL)
+	{
+		if (error != NULL)
+			(*error) = VECTOR_ERROR_ALLOC;
+
+		return false;
+	}
+
+	VECTOR_FUNC(copy)(data, VECTOR_BEGIN(vec), PRIVATE(vec)->__size);
+
+	if (vector_atomic_dec(shared) == 0)
+	{
+		VECTOR_FREE(vec, VECTOR_BEGIN(vec));
+		VECTOR_FREE(vec, shared);
+	}
+
+	VECTOR_BEGIN(vec) = data;
+	PRIVATE(vec)->__allocated_size = capacity;
+	PRIVATE(vec)->__shared = NULL;
+
+	return true;
+}
+
+/* Before writing elements: own the buffer (also used by the algorithms) */
+#ifndef VECTOR_COW_DETACH
+#define VECTOR_COW_DETACH(_range, _err_ptr, _ret) \
+	if (PRIVATE((_range))->__shared != NULL \
+		&& !VECTOR_FUNC(cow_detach)((_range), PRIVATE((_range))->__allocated_size, (_err_ptr))) \
+		return _ret;
+#endif // VECTOR_COW_DETACH
+
+#else // VECTOR_COW
+
+#ifndef VECTOR_COW_DETACH
+#define VECTOR_COW_DETACH(_range, _err_ptr, _ret) ;
+#endif // VECTOR_COW_DETACH
+
+#endif // VECTOR_COW
+
+/* Free the element buffer of vec (a shared one only by its last owner) */
+static void VECTOR_FUNC(drop_buffer)(VECTOR *vec)
+{
+#ifdef VECTOR_COW
+	if (PRIVATE(vec)->__shared != NULL)
+	{
+		if (vector_atomic_dec(PRIVATE(vec)->__shared) == 0)
+		{
+			VECTOR_FREE(vec, PRIVATE(vec)->__shared);
+		}
+		else
+		{
+			VECTOR_BEGIN(vec) = NULL;
+		}
+
+		PRIVATE(vec)->__shared = NULL;
+	}
+#endif // VECTOR_COW
+
+	if (VECTOR_BEGIN(vec) != NULL)
+	{
+		VECTOR_FREE(vec, VECTOR_BEGIN(vec));
+	}
+
+	VECTOR_BEGIN(vec) = NULL;
+	PRIVATE(vec)->__size = 0;
+	PRIVATE(vec)->__allocated_size = 0;
+}
+
+/* Index of the first span element when the span points into vec, else -1 */
+static VECTOR_INLINE vector_index_t VECTOR_FUNC(span_offset)(
+	const VECTOR *vec,
+	VECTOR_SPAN span
+)
+{
+	const uintptr_t begin = (uintptr_t)VECTOR_BEGIN(vec);
+	const uintptr_t data = (uintptr_t)span.data;
+
+	if (span.size == 0 || data < begin || data >= begin + PRIVATE(vec)->__size * sizeof(T))
+		return -1;
+
+	return (vector_index_t)((data - begin) / sizeof(T));
+}
+
+/* Copy the span elements to dst, which must not overlap them */
+static VECTOR_INLINE void VECTOR_FUNC(span_copy)(T *dst, VECTOR_SPAN span)
+{
+	if (span.stride == 1)
+	{
+		VECTOR_FUNC(copy)(dst, span.data, span.size);
+
+		return;
+	}
+
+	for (vector_size_t i = 0; i < span.size; ++i)
+		dst[i] = VECTOR_SPAN_DATA(span, i);
+}
+
 
 #ifndef VECTOR_LITE
 static VECTOR_INLINE void VECTOR_FUNC(append_range)(
@@ -247,15 +520,15 @@ static VECTOR_INLINE void VECTOR_FUNC(emplace_it)(
     T value,
     vector_error_t *error
 );
-static VECTOR_INLINE void FUNC(emplace_range_indx)(
+static VECTOR_INLINE void VECTOR_FUNC(emplace_range_indx)(
 	VECTOR **self, 
 	vector_index_t index, 
 	const VECTOR *range,
     vector_error_t *error
 );
-static VECTOR_INLINE void FUNC(emplace_range_it)(
+static VECTOR_INLINE void VECTOR_FUNC(emplace_range_it)(
 	VECTOR **self, 
-	ITERATOR it, 
+	VECTOR_ITERATOR it, 
 	const VECTOR *range,
     vector_error_t *error
 );
@@ -384,7 +657,7 @@ static VECTOR_INLINE void VECTOR_FUNC(set_allocator)(
 #endif // VECTOR_LITE
 
 
-VECTOR *VECTOR_FUNC(create_vector)(
+VECTOR_API VECTOR *VECTOR_FUNC(create_vector)(
 #ifdef VECTOR_USE_CUSTOM_ALLOCATOR
 	const vector_allocator_t *alloc,
 #endif // VECTOR_USE_CUSTOM_ALLOCATOR
@@ -395,29 +668,41 @@ VECTOR *VECTOR_FUNC(create_vector)(
 {
 #ifdef VECTOR_USE_CUSTOM_ALLOCATOR
 	if (alloc == NULL)
-		alloc == vector_default_allocator();
+		alloc = vector_default_allocator();
 #endif // VECTOR_USE_CUSTOM_ALLOCATOR
 
 	VECTOR *new_vec =
 #ifdef VECTOR_USE_CUSTOM_ALLOCATOR
 		(VECTOR *)alloc->malloc(sizeof(VECTOR));
 #else // VECTOR_USE_CUSTOM_ALLOCATOR
-		(VECTOR *)VECTOR_MALLOC(sizeof(VECTOR));
+		(VECTOR *)VECTOR_MALLOC(NULL, sizeof(VECTOR));
 #endif // VECTOR_USE_CUSTOM_ALLOCATOR
-	VECTOR_CHECK_INPUT_RANGE(new_vec, error, NULL)
+
+	/* Checked even with VECTOR_CHECK_ON off: new_vec is written below */
+	if (new_vec == NULL)
+	{
+		if (error != NULL)
+			*error = VECTOR_ERROR_ALLOC;
+
+		return NULL;
+	}
 	
     PRIVATE(new_vec) =
 #ifdef VECTOR_USE_CUSTOM_ALLOCATOR
-    	(TEMPLATE(vector_private, T) *)alloc->malloc(sizeof(VECTOR));
+    	(TEMPLATE(vector_private, T) *)alloc->malloc(sizeof(TEMPLATE(vector_private, T)));
 #else // VECTOR_USE_CUSTOM_ALLOCATOR
-		(TEMPLATE(vector_private, T) *)VECTOR_MALLOC(sizeof(VECTOR));
+		(TEMPLATE(vector_private, T) *)VECTOR_MALLOC(NULL, sizeof(TEMPLATE(vector_private, T)));
 #endif // VECTOR_USE_CUSTOM_ALLOCATOR
 	if (PRIVATE(new_vec) == NULL)
 	{
 		if (error != NULL)
 			*error = VECTOR_ERROR_ALLOC;
 		
-		VECTOR_FREE(other, new_vec);
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+		alloc->free(new_vec);
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+		VECTOR_FREE(NULL, new_vec);
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
 		
         return NULL;
     }
@@ -425,22 +710,35 @@ VECTOR *VECTOR_FUNC(create_vector)(
     VECTOR_BEGIN(new_vec) = NULL;
     PRIVATE(new_vec)->__size = 0;
     PRIVATE(new_vec)->__allocated_size = 0;
+#if VECTOR_HAS_INDEX
+    PRIVATE(new_vec)->__index = NULL;
+#endif // VECTOR_HAS_INDEX
+#ifdef VECTOR_COW
+    PRIVATE(new_vec)->__shared = NULL;
+#endif // VECTOR_COW
 #ifdef VECTOR_USE_CUSTOM_ALLOCATOR
     PRIVATE(new_vec)->__allocator = alloc;
 #endif // VECTOR_USE_CUSTOM_ALLOCATOR
+#ifdef VECTOR_TRACE
+    PRIVATE(new_vec)->__trace_id = vector_trace_vector_id();
+#endif // VECTOR_TRACE
     
     if (init_size > 0) 
 	{
         if (!VECTOR_FUNC(ensure_capacity)(&new_vec, init_size, error))
 		{
-			VECTOR_FREE(other, PRIVATE(new_vec));
-			VECTOR_FREE(other, new_vec);
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+			alloc->free(PRIVATE(new_vec));
+			alloc->free(new_vec);
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+			VECTOR_FREE(NULL, PRIVATE(new_vec));
+			VECTOR_FREE(NULL, new_vec);
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
 			
             return NULL;
         }
         
-        for (vector_index_t i = 0; i < (vector_index_t)init_size; ++i)
-            VECTOR_DATA(new_vec, i) = init_value;
+        VECTOR_FUNC(fill)(VECTOR_BEGIN(new_vec), init_size, init_value);
 
         PRIVATE(new_vec)->__size = init_size;
     }
@@ -491,10 +789,12 @@ VECTOR *VECTOR_FUNC(create_vector)(
 #endif // VECTOR_USE_CUSTOM_ALLOCATOR
 #endif // VECTOR_LITE
 
+	VECTOR_TRACE_OP(new_vec, VECTOR_TRACE_OP_CREATE, 0)
+
     return new_vec;
 }
 
-VECTOR *VECTOR_FUNC(copy_create_vector)(
+VECTOR_API VECTOR *VECTOR_FUNC(copy_create_vector)(
 	const VECTOR *other,
 	vector_error_t *error
 )
@@ -502,7 +802,15 @@ VECTOR *VECTOR_FUNC(copy_create_vector)(
 	VECTOR_CHECK_INPUT_RANGE(other, error, NULL)
 
 	VECTOR *new_vec = (VECTOR *)VECTOR_MALLOC(other, sizeof(VECTOR));
-	VECTOR_CHECK_INPUT_RANGE(new_vec, error, NULL)
+
+	/* Checked even with VECTOR_CHECK_ON off: new_vec is written below */
+	if (new_vec == NULL)
+	{
+		if (error != NULL)
+			*error = VECTOR_ERROR_ALLOC;
+
+		return NULL;
+	}
 
     PRIVATE(new_vec) = (TEMPLATE(vector_private, T) *)VECTOR_MALLOC(
 		other,
@@ -518,19 +826,69 @@ VECTOR *VECTOR_FUNC(copy_create_vector)(
         return NULL;
     }
 
-	const TEMPLATE(vector_private_t, T) *private __attribute__((unused)) =
-		(TEMPLATE(vector_private_t, T) *)memcpy(
+	const TEMPLATE(vector_private, T) *private __attribute__((unused)) =
+		(TEMPLATE(vector_private, T) *)memcpy(
 			PRIVATE(new_vec),
 			PRIVATE(other),
-			sizeof(TEMPLATE(vector_private_t, T))
+			sizeof(TEMPLATE(vector_private, T))
 		);
 	VECTOR_CHECK_DATA(private, error, NULL)
 
 #ifdef VECTOR_USE_CUSTOM_ALLOCATOR
     PRIVATE(new_vec)->__allocator = PRIVATE(other)->__allocator;
 #endif // VECTOR_USE_CUSTOM_ALLOCATOR
+#ifdef VECTOR_TRACE
+    PRIVATE(new_vec)->__trace_id = vector_trace_vector_id();
+#endif // VECTOR_TRACE
+#if VECTOR_HAS_INDEX
+    PRIVATE(new_vec)->__index = NULL;
+#endif // VECTOR_HAS_INDEX
+
+#ifdef VECTOR_COW
+	/*
+	 * Share the buffer, the first write through either vector copies it.
+	 * other is const, so several threads may copy it at once: the counter is
+	 * published with a CAS and a thread that loses the race frees its own.
+	 */
+	void **slot = (void **)&PRIVATE(other)->__shared;
+	vector_atomic_count_t *shared = (vector_atomic_count_t *)vector_atomic_ptr_load(slot);
+
+	if (VECTOR_BEGIN(other) != NULL && shared == NULL)
+	{
+		shared = (vector_atomic_count_t *)VECTOR_MALLOC(other, sizeof(vector_atomic_count_t))
+		if (shared == NULL)
+		{
+			if (error != NULL)
+				*error = VECTOR_ERROR_ALLOC;
 
-    if (!VECTOR_FUNC(ensure_capacity)(&new_vec, other->size(&other), error))
+			VECTOR_FREE(other, PRIVATE(new_vec));
+			VECTOR_FREE(other, new_vec);
+
+			return NULL;
+		}
+
+		vector_atomic_init(shared, 1);
+
+		vector_atomic_count_t *const published =
+			(vector_atomic_count_t *)vector_atomic_ptr_cas(slot, NULL, shared);
+
+		if (published != NULL)
+		{
+			VECTOR_FREE(other, shared);
+			shared = published;
+		}
+	}
+
+	if (shared != NULL)
+		vector_atomic_inc(shared);
+
+	PRIVATE(new_vec)->__shared = shared;
+#else // VECTOR_COW
+	/* The memcpy above copied the buffer pointer of other */
+	VECTOR_BEGIN(new_vec) = NULL;
+	PRIVATE(new_vec)->__allocated_size = 0;
+
+    if (!VECTOR_FUNC(ensure_capacity)(&new_vec, PRIVATE(other)->__size, error))
 	{
 		VECTOR_FREE(other, PRIVATE(new_vec));
 		VECTOR_FREE(other, new_vec);
@@ -538,12 +896,12 @@ VECTOR *VECTOR_FUNC(copy_create_vector)(
         return NULL;
     }
 
-	const T *data __attribute__((unused)) = (T *)memcpy(
-		VECTOR_DATA(new_vec),
-		VECTOR_DATA(other),
-		PRIVATE(other)->__size * sizeof(T)
+	VECTOR_FUNC(copy)(
+		VECTOR_BEGIN(new_vec),
+		VECTOR_BEGIN(other),
+		PRIVATE(other)->__size
 	);
-	VECTOR_CHECK_DATA(data, error, NULL)
+#endif // VECTOR_COW
 
 #ifndef VECTOR_LITE
 	new_vec->append_range = other->append_range;
@@ -590,74 +948,29 @@ VECTOR *VECTOR_FUNC(copy_create_vector)(
 #endif // VECTOR_USE_CUSTOM_ALLOCATOR
 #endif // VECTOR_LITE
 
+#ifdef VECTOR_TRACE
+	VECTOR_TRACE_OP(new_vec, VECTOR_TRACE_OP_COPY_CREATE, PRIVATE(other)->__trace_id)
+#endif // VECTOR_TRACE
+
 	if (error != NULL)
 		(*error) = VECTOR_ERROR_SUCCESS;
 
 	return new_vec;
 }
 
-VECTOR *VECTOR_FUNC(move_create_vector)(
+VECTOR_API VECTOR *VECTOR_FUNC(move_create_vector)(
 	VECTOR **other,
 	vector_error_t *error
 )
 {
 	VECTOR_CHECK_INPUT_RANGE(other, error, NULL)
 	VECTOR_CHECK_INPUT_RANGE(*other, error, NULL)
-	
-	VECTOR *new_vec = (VECTOR *)VECTOR_MALLOC(other, sizeof(VECTOR));
-	VECTOR_CHECK_ALLOC(new_vec, error, NULL);
 
-	VECTOR *other_vec = *other;
-
-    PRIVATE(new_vec) = PRIVATE(other_vec);
-
-#ifndef VECTOR_LITE
-	new_vec->append_range = other_vec->append_range;
-	new_vec->assign = other_vec->assign;
-	new_vec->assign_range = other_vec->assign_range;
-	new_vec->at = other_vec->at;
-	new_vec->back = other_vec->back;
-	new_vec->begin = other_vec->begin;
-	new_vec->capacity = other_vec->capacity;
-	new_vec->clear = other_vec->clear;
-	new_vec->data = other_vec->data;
-	new_vec->emplace_indx = other_vec->emplace_indx;
-	new_vec->emplace_it = other_vec->emplace_it;
-	new_vec->empty = other_vec->empty;
-	new_vec->end = other_vec->end;
-	new_vec->erase_indx = other_vec->erase_indx;
-	new_vec->erase_it = other_vec->erase_it;
-	new_vec->emplace_range_indx = other->emplace_range_indx;
-	new_vec->emplace_range_it = other->emplace_range_it;
-	new_vec->find_first_not_of = other_vec->find_first_not_of;
-	new_vec->find_last_not_of = other_vec->find_last_not_of;
-	new_vec->find_first_of = other_vec->find_first_of;
-	new_vec->find_last_of = other_vec->find_last_of;
-	new_vec->front = other_vec->front;
-	new_vec->indx = other_vec->indx;
-	new_vec->insert_indx = other_vec->insert_indx;
-	new_vec->insert_it = other_vec->insert_it;
-	new_vec->insert_range_indx = other_vec->insert_range_indx;
-	new_vec->insert_range_it = other_vec->insert_range_it;
-	new_vec->it = other_vec->it;
-	new_vec->pop_back = other_vec->pop_back;
-	new_vec->push_back = other_vec->push_back;
-	new_vec->reserve = other_vec->reserve;
-	new_vec->resize = other_vec->resize;
-	new_vec->resize_with = other_vec->resize_with;
-	new_vec->reverse_indx = other_vec->reverse_indx;
-	new_vec->reverse_it = other_vec->reverse_it;
-	new_vec->size = other_vec->size;
-	new_vec->swap_indx = other_vec->swap_indx;
-	new_vec->swap_it = other_vec->swap_it;
-#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
-	new_vec->allocator = other_vec->allocator;
-	new_vec->set_allocator = other_vec->set_allocator;
-#endif // VECTOR_USE_CUSTOM_ALLOCATOR
-#endif // VECTOR_LITE	
+	/* The header and its function table move as they are */
+	VECTOR *new_vec = *other;
+	*other = NULL;
 
-	VECTOR_FREE(new_vector, other_vec);
-	other_vec = NULL;
+	VECTOR_TRACE_OP(new_vec, VECTOR_TRACE_OP_MOVE_CREATE, 0)
 
 	if (error != NULL)
 		(*error) = VECTOR_ERROR_SUCCESS;
@@ -665,7 +978,7 @@ VECTOR *VECTOR_FUNC(move_create_vector)(
     return new_vec;
 }
 
-void VECTOR_FUNC(destroy_vector)(VECTOR **self)
+VECTOR_API void VECTOR_FUNC(destroy_vector)(VECTOR **self)
 {
     if (self == NULL)
 		return;
@@ -674,17 +987,294 @@ void VECTOR_FUNC(destroy_vector)(VECTOR **self)
     if (vec == NULL)
 		return;
 	
-	VECTOR_CHECK_ALLOC(PRIVATE(vec)->__allocator, error, )
+#if defined(VECTOR_CHECK_ON) && defined(VECTOR_USE_CUSTOM_ALLOCATOR)
+	if (PRIVATE(vec)->__allocator == NULL)
+		return;
+#endif // VECTOR_CHECK_ON && VECTOR_USE_CUSTOM_ALLOCATOR
+
+	VECTOR_TRACE_OP(vec, VECTOR_TRACE_OP_DESTROY, 0)
 
-    if (PRIVATE(vec)->__data != NULL)
-    	VECTOR_FREE(vec, PRIVATE(vec)->__data);
+#if VECTOR_HAS_INDEX
+	VECTOR_FUNC(index_free)(vec);
+#endif // VECTOR_HAS_INDEX
+
+	VECTOR_FUNC(drop_buffer)(vec);
 
     if (PRIVATE(vec) != NULL)
     	VECTOR_FREE(vec, PRIVATE(vec));
 
     VECTOR_FREE(vec, vec);
 
-    vec = NULL;
+    *self = NULL;
+}
+
+VECTOR_API void VECTOR_FUNC(move_assign)(
+	VECTOR **self,
+	VECTOR **other,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK_INPUT_RANGE(self, error, )
+	VECTOR_CHECK_INPUT_RANGE(other, error, )
+
+	if (*self == *other)
+	{
+		if (error != NULL)
+			*error = VECTOR_ERROR_SUCCESS;
+
+		return;
+	}
+
+	/* other takes the old contents of self and drops them */
+	VECTOR_FUNC(swap)(self, other, error);
+
+#if VECTOR_HAS_INDEX
+	VECTOR_FUNC(index_free)(*other);
+#endif // VECTOR_HAS_INDEX
+
+	VECTOR_FUNC(drop_buffer)(*other);
+}
+
+VECTOR_API void VECTOR_FUNC(swap)(
+	VECTOR **self,
+	VECTOR **other,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK_INPUT_RANGE(self, error, )
+	VECTOR_CHECK_INPUT_RANGE(other, error, )
+
+	/* Both headers carry the same function table, only the state moves */
+	TEMPLATE(vector_private, T) *temp = PRIVATE(*self);
+	PRIVATE(*self) = PRIVATE(*other);
+	PRIVATE(*other) = temp;
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API T *VECTOR_FUNC(release)(
+	VECTOR **self,
+	vector_size_t *size,
+	vector_size_t *capacity,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK_INPUT_RANGE(self, error, NULL)
+
+	VECTOR *vec = *self;
+
+	/* A shared buffer is copied first, the caller gets sole ownership */
+	VECTOR_COW_DETACH(vec, error, NULL)
+
+	T *data = VECTOR_BEGIN(vec);
+
+	if (size != NULL)
+		*size = PRIVATE(vec)->__size;
+	if (capacity != NULL)
+		*capacity = PRIVATE(vec)->__allocated_size;
+
+	VECTOR_BEGIN(vec) = NULL;
+	PRIVATE(vec)->__size = 0;
+	PRIVATE(vec)->__allocated_size = 0;
+
+	VECTOR_INDEX_DIRTY(vec)
+	VECTOR_TRACE_OP(vec, VECTOR_TRACE_OP_CLEAR, 0)
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return data;
+}
+
+VECTOR_API void VECTOR_FUNC(adopt)(
+	VECTOR **self,
+	T *data,
+	vector_size_t size,
+	vector_size_t capacity,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK_INPUT_RANGE(self, error, )
+	VECTOR_CHECK(size <= capacity, error, VECTOR_ERROR_CAPACITY, )
+	VECTOR_CHECK(data != NULL || capacity == 0, error, VECTOR_ERROR_NULL, )
+
+	VECTOR *vec = *self;
+
+	if (data != VECTOR_BEGIN(vec))
+		VECTOR_FUNC(drop_buffer)(vec);
+
+	VECTOR_BEGIN(vec) = data;
+	PRIVATE(vec)->__size = size;
+	PRIVATE(vec)->__allocated_size = capacity;
+
+	VECTOR_INDEX_DIRTY(vec)
+	VECTOR_TRACE_OP(vec, VECTOR_TRACE_OP_ASSIGN_RANGE, size)
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API void VECTOR_FUNC(append_span)(
+	VECTOR **self,
+	VECTOR_SPAN span,
+	vector_error_t *error
+)
+{
+	VECTOR_FUNC(insert_span_indx)(
+		self,
+		(vector_index_t)PRIVATE(*self)->__size,
+		span,
+		error
+	);
+}
+
+VECTOR_API void VECTOR_FUNC(assign_span)(
+	VECTOR **self,
+	VECTOR_SPAN span,
+	vector_error_t *error
+)
+{
+	const vector_index_t offset = VECTOR_FUNC(span_offset)(*self, span);
+
+	if (offset < 0)
+	{
+		VECTOR_CHECK_ENSURE_CAPACITY(self, span.size, error, )
+	}
+
+	VECTOR *vec = *self;
+
+	VECTOR_COW_DETACH(vec, error, )
+
+	if (offset < 0)
+		VECTOR_FUNC(span_copy)(VECTOR_BEGIN(vec), span);
+	else
+	{
+		/* A part of itself moves to the front, sources are never behind */
+		for (vector_size_t i = 0; i < span.size; ++i)
+			VECTOR_DATA(vec, i) = VECTOR_DATA(vec, offset + (vector_index_t)(i * span.stride));
+	}
+
+	PRIVATE(vec)->__size = span.size;
+
+	VECTOR_INDEX_DIRTY(vec)
+	VECTOR_TRACE_OP(vec, VECTOR_TRACE_OP_ASSIGN_RANGE, span.size)
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API void VECTOR_FUNC(emplace_span_indx)(
+	VECTOR **self,
+	vector_index_t index,
+	VECTOR_SPAN span,
+	vector_error_t *error
+)
+{
+	VECTOR *vec = *self;
+
+	VECTOR_CHECK(
+		(index >= 0) && ((vector_size_t)index + span.size <= PRIVATE(vec)->__size),
+		error,
+		VECTOR_ERROR_INDEX,
+	)
+
+	const vector_index_t offset = VECTOR_FUNC(span_offset)(vec, span);
+
+	VECTOR_COW_DETACH(vec, error, )
+
+	T *dst = VECTOR_BEGIN(vec) + index;
+
+	if (offset < 0)
+		VECTOR_FUNC(span_copy)(dst, span);
+	else if (span.stride == 1)
+		VECTOR_FUNC(copy)(dst, VECTOR_BEGIN(vec) + offset, span.size);
+	else if (index <= offset)
+	{
+		for (vector_size_t i = 0; i < span.size; ++i)
+			dst[i] = VECTOR_DATA(vec, offset + (vector_index_t)(i * span.stride));
+	}
+	else
+	{
+		/* Strided source behind the destination: gather it first */
+		T *gather = (T *)VECTOR_MALLOC(vec, span.size * sizeof(T))
+		VECTOR_CHECK_ALLOC(gather, error, )
+
+		for (vector_size_t i = 0; i < span.size; ++i)
+			gather[i] = VECTOR_DATA(vec, offset + (vector_index_t)(i * span.stride));
+
+		VECTOR_FUNC(copy)(dst, gather, span.size);
+		VECTOR_FREE(vec, gather);
+	}
+
+	VECTOR_INDEX_DIRTY(vec)
+	VECTOR_TRACE_OP_ARG(vec, VECTOR_TRACE_OP_EMPLACE_RANGE, index, span.size)
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API void VECTOR_FUNC(insert_span_indx)(
+	VECTOR **self,
+	vector_index_t before,
+	VECTOR_SPAN span,
+	vector_error_t *error
+)
+{
+	const vector_size_t size = PRIVATE(*self)->__size;
+	const vector_size_t count = span.size;
+
+	VECTOR_CHECK(
+		(before >= 0) && ((vector_size_t)before <= size),
+		error,
+		VECTOR_ERROR_INDEX,
+	)
+
+	if (count == 0)
+	{
+		if (error != NULL)
+			*error = VECTOR_ERROR_SUCCESS;
+
+		return;
+	}
+
+	/* A span into this vector is found again after the buffer moves */
+	const vector_index_t offset = VECTOR_FUNC(span_offset)(*self, span);
+
+	VECTOR_CHECK_ENSURE_CAPACITY(self, size + count, error, )
+
+	VECTOR *vec = *self;
+
+	VECTOR_COW_DETACH(vec, error, )
+
+	T *dst = VECTOR_BEGIN(vec) + before;
+
+	if ((vector_size_t)before < size)
+		memmove(dst + count, dst, (size - before) * sizeof(T));
+
+	if (offset < 0)
+		VECTOR_FUNC(span_copy)(dst, span);
+	else
+	{
+		/* Elements at or after before were shifted by count */
+		for (vector_size_t i = 0; i < count; ++i)
+		{
+			vector_index_t position = offset + (vector_index_t)(i * span.stride);
+
+			if (position >= before)
+				position += (vector_index_t)count;
+
+			dst[i] = VECTOR_DATA(vec, position);
+		}
+	}
+
+	PRIVATE(vec)->__size = size + count;
+
+	VECTOR_INDEX_DIRTY(vec)
+	VECTOR_TRACE_OP_ARG(vec, VECTOR_TRACE_OP_INSERT_RANGE, before, count)
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
 }
 
 static VECTOR_INLINE bool VECTOR_FUNC(ensure_capacity)(
@@ -706,13 +1296,26 @@ static VECTOR_INLINE bool VECTOR_FUNC(ensure_capacity)(
     while (new_capacity < required)
         new_capacity *= VECTOR_GROWTH_FACTOR;
 
+#ifdef VECTOR_COW
+	/* Growing a shared buffer: copy straight into the larger one */
+	if (PRIVATE(vec)->__shared != NULL)
+		return VECTOR_FUNC(cow_detach)(vec, new_capacity, error);
+#endif // VECTOR_COW
+
     const T *new_data = (T *)VECTOR_REALLOC(
 		vec,
     	VECTOR_BEGIN(vec),
 		new_capacity * sizeof(T)
     );
 
-    VECTOR_CHECK_ALLOC(new_data, error, false)
+	/* Checked even with VECTOR_CHECK_ON off: NULL would lose the buffer */
+	if (new_data == NULL)
+	{
+		if (error != NULL)
+			(*error) = VECTOR_ERROR_ALLOC;
+
+		return false;
+	}
 
     VECTOR_BEGIN(vec) = new_data;
     PRIVATE(vec)->__allocated_size = new_capacity;
@@ -731,14 +1334,15 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(append_range)(
 {
 	VECTOR_CHECK_INPUT_RANGE(range, error, )
 	
-	VECTOR_FUNC(insert_range_indx)(
+	VECTOR_FUNC(insert_span_indx)(
 		self,
-		PRIVATE(*self)->__size,
-		range,
+		(vector_index_t)PRIVATE(*self)->__size,
+		TEMPLATE(vector_span, TEMPLATE(from, T))(VECTOR_BEGIN(range), PRIVATE(range)->__size),
 		error
 	);
 }
 
+
 VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(assign)(
 	VECTOR **self,
 	vector_size_t count,
@@ -749,9 +1353,13 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(assign)(
 	VECTOR_CHECK_ENSURE_CAPACITY(self, count, error, )
 	
 	VECTOR *vec = *self;
+
+	VECTOR_COW_DETACH(vec, error, )
 	
-	for (vector_index_t i = 0; i < (vector_index_t)count; ++i)
-		VECTOR_DATA(vec, i) = value;
+	VECTOR_FUNC(fill)(VECTOR_BEGIN(vec), count, value);
+
+	VECTOR_INDEX_DIRTY(vec)
+	VECTOR_TRACE_OP(vec, VECTOR_TRACE_OP_ASSIGN, count)
 
 	if (error != NULL)
 		(*error) = VECTOR_ERROR_SUCCESS;
@@ -763,27 +1371,25 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(assign_range)(
 	vector_error_t *error
 )
 {
-	const vector_size_t range_size = PRIVATE(range)->__size;
-	
 	VECTOR_CHECK_INPUT_RANGE(range, error, )
-	VECTOR_CHECK_ENSURE_CAPACITY(self, range_size, error, )
-	
-	VECTOR *vec = *self;
-	
-	for (vector_index_t i = 0; i < (vector_index_t)range_size; ++i)
-		VECTOR_DATA(vec, i) = VECTOR_DATA(range, i);
 
-	if (error != NULL)
-		(*error) = VECTOR_ERROR_SUCCESS;
+	VECTOR_FUNC(assign_span)(
+		self,
+		TEMPLATE(vector_span, TEMPLATE(from, T))(VECTOR_BEGIN(range), PRIVATE(range)->__size),
+		error
+	);
 }
 
+
 VECTOR_STATIC VECTOR_INLINE T VECTOR_FUNC(at)(
 	const VECTOR **self,
 	vector_index_t index,
 	vector_error_t *error
 )
 {
-	VECTOR_CHECK_INDEX(self, index, error, (T)0)
+	VECTOR_CHECK_INDEX(self, index, error, (T){0})
+
+	VECTOR_TRACE_OP(*self, VECTOR_TRACE_OP_AT, index)
 
 	if (error != NULL)
 		(*error) = VECTOR_ERROR_SUCCESS;
@@ -811,11 +1417,19 @@ VECTOR_STATIC VECTOR_INLINE vector_size_t VECTOR_FUNC(capacity)(const VECTOR **s
 VECTOR_STATIC VECTOR_INLINE  void VECTOR_FUNC(clear)(VECTOR **const self)
 {
     PRIVATE(*self)->__size = 0;
+
+	VECTOR_INDEX_DIRTY(*self)
+	VECTOR_TRACE_OP(*self, VECTOR_TRACE_OP_CLEAR, 0)
 }
 
 VECTOR_STATIC VECTOR_INLINE T *VECTOR_FUNC(data)(const VECTOR **self)
 {
-    return VECTOR_BEGIN(*self);
+	VECTOR *vec = (VECTOR *)*self;
+
+	/* The caller may write through the pointer: own a shared buffer first */
+	VECTOR_COW_DETACH(vec, NULL, NULL)
+
+    return VECTOR_BEGIN(vec);
 }
 
 VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(emplace_indx)(
@@ -826,9 +1440,16 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(emplace_indx)(
 )
 {
 	VECTOR_CHECK_INDEX((const VECTOR **)self, index, error, )
+	VECTOR_COW_DETACH(*self, error, )
+
+#if VECTOR_HAS_INDEX
+	VECTOR_FUNC(index_replace)(*self, VECTOR_DATA(*self, index), value, index);
+#endif // VECTOR_HAS_INDEX
 
     VECTOR_DATA(*self, index) = value;
 
+	VECTOR_TRACE_OP(*self, VECTOR_TRACE_OP_EMPLACE, index)
+
 	if (error != NULL)
 		(*error) = VECTOR_ERROR_SUCCESS;
 }
@@ -848,46 +1469,36 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(emplace_it)(
 	);
 }
 
-VECTOR_STATIC VECTOR_INLINE void FUNC(emplace_range_indx)(
+VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(emplace_range_indx)(
 	VECTOR **self, 
 	vector_index_t index, 
 	const VECTOR *range,
     vector_error_t *error
 )
 {
-	VECTOR_CHECK_INDEX((const VECTOR **)self, index, error, )
-	VECTOR_CHECK_INDEX(
-		(const VECTOR **)self, 
-		index + PRIVATE(range)->__size, 
-		error, 
-	)
-	
-	VECTOR *vec = *self;
-	
-	for (
-		vector_index_t i = index; 
-		i < (vector_index_t)(index + PRIVATE(range)->__size); 
-		++i
-	)
-	{
-		VECTOR_DATA(vec, i) = VECTOR_DATA(range, i);
-	}
-	
-	if (error != NULL)
-		(*error) = VECTOR_ERROR_SUCCESS;
+	VECTOR_CHECK_INPUT_RANGE(range, error, )
+
+	VECTOR_FUNC(emplace_span_indx)(
+		self,
+		index,
+		TEMPLATE(vector_span, TEMPLATE(from, T))(VECTOR_BEGIN(range), PRIVATE(range)->__size),
+		error
+	);
 }
 
-VECTOR_STATIC VECTOR_INLINE void FUNC(emplace_range_it)(
+
+VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(emplace_range_it)(
 	VECTOR **self, 
-	ITERATOR it, 
+	VECTOR_ITERATOR it, 
 	const VECTOR *range,
     vector_error_t *error
 )
 {
-	(*self)->emplace_range_indx(
+	VECTOR_FUNC(emplace_range_indx)(
 		self,
-		(*self)->index(self, it),
-		range
+		(vector_index_t)(it - VECTOR_BEGIN(*self)),
+		range,
+		error
 	);
 }
 
@@ -919,6 +1530,8 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(erase_indx)(
 		
         return;
     }
+
+	VECTOR_COW_DETACH(vec, error, )
     
     const T *data __attribute__((unused)) = (T *)memmove(
 		VECTOR_BEGIN(vec) + index,
@@ -929,6 +1542,9 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(erase_indx)(
 
     --PRIVATE(vec)->__size;
 
+	VECTOR_INDEX_DIRTY(vec)
+	VECTOR_TRACE_OP(vec, VECTOR_TRACE_OP_ERASE, index)
+
 	if (error != NULL)
 		(*error) = VECTOR_ERROR_SUCCESS;
 }
@@ -951,14 +1567,20 @@ VECTOR_STATIC VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_not_of)(
 	T value
 )
 {
-    if (VECTOR_FUNC(empty)(self))
-    	return VECTOR_INVALID_INDEX;
+	vector_index_t found = VECTOR_INVALID_INDEX;
 
     for (vector_index_t i = 0; i < (vector_index_t)PRIVATE(*self)->__size; ++i)
-        if (VECTOR_DATA(self, i) != value)
-            return i;
+    {
+        if (!VECTOR_EQ(VECTOR_DATA(*self, i), value))
+        {
+            found = i;
+            break;
+        }
+    }
+
+	VECTOR_TRACE_OP(*self, VECTOR_TRACE_OP_FIND_FIRST_NOT_OF, found)
 
-    return VECTOR_INVALID_INDEX;
+    return found;
 }
 
 VECTOR_STATIC VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_not_of)(
@@ -966,14 +1588,20 @@ VECTOR_STATIC VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_not_of)(
 	T value
 )
 {
-    if (VECTOR_FUNC(empty)(self))
-    	return VECTOR_INVALID_INDEX;
+	vector_index_t found = VECTOR_INVALID_INDEX;
 
     for (vector_index_t i = (vector_index_t)PRIVATE(*self)->__size - 1; i >= 0; --i)
-        if (VECTOR_DATA(self, i) != value)
-            return i;
+    {
+        if (!VECTOR_EQ(VECTOR_DATA(*self, i), value))
+        {
+            found = i;
+            break;
+        }
+    }
+
+	VECTOR_TRACE_OP(*self, VECTOR_TRACE_OP_FIND_LAST_NOT_OF, found)
 
-    return VECTOR_INVALID_INDEX;
+    return found;
 }
 
 VECTOR_STATIC VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_of)(
@@ -981,14 +1609,49 @@ VECTOR_STATIC VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_of)(
 	T value
 )
 {
-    if (VECTOR_FUNC(empty)(self))
-    	return VECTOR_INVALID_INDEX;
+	vector_index_t found = VECTOR_INVALID_INDEX;
+
+#if VECTOR_HAS_INDEX
+	if (VECTOR_FUNC(index_lookup)(*self, value, false, &found))
+	{
+		VECTOR_TRACE_OP(*self, VECTOR_TRACE_OP_FIND_FIRST_OF, found)
+
+		return found;
+	}
+#endif // VECTOR_HAS_INDEX
+
+#if VECTOR_HAS_TRAIT(BITWISE_EQ) && !defined(VECTOR_HOOK_EQUAL)
+	if (sizeof(T) == 1)
+	{
+		const T *hit = (PRIVATE(*self)->__size > 0)
+			? (const T *)memchr(
+				VECTOR_BEGIN(*self),
+				*(const unsigned char *)&value,
+				PRIVATE(*self)->__size
+			)
+			: NULL;
+
+		if (hit != NULL)
+			found = (vector_index_t)(hit - VECTOR_BEGIN(*self));
+
+		VECTOR_TRACE_OP(*self, VECTOR_TRACE_OP_FIND_FIRST_OF, found)
+
+		return found;
+	}
+#endif // BITWISE_EQ && !VECTOR_HOOK_EQUAL
 
     for (vector_index_t i = 0; i < (vector_index_t)PRIVATE(*self)->__size; ++i)
-        if (VECTOR_DATA(self, i) == value)
-            return i;
+    {
+        if (VECTOR_EQ(VECTOR_DATA(*self, i), value))
+        {
+            found = i;
+            break;
+        }
+    }
+
+	VECTOR_TRACE_OP(*self, VECTOR_TRACE_OP_FIND_FIRST_OF, found)
 
-    return VECTOR_INVALID_INDEX;
+    return found;
 }
 
 VECTOR_STATIC VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_of)(
@@ -996,14 +1659,29 @@ VECTOR_STATIC VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_of)(
 	T value
 )
 {
-    if (VECTOR_FUNC(empty)(self))
-    	return VECTOR_INVALID_INDEX;
+	vector_index_t found = VECTOR_INVALID_INDEX;
 
-	for (vector_index_t i = (vector_index_t)PRIVATE(*self)->__size - 1; i >= 0; --i)
-        if (VECTOR_DATA(self, i) == value)
-            return i;
+#if VECTOR_HAS_INDEX
+	if (VECTOR_FUNC(index_lookup)(*self, value, true, &found))
+	{
+		VECTOR_TRACE_OP(*self, VECTOR_TRACE_OP_FIND_LAST_OF, found)
+
+		return found;
+	}
+#endif // VECTOR_HAS_INDEX
 
-    return VECTOR_INVALID_INDEX;
+    for (vector_index_t i = (vector_index_t)PRIVATE(*self)->__size - 1; i >= 0; --i)
+    {
+        if (VECTOR_EQ(VECTOR_DATA(*self, i), value))
+        {
+            found = i;
+            break;
+        }
+    }
+
+	VECTOR_TRACE_OP(*self, VECTOR_TRACE_OP_FIND_LAST_OF, found)
+
+    return found;
 }
 
 VECTOR_STATIC VECTOR_INLINE T VECTOR_FUNC(front)(const VECTOR **self)
@@ -1047,6 +1725,7 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(insert_indx)(
     }
 	
 	VECTOR_CHECK_ENSURE_CAPACITY(self, PRIVATE(vec)->__size + 1, error, )
+	VECTOR_COW_DETACH(vec, error, )
     
     const T *data __attribute__((unused)) = (T *)memmove(
 		VECTOR_BEGIN(vec) + before + 1,
@@ -1059,6 +1738,9 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(insert_indx)(
     VECTOR_DATA(vec, before) = value;
     ++PRIVATE(vec)->__size;
 
+	VECTOR_INDEX_DIRTY(vec)
+	VECTOR_TRACE_OP(vec, VECTOR_TRACE_OP_INSERT, before)
+
     if (error != NULL)
     	*error = VECTOR_ERROR_SUCCESS;
 }
@@ -1086,42 +1768,16 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(insert_range_indx)(
 )
 {
 	VECTOR_CHECK_INPUT_RANGE(range, error, )
-    
-    const VECTOR **range_ptr = &range;
-    const vector_size_t range_size = VECTOR_FUNC(size)(range_ptr);
-    
-    if (range_size == 0)
-		return;
-	
-    VECTOR_CHECK_INDEX((const VECTOR **)self, before, error, )
-	VECTOR_CHECK_ENSURE_CAPACITY(
-		self,
-		PRIVATE(*self)->__size + range_size,
-		error,
-	)
-
-	VECTOR *vec = *self;
-
-    if (before < PRIVATE(vec)->__size)
-    {
-        const T *data __attribute__((unused)) = (T *)memmove(
-			VECTOR_BEGIN(vec) + before + range_size,
-            VECTOR_BEGIN(vec) + before,
-            (PRIVATE(vec)->__size - before) * sizeof(T)
-		);
 
-        VECTOR_CHECK_DATA(data, error, )
-    }
-    
-    for (vector_index_t i = 0; i < (vector_index_t)range_size; ++i)
-        VECTOR_DATA(vec, before + i) = VECTOR_DATA(vec, i);
-    
-    PRIVATE(vec)->__size += range_size;
-
-    if (error != NULL)
-    	*error = VECTOR_ERROR_SUCCESS;
+	VECTOR_FUNC(insert_span_indx)(
+		self,
+		before,
+		TEMPLATE(vector_span, TEMPLATE(from, T))(VECTOR_BEGIN(range), PRIVATE(range)->__size),
+		error
+	);
 }
 
+
 VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(insert_range_it)(
 	VECTOR **self,
 	const VECTOR_ITERATOR it_before,
@@ -1156,7 +1812,19 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(pop_back)(VECTOR **self)
 	VECTOR *vec = *self;
 
 	if (PRIVATE(vec)->__size > 0)
+	{
 		--PRIVATE(vec)->__size;
+
+#if VECTOR_HAS_INDEX
+		VECTOR_FUNC(index_pop)(
+			vec,
+			VECTOR_DATA(vec, PRIVATE(vec)->__size),
+			(vector_index_t)PRIVATE(vec)->__size
+		);
+#endif // VECTOR_HAS_INDEX
+	}
+
+	VECTOR_TRACE_OP(vec, VECTOR_TRACE_OP_POP_BACK, PRIVATE(vec)->__size)
 }
 
 VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(push_back)(
@@ -1168,21 +1836,116 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(push_back)(
 	VECTOR *vec = *self;
 
 	VECTOR_CHECK_ENSURE_CAPACITY(self, PRIVATE(vec)->__size + 1, error, )
+	VECTOR_COW_DETACH(vec, error, )
     
     VECTOR_DATA(vec, PRIVATE(vec)->__size) = value;
     ++PRIVATE(vec)->__size;
+
+#if VECTOR_HAS_INDEX
+	VECTOR_FUNC(index_push)(vec, value, (vector_index_t)PRIVATE(vec)->__size - 1);
+#endif // VECTOR_HAS_INDEX
+
+	VECTOR_TRACE_OP(vec, VECTOR_TRACE_OP_PUSH_BACK, PRIVATE(vec)->__size - 1)
     
 	if (error != NULL)
 		*error = VECTOR_ERROR_SUCCESS;
 }
 
+/*
+ * Unchecked fast paths: no error parameter and no index checks, whatever
+ * VECTOR_CHECK_ON says. Copy-on-write, the hash index and the trace are
+ * kept up to date like in the checked functions.
+ */
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(at_unchecked)(
+	const VECTOR **self,
+	vector_index_t index
+)
+{
+	VECTOR_TRACE_OP(*self, VECTOR_TRACE_OP_AT, index)
+
+	return VECTOR_DATA(*self, index);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(emplace_indx_unchecked)(
+	VECTOR **self,
+	vector_index_t index,
+	T value
+)
+{
+	VECTOR_COW_DETACH(*self, NULL, )
+
+#if VECTOR_HAS_INDEX
+	VECTOR_FUNC(index_replace)(*self, VECTOR_DATA(*self, index), value, index);
+#endif // VECTOR_HAS_INDEX
+
+	VECTOR_DATA(*self, index) = value;
+
+	VECTOR_TRACE_OP(*self, VECTOR_TRACE_OP_EMPLACE, index)
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(pop_back_unchecked)(VECTOR **self)
+{
+	VECTOR *vec = *self;
+
+	--PRIVATE(vec)->__size;
+
+#if VECTOR_HAS_INDEX
+	VECTOR_FUNC(index_pop)(
+		vec,
+		VECTOR_DATA(vec, PRIVATE(vec)->__size),
+		(vector_index_t)PRIVATE(vec)->__size
+	);
+#endif // VECTOR_HAS_INDEX
+
+	VECTOR_TRACE_OP(vec, VECTOR_TRACE_OP_POP_BACK, PRIVATE(vec)->__size)
+}
+
+VECTOR_API VECTOR_INLINE bool VECTOR_FUNC(push_back_unchecked)(VECTOR **self, T value)
+{
+	VECTOR *vec = *self;
+
+	if (VECTOR_UNLIKELY(PRIVATE(vec)->__size == PRIVATE(vec)->__allocated_size)
+		&& !VECTOR_FUNC(ensure_capacity)(self, PRIVATE(vec)->__size + 1, NULL))
+		return false;
+
+	VECTOR_COW_DETACH(vec, NULL, false)
+
+	VECTOR_DATA(vec, PRIVATE(vec)->__size) = value;
+	++PRIVATE(vec)->__size;
+
+#if VECTOR_HAS_INDEX
+	VECTOR_FUNC(index_push)(vec, value, (vector_index_t)PRIVATE(vec)->__size - 1);
+#endif // VECTOR_HAS_INDEX
+
+	VECTOR_TRACE_OP(vec, VECTOR_TRACE_OP_PUSH_BACK, PRIVATE(vec)->__size - 1)
+
+	return true;
+}
+
+VECTOR_API VECTOR_INLINE T *VECTOR_FUNC(view)(const VECTOR **self, vector_size_t *size)
+{
+	VECTOR *vec = (VECTOR *)*self;
+
+	*size = 0;
+
+	/* As data(): the loops of vector_range.h may write the elements */
+	VECTOR_COW_DETACH(vec, NULL, NULL)
+
+	*size = PRIVATE(vec)->__size;
+
+	return VECTOR_BEGIN(vec);
+}
+
 VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(reserve)(
 	VECTOR **self,
-	vector_size_t new_capacity,
+	vector_index_t new_capacity,
 	vector_error_t *error
 )
 {
-	VECTOR_CHECK_ENSURE_CAPACITY(self, new_capacity, error, )
+	VECTOR_CHECK(new_capacity >= 0, error, VECTOR_ERROR_CAPACITY, )
+	VECTOR_CHECK_ENSURE_CAPACITY(self, (vector_size_t)new_capacity, error, )
+
+	VECTOR_TRACE_OP(*self, VECTOR_TRACE_OP_RESERVE, new_capacity)
 }
 
 VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(resize)(
@@ -1191,7 +1954,9 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(resize)(
 	vector_error_t *error
 )
 {
-	VECTOR_FUNC(resize_with)(self, new_size, (T)0, error);
+	static const T zero;
+
+	VECTOR_FUNC(resize_with)(self, new_size, zero, error);
 }
 
 VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(resize_with)(
@@ -1205,17 +1970,22 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(resize_with)(
 
 	VECTOR_CHECK_ENSURE_CAPACITY(self, new_size, error, )
 	
-	for (
-		vector_index_t i = (vector_index_t)PRIVATE(vec)->__size; 
-		i < (vector_index_t)new_size; 
-		++i
-	)
+	if (new_size > PRIVATE(vec)->__size)
 	{
-		VECTOR_DATA(vec, i) = value;
+		VECTOR_COW_DETACH(vec, error, )
+
+		VECTOR_FUNC(fill)(
+			VECTOR_BEGIN(vec) + PRIVATE(vec)->__size,
+			new_size - PRIVATE(vec)->__size,
+			value
+		);
 	}
 	
 	PRIVATE(vec)->__size = new_size;
 
+	VECTOR_INDEX_DIRTY(vec)
+	VECTOR_TRACE_OP(vec, VECTOR_TRACE_OP_RESIZE, new_size)
+
 	if (error != NULL)
 		*error = VECTOR_ERROR_SUCCESS;
 }
@@ -1244,7 +2014,12 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(reverse_indx)(
 	VECTOR_CHECK_INDEX((const VECTOR **)self, end_index, error, )
 	
 	VECTOR *vec = *self;
-	T temp = (T)0;
+	T temp;
+
+	VECTOR_COW_DETACH(vec, error, )
+
+	VECTOR_INDEX_DIRTY(vec)
+	VECTOR_TRACE_OP_ARG(vec, VECTOR_TRACE_OP_REVERSE, begin_index, end_index + 1)
 	
 	while (begin_index < end_index)
 	{
@@ -1299,11 +2074,16 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(swap_indx)(
 	VECTOR_CHECK_INDEX((const VECTOR **)self, index_b, error, )
 
 	VECTOR *vec = *self;
+
+	VECTOR_COW_DETACH(vec, error, )
 	
     const T temp = VECTOR_DATA(vec, index_a);
     VECTOR_DATA(vec, index_a) = VECTOR_DATA(vec, index_b);
     VECTOR_DATA(vec, index_b) = temp;
 
+	VECTOR_INDEX_DIRTY(vec)
+	VECTOR_TRACE_OP_ARG(vec, VECTOR_TRACE_OP_SWAP, index_a, index_b)
+
 	if (error != NULL)
 		*error = VECTOR_ERROR_SUCCESS;
 }
@@ -1350,11 +2130,15 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(set_allocator)(
 #undef VECTOR
 #undef VECTOR_FUNC
 #undef VECTOR_ITERATOR
+#undef VECTOR_SPAN
 #undef PRIVATE
 #undef VECTOR_MALLOC
 #undef VECTOR_CALLOC
 #undef VECTOR_REALLOC
 #undef VECTOR_FREE
+#undef VECTOR_INDEX_DIRTY
+#undef VECTOR_EQ
+#undef VECTOR_LESS
 
 
 #endif // T
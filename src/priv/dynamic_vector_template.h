@@ -41,6 +41,10 @@
 #define VECTOR_ITERATOR 		TEMPLATE(vector_iterator, T)
 #endif // VECTOR_ITERATOR
 
+#ifndef VECTOR_SPAN
+#define VECTOR_SPAN 			TEMPLATE(vector_span, T)
+#endif // VECTOR_SPAN
+
 
 typedef T * TEMPLATE(vector_iterator, T);
 
@@ -79,7 +83,7 @@ struct VECTOR_PACKED_STRUCT VECTOR_T
 	);
     void (*emplace_range_it)(
 		VECTOR **, 
-		ITERATOR, 
+		VECTOR_ITERATOR, 
 		const VECTOR *,
 		vector_error_t *
 	);
@@ -169,7 +173,7 @@ struct VECTOR_PACKED_STRUCT VECTOR_T
 	TEMPLATE(vector_private, T) *__private;
 };
 
-VECTOR *VECTOR_FUNC(create_vector)(
+VECTOR_API VECTOR *VECTOR_FUNC(create_vector)(
 #ifdef VECTOR_USE_CUSTOM_ALLOCATOR
 	const vector_allocator_t *alloc,
 #endif // VECTOR_USE_CUSTOM_ALLOCATOR
@@ -177,169 +181,288 @@ VECTOR *VECTOR_FUNC(create_vector)(
 	T init_value,
 	vector_error_t *
 );
-VECTOR *VECTOR_FUNC(copy_create_vector)(
+VECTOR_API VECTOR *VECTOR_FUNC(copy_create_vector)(
 	const VECTOR *self,
 	vector_error_t *error
 );
-VECTOR *VECTOR_FUNC(move_create_vector)(VECTOR **self, vector_error_t *);
-void VECTOR_FUNC(destroy_vector)(VECTOR **self);
+/**
+ * @brief  Take over *self without allocating, *self is set to NULL
+ */
+VECTOR_API VECTOR *VECTOR_FUNC(move_create_vector)(VECTOR **self, vector_error_t *);
+VECTOR_API void VECTOR_FUNC(destroy_vector)(VECTOR **self);
+
+/**
+ * @brief  Move the contents of @p other into @p self without allocating
+ *
+ * The old contents of @p self are freed, @p other is left empty and usable.
+ */
+VECTOR_API void VECTOR_FUNC(move_assign)(
+	VECTOR **self,
+	VECTOR **other,
+	vector_error_t *error
+);
+/**
+ * @brief  Exchange the contents of two vectors in O(1)
+ */
+VECTOR_API void VECTOR_FUNC(swap)(
+	VECTOR **self,
+	VECTOR **other,
+	vector_error_t *error
+);
+/**
+ * @brief  Take the element buffer out of the vector, which is left empty
+ *
+ * @note   The caller owns the buffer: pass it to adopt() of a vector of the
+ *         same type (and allocator) or free it with that allocator.
+ */
+VECTOR_API T *VECTOR_FUNC(release)(
+	VECTOR **self,
+	vector_size_t *size,
+	vector_size_t *capacity,
+	vector_error_t *error
+);
+/**
+ * @brief  Replace the element buffer with @p data of @p capacity elements
+ *
+ * @note   @p data must come from release() or the allocator of the vector.
+ */
+VECTOR_API void VECTOR_FUNC(adopt)(
+	VECTOR **self,
+	T *data,
+	vector_size_t size,
+	vector_size_t capacity,
+	vector_error_t *error
+);
+
+/**
+ * @brief  Append the elements of @p span, which may point into @p self
+ */
+VECTOR_API void VECTOR_FUNC(append_span)(
+	VECTOR **self,
+	VECTOR_SPAN span,
+	vector_error_t *error
+);
+/**
+ * @brief  Replace the contents with the elements of @p span
+ */
+VECTOR_API void VECTOR_FUNC(assign_span)(
+	VECTOR **self,
+	VECTOR_SPAN span,
+	vector_error_t *error
+);
+/**
+ * @brief  Overwrite the elements from @p index with the elements of @p span
+ */
+VECTOR_API void VECTOR_FUNC(emplace_span_indx)(
+	VECTOR **self,
+	vector_index_t index,
+	VECTOR_SPAN span,
+	vector_error_t *error
+);
+/**
+ * @brief  Insert the elements of @p span before @p before
+ */
+VECTOR_API void VECTOR_FUNC(insert_span_indx)(
+	VECTOR **self,
+	vector_index_t before,
+	VECTOR_SPAN span,
+	vector_error_t *error
+);
+
+/*
+ * Unchecked variants for inner loops: no error parameter and no checks
+ * even with VECTOR_CHECK_ON. The index must be valid and pop_back needs a
+ * non-empty vector; keep the checked functions for boundary code.
+ */
+/**
+ * @brief  Element at @p index
+ */
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(at_unchecked)(
+	const VECTOR **self,
+	vector_index_t index
+);
+/**
+ * @brief  Overwrite the element at @p index
+ */
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(emplace_indx_unchecked)(
+	VECTOR **self,
+	vector_index_t index,
+	T value
+);
+/**
+ * @brief  Remove the last element
+ */
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(pop_back_unchecked)(VECTOR **self);
+/**
+ * @brief  Append @p value, false only when the buffer cannot grow
+ */
+VECTOR_API VECTOR_INLINE bool VECTOR_FUNC(push_back_unchecked)(VECTOR **self, T value);
+/**
+ * @brief  Element buffer, its size stored in @p size
+ *
+ * data() and size() in one call, for the VECTOR_EACH loops of
+ * vector_range.h. Writes through the pointer are not tracked by the hash
+ * index, as with data(). Like data(), a buffer shared with VECTOR_COW is
+ * copied first; NULL and size 0 when that copy cannot be allocated.
+ */
+VECTOR_API VECTOR_INLINE T *VECTOR_FUNC(view)(const VECTOR **self, vector_size_t *size);
 
 #ifdef VECTOR_LITE
-VECTOR_INLINE void VECTOR_FUNC(append_range)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(append_range)(
     VECTOR **self,
     const VECTOR *range,
     vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(assign)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(assign)(
     VECTOR **self,
     vector_size_t count,
     T value,
     vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(assign_range)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(assign_range)(
     VECTOR **self,
     const VECTOR *range,
     vector_error_t *error
 );
-VECTOR_INLINE T VECTOR_FUNC(at)(
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(at)(
 	const VECTOR **self,
 	vector_index_t index,
 	vector_error_t *error
 );
-VECTOR_INLINE T VECTOR_FUNC(back)(const VECTOR **self);
-VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(begin)(const VECTOR **self);
-VECTOR_INLINE vector_size_t VECTOR_FUNC(capacity)(const VECTOR **self);
-VECTOR_INLINE void VECTOR_FUNC(clear)(VECTOR **self);
-VECTOR_INLINE T *VECTOR_FUNC(data)(const VECTOR **self);
-VECTOR_INLINE void VECTOR_FUNC(emplace_indx)(
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(back)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(begin)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(capacity)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(clear)(VECTOR **self);
+VECTOR_API VECTOR_INLINE T *VECTOR_FUNC(data)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(emplace_indx)(
     VECTOR **self,
     vector_index_t index,
     T value,
     vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(emplace_it)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(emplace_it)(
     VECTOR **self,
     const VECTOR_ITERATOR it,
     T value,
     vector_error_t *error
 );
-VECTOR_INLINE void FUNC(emplace_range_indx)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(emplace_range_indx)(
 	VECTOR **self, 
 	vector_index_t index, 
 	const VECTOR *range,
     vector_error_t *error
 );
-VECTOR_INLINE void FUNC(emplace_range_it)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(emplace_range_it)(
 	VECTOR **self, 
-	ITERATOR it, 
+	VECTOR_ITERATOR it, 
 	const VECTOR *range,
     vector_error_t *error
 );
-VECTOR_INLINE bool VECTOR_FUNC(empty)(const VECTOR **self);
-VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(end)(const VECTOR **self);
-VECTOR_INLINE void VECTOR_FUNC(erase_indx)(
+VECTOR_API VECTOR_INLINE bool VECTOR_FUNC(empty)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(end)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(erase_indx)(
     VECTOR **self,
     vector_index_t index,
     vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(erase_it)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(erase_it)(
     VECTOR **self,
     VECTOR_ITERATOR it,
     vector_error_t *error
 );
-VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_not_of)(
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_not_of)(
 	const VECTOR **self,
 	T value
 );
-VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_not_of)(
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_not_of)(
 	const VECTOR **self,
 	T value
 );
-VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_of)(
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_of)(
 	const VECTOR **self,
 	T value
 );
-VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_of)(
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_of)(
 	const VECTOR **self,
 	T value
 );
-VECTOR_INLINE T VECTOR_FUNC(front)(const VECTOR **self);
-VECTOR_INLINE vector_index_t VECTOR_FUNC(indx)(
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(front)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(indx)(
 	const VECTOR **self,
     const VECTOR_ITERATOR it,
 	vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(insert_indx)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(insert_indx)(
     VECTOR **self,
     vector_index_t before,
     T value,
     vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(insert_it)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(insert_it)(
     VECTOR **self,
     const VECTOR_ITERATOR it_before,
     T value,
     vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(insert_range_indx)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(insert_range_indx)(
     VECTOR **self,
     vector_index_t before,
     const VECTOR *range,
     vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(insert_range_it)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(insert_range_it)(
     VECTOR **self,
     const VECTOR_ITERATOR it,
     const VECTOR *range,
     vector_error_t *error
 );
-VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(it)(
+VECTOR_API VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(it)(
     const VECTOR **self,
     vector_index_t index,
 	vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(pop_back)(VECTOR **self);
-VECTOR_INLINE void VECTOR_FUNC(push_back)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(pop_back)(VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(push_back)(
     VECTOR **self,
     T value,
     vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(reserve)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(reserve)(
     VECTOR **self,
     vector_index_t new_capacity,
     vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(resize)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(resize)(
     VECTOR **self,
     vector_size_t new_size,
     vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(resize_with)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(resize_with)(
     VECTOR **self,
     vector_size_t new_size,
     T value,
     vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(reverse_indx)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(reverse_indx)(
     VECTOR **self,
     vector_index_t begin_index,
     vector_index_t end_index,
     vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(reverse_it)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(reverse_it)(
     VECTOR **self,
     VECTOR_ITERATOR itb,
     VECTOR_ITERATOR ite,
     vector_error_t *error
 );
-VECTOR_INLINE vector_size_t VECTOR_FUNC(size)(const VECTOR **self);
-VECTOR_INLINE void VECTOR_FUNC(swap_indx)(
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(size)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(swap_indx)(
     VECTOR **self,
     vector_index_t index_a,
     vector_index_t index_b,
     vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(swap_it)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(swap_it)(
     VECTOR **self,
     VECTOR_ITERATOR it_a,
     VECTOR_ITERATOR it_b,
@@ -347,11 +470,11 @@ VECTOR_INLINE void VECTOR_FUNC(swap_it)(
 );
 
 #ifdef VECTOR_USE_CUSTOM_ALLOCATOR
-vector_allocator_t *VECTOR_FUNC(allocator)(
+VECTOR_API VECTOR_INLINE vector_allocator_t *VECTOR_FUNC(allocator)(
 	const VECTOR **,
 	vector_error_t *
 );
-void VECTOR_FUNC(set_allocator)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(set_allocator)(
 	VECTOR **self,
 	vector_allocator_t *alloc,
 	vector_error_t error*
@@ -364,6 +487,7 @@ void VECTOR_FUNC(set_allocator)(
 #undef VECTOR
 #undef VECTOR_FUNC
 #undef VECTOR_ITERATOR
+#undef VECTOR_SPAN
 
 
 #endif // T
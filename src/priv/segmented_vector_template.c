@@ -0,0 +1,499 @@
+/**
+ * @file      segmented_vector_template.c
+ * @brief     Template implementation of segmented vectors
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   With B = VECTOR_SEGMENT_BASE, chunk k holds B << k elements and
+ *            starts at index B * (2^k - 1). Element i lives in chunk
+ *            k = floor(log2(i / B + 1)), computed with one clz, at offset
+ *            i - B * (2^k - 1). Chunks are allocated on demand and only freed
+ *            by destroy_vector(), so pop_back/clear followed by push_back
+ *            reuse them.
+ *
+ * @note      This file should not be included directly.
+ *            Use the generated vector_impl.c instead.
+ *
+ * @see       segmented_vector_template.h
+ */
+
+#ifdef T
+
+#ifndef VECTOR_NO_DYNAMIC_ALLOC
+
+#include "template.h"
+#include "vector_traits.h"
+#include "vector_simd.h"
+#include "vector_allocator.h"
+#include "vector_error.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+
+struct VECTOR_PACKED_STRUCT TEMPLATE(vector_seg_private_t, T)
+{
+	T *__chunks[VECTOR_SEGMENT_MAX_CHUNKS];
+    vector_size_t __size;
+    vector_size_t __chunk_count;
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+    const vector_allocator_t *__allocator;
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+};
+
+
+#ifndef VECTOR
+#define VECTOR 				TEMPLATE(vector_seg, T)
+#endif // VECTOR
+
+#ifndef VECTOR_FUNC
+#define VECTOR_FUNC(_name) 	TEMPLATE(vector_seg, TEMPLATE(_name, T))
+#endif // VECTOR_FUNC
+
+#ifndef PRIVATE
+#define PRIVATE(_range)		((_range)->__private)
+#endif // PRIVATE
+
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+
+#ifndef VECTOR_MALLOC
+#define VECTOR_MALLOC(_self, _size) \
+	PRIVATE((_self))->__allocator->malloc((_size));
+#endif // VECTOR_MALLOC
+
+#ifndef VECTOR_FREE
+#define VECTOR_FREE(_self, _ptr) \
+	PRIVATE((_self))->__allocator->free((_ptr));
+#endif // VECTOR_FREE
+
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+
+#ifndef VECTOR_MALLOC
+#define VECTOR_MALLOC(_self, _size) 		malloc((_size));
+#endif // VECTOR_MALLOC
+
+#ifndef VECTOR_FREE
+#define VECTOR_FREE(_self, _ptr) 			free((_ptr));
+#endif // VECTOR_FREE
+
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+
+/* Own check macros, see bit_vector_template.c */
+#ifndef VECTOR_SEG_REQUIRE
+#define VECTOR_SEG_REQUIRE(_cond, _err_ptr, _err, _ret) \
+    do { \
+        if (!(_cond)) { \
+            if ((_err_ptr) != NULL) \
+                *(_err_ptr) = (_err); \
+            return _ret; \
+        } \
+    } while (0);
+#endif // VECTOR_SEG_REQUIRE
+
+#ifdef VECTOR_CHECK_ON
+
+#ifndef VECTOR_SEG_CHECK
+#define VECTOR_SEG_CHECK(_cond, _err_ptr, _err, _ret) \
+    do { \
+        if (!(_cond)) { \
+            if ((_err_ptr) != NULL) \
+                *(_err_ptr) = (_err); \
+            return _ret; \
+        } \
+    } while (0);
+#endif // VECTOR_SEG_CHECK
+
+#else // VECTOR_CHECK_ON
+
+#ifndef VECTOR_SEG_CHECK
+#define VECTOR_SEG_CHECK(_cond, _err_ptr, _err, _ret) ;
+#endif // VECTOR_SEG_CHECK
+
+#endif // VECTOR_CHECK_ON
+
+#ifndef VECTOR_SEG_CHECK_INDEX
+#define VECTOR_SEG_CHECK_INDEX(_range, _indx, _err_ptr, _ret) \
+    VECTOR_SEG_CHECK( \
+        ((_indx) >= 0) && ((vector_size_t)(_indx) < PRIVATE((_range))->__size), \
+        _err_ptr, \
+        VECTOR_ERROR_INDEX, \
+        _ret \
+    )
+#endif // VECTOR_SEG_CHECK_INDEX
+
+/* First index and length of chunk _k */
+#ifndef VECTOR_SEG_START
+#define VECTOR_SEG_START(_k) 	((size_t)VECTOR_SEGMENT_BASE * ((1ULL << (_k)) - 1))
+#endif // VECTOR_SEG_START
+
+#ifndef VECTOR_SEG_LENGTH
+#define VECTOR_SEG_LENGTH(_k) 	((size_t)VECTOR_SEGMENT_BASE << (_k))
+#endif // VECTOR_SEG_LENGTH
+
+
+/* Address of element index through the chunk directory */
+static VECTOR_INLINE T *VECTOR_FUNC(slot)(const VECTOR *vec, size_t index)
+{
+	const unsigned k = 63 - vector_clz64((uint64_t)(index / VECTOR_SEGMENT_BASE) + 1);
+
+	return PRIVATE(vec)->__chunks[k] + (index - VECTOR_SEG_START(k));
+}
+
+static VECTOR_INLINE size_t VECTOR_FUNC(capacity_of)(vector_size_t chunks)
+{
+	return VECTOR_SEG_START(chunks);
+}
+
+/* Allocate chunks until required elements fit, existing ones never move */
+static VECTOR_INLINE bool VECTOR_FUNC(ensure_capacity)(
+	VECTOR **self,
+	vector_size_t required,
+	vector_error_t *error
+)
+{
+    VECTOR *vec = *self;
+
+    while (VECTOR_FUNC(capacity_of)(PRIVATE(vec)->__chunk_count) < required)
+    {
+    	const vector_size_t k = PRIVATE(vec)->__chunk_count;
+
+    	VECTOR_SEG_REQUIRE(k < VECTOR_SEGMENT_MAX_CHUNKS, error, VECTOR_ERROR_CAPACITY, false)
+
+    	T *chunk = (T *)VECTOR_MALLOC(vec, VECTOR_SEG_LENGTH(k) * sizeof(T))
+
+    	VECTOR_SEG_REQUIRE(chunk != NULL, error, VECTOR_ERROR_ALLOC, false)
+
+    	PRIVATE(vec)->__chunks[k] = chunk;
+    	++PRIVATE(vec)->__chunk_count;
+    }
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+
+    return true;
+}
+
+
+VECTOR_API VECTOR *VECTOR_FUNC(create_vector)(
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+	const vector_allocator_t *alloc,
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+	vector_size_t init_size,
+	T init_value,
+	vector_error_t *error
+)
+{
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+	if (alloc == NULL)
+		alloc = vector_default_allocator();
+
+	VECTOR *new_vec = (VECTOR *)alloc->malloc(sizeof(VECTOR));
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+	VECTOR *new_vec = (VECTOR *)VECTOR_MALLOC(NULL, sizeof(VECTOR));
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+	VECTOR_SEG_REQUIRE(new_vec != NULL, error, VECTOR_ERROR_ALLOC, NULL)
+
+    PRIVATE(new_vec) =
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+    	(TEMPLATE(vector_seg_private, T) *)alloc->calloc(1, sizeof(TEMPLATE(vector_seg_private, T)));
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+		(TEMPLATE(vector_seg_private, T) *)calloc(1, sizeof(TEMPLATE(vector_seg_private, T)));
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+	if (PRIVATE(new_vec) == NULL)
+	{
+		if (error != NULL)
+			*error = VECTOR_ERROR_ALLOC;
+
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+		alloc->free(new_vec);
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+		VECTOR_FREE(NULL, new_vec);
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+
+        return NULL;
+    }
+
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+    PRIVATE(new_vec)->__allocator = alloc;
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+
+    if (init_size > 0)
+	{
+        if (!VECTOR_FUNC(ensure_capacity)(&new_vec, init_size, error))
+		{
+			VECTOR_FUNC(destroy_vector)(&new_vec);
+
+            return NULL;
+        }
+
+        VECTOR_FUNC(resize_with)(&new_vec, init_size, init_value, error);
+    }
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+
+    return new_vec;
+}
+
+VECTOR_API void VECTOR_FUNC(destroy_vector)(VECTOR **self)
+{
+    if (self == NULL || *self == NULL)
+		return;
+
+    VECTOR *vec = *self;
+
+    if (PRIVATE(vec) != NULL)
+    {
+    	for (vector_size_t k = 0; k < PRIVATE(vec)->__chunk_count; ++k)
+    		VECTOR_FREE(vec, PRIVATE(vec)->__chunks[k]);
+
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+    	const vector_allocator_t *alloc = PRIVATE(vec)->__allocator;
+
+    	alloc->free(PRIVATE(vec));
+    	alloc->free(vec);
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+    	VECTOR_FREE(vec, PRIVATE(vec));
+    	VECTOR_FREE(vec, vec);
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+    }
+
+    *self = NULL;
+}
+
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(at)(
+	const VECTOR **self,
+	vector_index_t index,
+	vector_error_t *error
+)
+{
+	VECTOR_SEG_CHECK_INDEX(*self, index, error, (T){0})
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+
+    return *VECTOR_FUNC(slot)(*self, (size_t)index);
+}
+
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(back)(const VECTOR **self)
+{
+    return *VECTOR_FUNC(slot)(*self, PRIVATE(*self)->__size - 1);
+}
+
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(capacity)(const VECTOR **self)
+{
+	const size_t capacity = VECTOR_FUNC(capacity_of)(PRIVATE(*self)->__chunk_count);
+
+    return (capacity > VECTOR_SIZE_MAX) ? VECTOR_SIZE_MAX : (vector_size_t)capacity;
+}
+
+VECTOR_API VECTOR_INLINE T *VECTOR_FUNC(chunk)(
+	const VECTOR **self,
+	vector_size_t chunk,
+	vector_size_t *count
+)
+{
+	const vector_size_t size = PRIVATE(*self)->__size;
+
+	if (chunk >= PRIVATE(*self)->__chunk_count || VECTOR_SEG_START(chunk) >= size)
+	{
+		if (count != NULL)
+			*count = 0;
+
+		return NULL;
+	}
+
+	const size_t used = size - VECTOR_SEG_START(chunk);
+
+	if (count != NULL)
+		*count = (vector_size_t)((used < VECTOR_SEG_LENGTH(chunk)) ? used : VECTOR_SEG_LENGTH(chunk));
+
+	return PRIVATE(*self)->__chunks[chunk];
+}
+
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(chunk_count)(const VECTOR **self)
+{
+	const vector_size_t size = PRIVATE(*self)->__size;
+
+	if (size == 0)
+		return 0;
+
+	return 64 - vector_clz64((uint64_t)((size - 1) / VECTOR_SEGMENT_BASE) + 1);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(clear)(VECTOR **self)
+{
+    PRIVATE(*self)->__size = 0;
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(emplace_indx)(
+	VECTOR **self,
+	vector_index_t index,
+	T value,
+	vector_error_t *error
+)
+{
+	VECTOR_SEG_CHECK_INDEX(*self, index, error, )
+
+	*VECTOR_FUNC(slot)(*self, (size_t)index) = value;
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API VECTOR_INLINE bool VECTOR_FUNC(empty)(const VECTOR **self)
+{
+    return (PRIVATE(*self)->__size == 0);
+}
+
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_of)(
+	const VECTOR **self,
+	T value
+)
+{
+	const vector_size_t chunks = VECTOR_FUNC(chunk_count)(self);
+
+	for (vector_size_t k = 0; k < chunks; ++k)
+	{
+		vector_size_t count;
+		const T *chunk = VECTOR_FUNC(chunk)(self, k, &count);
+
+		for (vector_size_t i = 0; i < count; ++i)
+		{
+			if (VECTOR_EQ(chunk[i], value))
+				return (vector_index_t)(VECTOR_SEG_START(k) + i);
+		}
+	}
+
+    return VECTOR_INVALID_INDEX;
+}
+
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_of)(
+	const VECTOR **self,
+	T value
+)
+{
+	for (vector_size_t k = VECTOR_FUNC(chunk_count)(self); k > 0; --k)
+	{
+		vector_size_t count;
+		const T *chunk = VECTOR_FUNC(chunk)(self, k - 1, &count);
+
+		for (vector_size_t i = count; i > 0; --i)
+		{
+			if (VECTOR_EQ(chunk[i - 1], value))
+				return (vector_index_t)(VECTOR_SEG_START(k - 1) + i - 1);
+		}
+	}
+
+    return VECTOR_INVALID_INDEX;
+}
+
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(front)(const VECTOR **self)
+{
+    return PRIVATE(*self)->__chunks[0][0];
+}
+
+VECTOR_API VECTOR_INLINE T *VECTOR_FUNC(it)(
+	const VECTOR **self,
+	vector_index_t index,
+	vector_error_t *error
+)
+{
+	VECTOR_SEG_CHECK_INDEX(*self, index, error, NULL)
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return VECTOR_FUNC(slot)(*self, (size_t)index);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(pop_back)(VECTOR **self)
+{
+	if (PRIVATE(*self)->__size > 0)
+		--PRIVATE(*self)->__size;
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(push_back)(
+	VECTOR **self,
+	T value,
+	vector_error_t *error
+)
+{
+	if (!VECTOR_FUNC(ensure_capacity)(self, PRIVATE(*self)->__size + 1, error))
+		return;
+
+	VECTOR *vec = *self;
+
+	*VECTOR_FUNC(slot)(vec, PRIVATE(vec)->__size) = value;
+	++PRIVATE(vec)->__size;
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(reserve)(
+	VECTOR **self,
+	vector_size_t new_capacity,
+	vector_error_t *error
+)
+{
+	VECTOR_FUNC(ensure_capacity)(self, new_capacity, error);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(resize_with)(
+	VECTOR **self,
+	vector_size_t new_size,
+	T value,
+	vector_error_t *error
+)
+{
+	if (!VECTOR_FUNC(ensure_capacity)(self, new_size, error))
+		return;
+
+	VECTOR *vec = *self;
+	size_t index = PRIVATE(vec)->__size;
+
+	/* Fill chunk by chunk, each run is a plain array loop */
+	while (index < new_size)
+	{
+		const unsigned k = 63 - vector_clz64((uint64_t)(index / VECTOR_SEGMENT_BASE) + 1);
+		const size_t chunk_end = VECTOR_SEG_START(k) + VECTOR_SEG_LENGTH(k);
+		const size_t end = (chunk_end < new_size) ? chunk_end : new_size;
+		T *dst = VECTOR_FUNC(slot)(vec, index);
+
+		for (size_t i = 0; i < end - index; ++i)
+			dst[i] = value;
+
+		index = end;
+	}
+
+	PRIVATE(vec)->__size = new_size;
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(size)(const VECTOR **self)
+{
+    return PRIVATE(*self)->__size;
+}
+
+
+#undef VECTOR
+#undef VECTOR_FUNC
+#undef PRIVATE
+#undef VECTOR_MALLOC
+#undef VECTOR_FREE
+#undef VECTOR_SEG_REQUIRE
+#undef VECTOR_SEG_CHECK
+#undef VECTOR_SEG_CHECK_INDEX
+#undef VECTOR_SEG_START
+#undef VECTOR_SEG_LENGTH
+
+
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+
+#endif // T
@@ -0,0 +1,191 @@
+/**
+ * @file      segmented_vector_template.h
+ * @brief     Template declarations for segmented vectors
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Types initialized with VECTOR_INITIALIZE_TYPE_SEGMENTED() get a
+ *            vector_seg_T that stores its elements in chunks instead of one
+ *            block. Chunk k holds VECTOR_SEGMENT_BASE << k elements, so
+ *            growing allocates a new chunk and never moves or copies the
+ *            elements already stored: pointers returned by it() stay valid
+ *            until the element is removed or the vector is destroyed.
+ *
+ *            at() finds the chunk of an index in O(1) from a fixed chunk
+ *            directory (one clz, no search). Chunk-wise iteration with
+ *            VECTOR_SEG_FOREACH_IT() walks each chunk as a plain array.
+ *
+ * @note      Only dynamic vectors can be segmented: with
+ *            VECTOR_NO_DYNAMIC_ALLOC nothing is declared for the type.
+ *
+ * @see       segmented_vector_template.c
+ */
+
+#ifdef T
+
+#include "template.h"
+#include "vector_config.h"
+#include "vector_allocator.h"
+#include "vector_error.h"
+
+#include <stdbool.h>
+
+
+#ifndef VECTOR_NO_DYNAMIC_ALLOC
+
+
+/**
+ * @def   VECTOR_SEGMENT_BASE
+ * @brief Elements in the first chunk, a power of two
+ */
+#ifndef VECTOR_SEGMENT_BASE
+#define VECTOR_SEGMENT_BASE 		64
+#endif // VECTOR_SEGMENT_BASE
+
+/**
+ * @def   VECTOR_SEGMENT_MAX_CHUNKS
+ * @brief Size of the chunk directory (enough for VECTOR_SIZE_MAX elements)
+ */
+#ifndef VECTOR_SEGMENT_MAX_CHUNKS
+#define VECTOR_SEGMENT_MAX_CHUNKS 	32
+#endif // VECTOR_SEGMENT_MAX_CHUNKS
+
+/**
+ * @def   VECTOR_SEG_FOREACH_IT
+ * @brief Iterate over a segmented vector chunk by chunk
+ *
+ * @param _type   Type alias (e.g. int_t)
+ * @param _range  Vector pointer (vector_seg_T *)
+ * @param _it     Iterator variable name (T *)
+ *
+ * Inside a chunk _it is advanced as a plain pointer. break leaves the
+ * current chunk only.
+ */
+#ifndef VECTOR_SEG_FOREACH_IT
+#define VECTOR_SEG_FOREACH_IT(_type, _range, _it) \
+	for ( \
+		vector_size_t _seg = 0, _seg_len = 0; \
+		_seg < TEMPLATE(vector_seg, TEMPLATE(chunk_count, _type))( \
+			(const TEMPLATE(vector_seg, _type) **)&(_range) \
+		); \
+		++_seg \
+	) \
+		for ( \
+			_type *_seg_end = ( \
+				(_it) = TEMPLATE(vector_seg, TEMPLATE(chunk, _type))( \
+					(const TEMPLATE(vector_seg, _type) **)&(_range), \
+					_seg, \
+					&_seg_len \
+				), \
+				(_it) + _seg_len \
+			); \
+			(_it) != _seg_end; \
+			++(_it) \
+		)
+#endif // VECTOR_SEG_FOREACH_IT
+
+
+#ifndef VECTOR_T
+#define VECTOR_T 				TEMPLATE(vector_seg_t, T)
+#endif // VECTOR_T
+
+#ifndef VECTOR
+#define VECTOR 					TEMPLATE(vector_seg, T)
+#endif // VECTOR
+
+#ifndef VECTOR_FUNC
+#define VECTOR_FUNC(_name) 		TEMPLATE(vector_seg, TEMPLATE(_name, T))
+#endif // VECTOR_FUNC
+
+
+typedef struct TEMPLATE(vector_seg_private_t, T) TEMPLATE(vector_seg_private, T);
+
+typedef struct VECTOR_T VECTOR;
+struct VECTOR_PACKED_STRUCT VECTOR_T
+{
+	TEMPLATE(vector_seg_private, T) *__private;
+};
+
+VECTOR_API VECTOR *VECTOR_FUNC(create_vector)(
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+	const vector_allocator_t *alloc,
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+	vector_size_t init_size,
+	T init_value,
+	vector_error_t *
+);
+VECTOR_API void VECTOR_FUNC(destroy_vector)(VECTOR **self);
+
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(at)(
+	const VECTOR **self,
+	vector_index_t index,
+	vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(back)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(capacity)(const VECTOR **self);
+/**
+ * @brief  Elements of chunk @p chunk and their number in @p count
+ */
+VECTOR_API VECTOR_INLINE T *VECTOR_FUNC(chunk)(
+	const VECTOR **self,
+	vector_size_t chunk,
+	vector_size_t *count
+);
+/**
+ * @brief  Number of chunks holding elements
+ */
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(chunk_count)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(clear)(VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(emplace_indx)(
+    VECTOR **self,
+    vector_index_t index,
+    T value,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE bool VECTOR_FUNC(empty)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_of)(
+	const VECTOR **self,
+	T value
+);
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_of)(
+	const VECTOR **self,
+	T value
+);
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(front)(const VECTOR **self);
+/**
+ * @brief  Stable address of element @p index
+ */
+VECTOR_API VECTOR_INLINE T *VECTOR_FUNC(it)(
+    const VECTOR **self,
+    vector_index_t index,
+	vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(pop_back)(VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(push_back)(
+    VECTOR **self,
+    T value,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(reserve)(
+    VECTOR **self,
+    vector_size_t new_capacity,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(resize_with)(
+    VECTOR **self,
+    vector_size_t new_size,
+    T value,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(size)(const VECTOR **self);
+
+
+#undef VECTOR_T
+#undef VECTOR
+#undef VECTOR_FUNC
+
+
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+
+#endif // T
@@ -0,0 +1,585 @@
+/**
+ * @file      soa_vector_template.c
+ * @brief     Template implementation of structure-of-arrays vectors
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Every function expands VECTOR_SOA_FIELDS once with a local
+ *            per-column macro, so a row operation is a sequence of plain
+ *            column operations without loops over field descriptors.
+ *
+ *            Columns are separate allocations. ensure_capacity() grows them
+ *            one by one and only updates the shared capacity when all of them
+ *            succeeded; columns that grew before a failure just stay larger.
+ *
+ * @note      This file should not be included directly.
+ *            Use the generated vector_impl.c instead.
+ *
+ * @see       soa_vector_template.h
+ */
+
+#ifdef T
+
+#ifndef VECTOR_NO_DYNAMIC_ALLOC
+
+#include "template.h"
+#include "vector_allocator.h"
+#include "vector_error.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+
+#define VECTOR_SOA_MEMBER(_type, _field) 	_type *_field;
+
+struct VECTOR_PACKED_STRUCT TEMPLATE(vector_soa_private_t, T)
+{
+	VECTOR_SOA_FIELDS(VECTOR_SOA_MEMBER)
+    vector_size_t __size;
+    vector_size_t __allocated_size;
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+    const vector_allocator_t *__allocator;
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+};
+
+#undef VECTOR_SOA_MEMBER
+
+
+#ifndef VECTOR
+#define VECTOR 				TEMPLATE(vector_soa, T)
+#endif // VECTOR
+
+#ifndef VECTOR_FUNC
+#define VECTOR_FUNC(_name) 	TEMPLATE(vector_soa, TEMPLATE(_name, T))
+#endif // VECTOR_FUNC
+
+#ifndef VECTOR_SOA_COLUMN_FUNC
+#define VECTOR_SOA_COLUMN_FUNC(_name, _field) \
+	TEMPLATE(vector_soa, TEMPLATE(TEMPLATE(_name, _field), T))
+#endif // VECTOR_SOA_COLUMN_FUNC
+
+#ifndef PRIVATE
+#define PRIVATE(_range)		((_range)->__private)
+#endif // PRIVATE
+
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+
+#ifndef VECTOR_MALLOC
+#define VECTOR_MALLOC(_self, _size) \
+	PRIVATE((_self))->__allocator->malloc((_size));
+#endif // VECTOR_MALLOC
+
+#ifndef VECTOR_REALLOC
+#define VECTOR_REALLOC(_self, _ptr, _size) \
+	PRIVATE((_self))->__allocator->realloc((_ptr), (_size));
+#endif // VECTOR_REALLOC
+
+#ifndef VECTOR_FREE
+#define VECTOR_FREE(_self, _ptr) \
+	PRIVATE((_self))->__allocator->free((_ptr));
+#endif // VECTOR_FREE
+
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+
+#ifndef VECTOR_MALLOC
+#define VECTOR_MALLOC(_self, _size) 		malloc((_size));
+#endif // VECTOR_MALLOC
+
+#ifndef VECTOR_REALLOC
+#define VECTOR_REALLOC(_self, _ptr, _size) 	realloc((_ptr), (_size));
+#endif // VECTOR_REALLOC
+
+#ifndef VECTOR_FREE
+#define VECTOR_FREE(_self, _ptr) 			free((_ptr));
+#endif // VECTOR_FREE
+
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+
+/* Own check macros, see bit_vector_template.c */
+#ifndef VECTOR_SOA_REQUIRE
+#define VECTOR_SOA_REQUIRE(_cond, _err_ptr, _err, _ret) \
+    do { \
+        if (!(_cond)) { \
+            if ((_err_ptr) != NULL) \
+                *(_err_ptr) = (_err); \
+            return _ret; \
+        } \
+    } while (0);
+#endif // VECTOR_SOA_REQUIRE
+
+#ifdef VECTOR_CHECK_ON
+
+#ifndef VECTOR_SOA_CHECK
+#define VECTOR_SOA_CHECK(_cond, _err_ptr, _err, _ret) \
+    do { \
+        if (!(_cond)) { \
+            if ((_err_ptr) != NULL) \
+                *(_err_ptr) = (_err); \
+            return _ret; \
+        } \
+    } while (0);
+#endif // VECTOR_SOA_CHECK
+
+#else // VECTOR_CHECK_ON
+
+#ifndef VECTOR_SOA_CHECK
+#define VECTOR_SOA_CHECK(_cond, _err_ptr, _err, _ret) ;
+#endif // VECTOR_SOA_CHECK
+
+#endif // VECTOR_CHECK_ON
+
+#ifndef VECTOR_SOA_CHECK_INDEX
+#define VECTOR_SOA_CHECK_INDEX(_range, _indx, _err_ptr, _ret) \
+    VECTOR_SOA_CHECK( \
+        ((_indx) >= 0) && ((vector_size_t)(_indx) < PRIVATE((_range))->__size), \
+        _err_ptr, \
+        VECTOR_ERROR_INDEX, \
+        _ret \
+    )
+#endif // VECTOR_SOA_CHECK_INDEX
+
+
+static VECTOR_INLINE bool VECTOR_FUNC(ensure_capacity)(
+	VECTOR **self,
+	vector_size_t required,
+	vector_error_t *error
+)
+{
+    VECTOR *vec = *self;
+
+    if (required <= PRIVATE(vec)->__allocated_size)
+        return true;
+
+    vector_size_t new_capacity = PRIVATE(vec)->__allocated_size;
+
+    if (new_capacity == 0)
+        new_capacity = VECTOR_INITIAL_CAPACITY;
+
+    while (new_capacity < required)
+        new_capacity *= VECTOR_GROWTH_FACTOR;
+
+    bool grown = true;
+
+#define VECTOR_SOA_GROW(_type, _field) \
+	if (grown) \
+	{ \
+		_type *column = (_type *)VECTOR_REALLOC( \
+			vec, \
+			PRIVATE(vec)->_field, \
+			new_capacity * sizeof(_type) \
+		) \
+		\
+		if (column != NULL) \
+			PRIVATE(vec)->_field = column; \
+		else \
+			grown = false; \
+	}
+
+    VECTOR_SOA_FIELDS(VECTOR_SOA_GROW)
+
+#undef VECTOR_SOA_GROW
+
+    /* Columns that grew keep their buffer, the capacity stays the old one */
+    VECTOR_SOA_REQUIRE(grown, error, VECTOR_ERROR_ALLOC, false)
+
+    PRIVATE(vec)->__allocated_size = new_capacity;
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+
+    return true;
+}
+
+
+VECTOR_API VECTOR *VECTOR_FUNC(create_vector)(
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+	const vector_allocator_t *alloc,
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+	vector_size_t init_size,
+	T init_value,
+	vector_error_t *error
+)
+{
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+	if (alloc == NULL)
+		alloc = vector_default_allocator();
+
+	VECTOR *new_vec = (VECTOR *)alloc->malloc(sizeof(VECTOR));
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+	VECTOR *new_vec = (VECTOR *)VECTOR_MALLOC(NULL, sizeof(VECTOR));
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+	VECTOR_SOA_REQUIRE(new_vec != NULL, error, VECTOR_ERROR_ALLOC, NULL)
+
+    PRIVATE(new_vec) =
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+    	(TEMPLATE(vector_soa_private, T) *)alloc->calloc(1, sizeof(TEMPLATE(vector_soa_private, T)));
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+		(TEMPLATE(vector_soa_private, T) *)calloc(1, sizeof(TEMPLATE(vector_soa_private, T)));
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+	if (PRIVATE(new_vec) == NULL)
+	{
+		if (error != NULL)
+			*error = VECTOR_ERROR_ALLOC;
+
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+		alloc->free(new_vec);
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+		VECTOR_FREE(NULL, new_vec);
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+
+        return NULL;
+    }
+
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+    PRIVATE(new_vec)->__allocator = alloc;
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+
+    if (init_size > 0)
+	{
+        if (!VECTOR_FUNC(ensure_capacity)(&new_vec, init_size, error))
+		{
+			VECTOR_FUNC(destroy_vector)(&new_vec);
+
+            return NULL;
+        }
+
+        VECTOR_FUNC(resize_with)(&new_vec, init_size, init_value, error);
+    }
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+
+    return new_vec;
+}
+
+VECTOR_API VECTOR *VECTOR_FUNC(copy_create_vector)(
+	const VECTOR *other,
+	vector_error_t *error
+)
+{
+	VECTOR_SOA_CHECK(other != NULL, error, VECTOR_ERROR_NULL, NULL)
+
+	VECTOR *new_vec = VECTOR_FUNC(create_vector)(
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+		PRIVATE(other)->__allocator,
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+		0,
+		(T){0},
+		error
+	);
+
+	if (new_vec == NULL)
+		return NULL;
+
+	if (!VECTOR_FUNC(ensure_capacity)(&new_vec, PRIVATE(other)->__size, error))
+	{
+		VECTOR_FUNC(destroy_vector)(&new_vec);
+
+		return NULL;
+	}
+
+	const vector_size_t size = PRIVATE(other)->__size;
+
+#define VECTOR_SOA_COPY(_type, _field) \
+	if (size > 0) \
+		memcpy(PRIVATE(new_vec)->_field, PRIVATE(other)->_field, size * sizeof(_type));
+
+	VECTOR_SOA_FIELDS(VECTOR_SOA_COPY)
+
+#undef VECTOR_SOA_COPY
+
+	PRIVATE(new_vec)->__size = size;
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+
+	return new_vec;
+}
+
+VECTOR_API void VECTOR_FUNC(destroy_vector)(VECTOR **self)
+{
+    if (self == NULL || *self == NULL)
+		return;
+
+    VECTOR *vec = *self;
+
+    if (PRIVATE(vec) != NULL)
+    {
+#define VECTOR_SOA_FREE(_type, _field) \
+		if (PRIVATE(vec)->_field != NULL) \
+			VECTOR_FREE(vec, PRIVATE(vec)->_field)
+
+		VECTOR_SOA_FIELDS(VECTOR_SOA_FREE)
+
+#undef VECTOR_SOA_FREE
+
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+    	const vector_allocator_t *alloc = PRIVATE(vec)->__allocator;
+
+    	alloc->free(PRIVATE(vec));
+    	alloc->free(vec);
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+    	VECTOR_FREE(vec, PRIVATE(vec));
+    	VECTOR_FREE(vec, vec);
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+    }
+
+    *self = NULL;
+}
+
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(at)(
+	const VECTOR **self,
+	vector_index_t index,
+	vector_error_t *error
+)
+{
+	T row;
+
+	memset(&row, 0, sizeof(row));
+
+	VECTOR_SOA_CHECK_INDEX(*self, index, error, row)
+
+#define VECTOR_SOA_GATHER(_type, _field) \
+	row._field = PRIVATE(*self)->_field[index];
+
+	VECTOR_SOA_FIELDS(VECTOR_SOA_GATHER)
+
+#undef VECTOR_SOA_GATHER
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+
+    return row;
+}
+
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(back)(const VECTOR **self)
+{
+    return VECTOR_FUNC(at)(self, (vector_index_t)PRIVATE(*self)->__size - 1, NULL);
+}
+
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(capacity)(const VECTOR **self)
+{
+    return PRIVATE(*self)->__allocated_size;
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(clear)(VECTOR **self)
+{
+    PRIVATE(*self)->__size = 0;
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(emplace_indx)(
+	VECTOR **self,
+	vector_index_t index,
+	T value,
+	vector_error_t *error
+)
+{
+	VECTOR_SOA_CHECK_INDEX(*self, index, error, )
+
+#define VECTOR_SOA_SCATTER(_type, _field) \
+	PRIVATE(*self)->_field[index] = value._field;
+
+	VECTOR_SOA_FIELDS(VECTOR_SOA_SCATTER)
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API VECTOR_INLINE bool VECTOR_FUNC(empty)(const VECTOR **self)
+{
+    return (PRIVATE(*self)->__size == 0);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(erase_indx)(
+	VECTOR **self,
+	vector_index_t index,
+	vector_error_t *error
+)
+{
+	VECTOR_SOA_CHECK_INDEX(*self, index, error, )
+
+	VECTOR *vec = *self;
+	const vector_size_t tail = PRIVATE(vec)->__size - (vector_size_t)index - 1;
+
+#define VECTOR_SOA_ERASE(_type, _field) \
+	memmove( \
+		PRIVATE(vec)->_field + index, \
+		PRIVATE(vec)->_field + index + 1, \
+		tail * sizeof(_type) \
+	);
+
+	VECTOR_SOA_FIELDS(VECTOR_SOA_ERASE)
+
+#undef VECTOR_SOA_ERASE
+
+	--PRIVATE(vec)->__size;
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(front)(const VECTOR **self)
+{
+    return VECTOR_FUNC(at)(self, 0, NULL);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(insert_indx)(
+	VECTOR **self,
+	vector_index_t before,
+	T value,
+	vector_error_t *error
+)
+{
+	VECTOR_SOA_CHECK(
+		(before >= 0) && ((vector_size_t)before <= PRIVATE(*self)->__size),
+		error,
+		VECTOR_ERROR_INDEX,
+	)
+
+	if (!VECTOR_FUNC(ensure_capacity)(self, PRIVATE(*self)->__size + 1, error))
+		return;
+
+	VECTOR *vec = *self;
+	const vector_size_t tail = PRIVATE(vec)->__size - (vector_size_t)before;
+
+#define VECTOR_SOA_INSERT(_type, _field) \
+	memmove( \
+		PRIVATE(vec)->_field + before + 1, \
+		PRIVATE(vec)->_field + before, \
+		tail * sizeof(_type) \
+	); \
+	PRIVATE(vec)->_field[before] = value._field;
+
+	VECTOR_SOA_FIELDS(VECTOR_SOA_INSERT)
+
+#undef VECTOR_SOA_INSERT
+
+	++PRIVATE(vec)->__size;
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(pop_back)(VECTOR **self)
+{
+	if (PRIVATE(*self)->__size > 0)
+		--PRIVATE(*self)->__size;
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(push_back)(
+	VECTOR **self,
+	T value,
+	vector_error_t *error
+)
+{
+	if (!VECTOR_FUNC(ensure_capacity)(self, PRIVATE(*self)->__size + 1, error))
+		return;
+
+	const vector_size_t index = PRIVATE(*self)->__size;
+
+	VECTOR_SOA_FIELDS(VECTOR_SOA_SCATTER)
+
+	++PRIVATE(*self)->__size;
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+#undef VECTOR_SOA_SCATTER
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(reserve)(
+	VECTOR **self,
+	vector_size_t new_capacity,
+	vector_error_t *error
+)
+{
+	VECTOR_FUNC(ensure_capacity)(self, new_capacity, error);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(resize_with)(
+	VECTOR **self,
+	vector_size_t new_size,
+	T value,
+	vector_error_t *error
+)
+{
+	if (!VECTOR_FUNC(ensure_capacity)(self, new_size, error))
+		return;
+
+	VECTOR *vec = *self;
+
+#define VECTOR_SOA_FILL(_type, _field) \
+	for (vector_size_t i = PRIVATE(vec)->__size; i < new_size; ++i) \
+		PRIVATE(vec)->_field[i] = value._field;
+
+	VECTOR_SOA_FIELDS(VECTOR_SOA_FILL)
+
+#undef VECTOR_SOA_FILL
+
+	PRIVATE(vec)->__size = new_size;
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(size)(const VECTOR **self)
+{
+    return PRIVATE(*self)->__size;
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(swap_indx)(
+	VECTOR **self,
+	vector_index_t index_a,
+	vector_index_t index_b,
+	vector_error_t *error
+)
+{
+	VECTOR_SOA_CHECK_INDEX(*self, index_a, error, )
+	VECTOR_SOA_CHECK_INDEX(*self, index_b, error, )
+
+	VECTOR *vec = *self;
+
+#define VECTOR_SOA_SWAP(_type, _field) \
+	{ \
+		_type temp = PRIVATE(vec)->_field[index_a]; \
+		\
+		PRIVATE(vec)->_field[index_a] = PRIVATE(vec)->_field[index_b]; \
+		PRIVATE(vec)->_field[index_b] = temp; \
+	}
+
+	VECTOR_SOA_FIELDS(VECTOR_SOA_SWAP)
+
+#undef VECTOR_SOA_SWAP
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+#define VECTOR_SOA_DEFINE_COLUMN(_type, _field) \
+	VECTOR_API VECTOR_INLINE _type *VECTOR_SOA_COLUMN_FUNC(data, _field)(const VECTOR **self) \
+	{ \
+		return PRIVATE(*self)->_field; \
+	}
+
+VECTOR_SOA_FIELDS(VECTOR_SOA_DEFINE_COLUMN)
+
+#undef VECTOR_SOA_DEFINE_COLUMN
+
+
+#undef VECTOR
+#undef VECTOR_FUNC
+#undef VECTOR_SOA_COLUMN_FUNC
+#undef PRIVATE
+#undef VECTOR_MALLOC
+#undef VECTOR_REALLOC
+#undef VECTOR_FREE
+#undef VECTOR_SOA_REQUIRE
+#undef VECTOR_SOA_CHECK
+#undef VECTOR_SOA_CHECK_INDEX
+
+
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+
+#endif // T
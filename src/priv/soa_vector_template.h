@@ -0,0 +1,153 @@
+/**
+ * @file      soa_vector_template.h
+ * @brief     Template declarations for structure-of-arrays vectors
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Types initialized with VECTOR_INITIALIZE_SOA() are stored as one
+ *            contiguous column per listed field instead of an array of
+ *            structs. The generator passes the row type as T and the field
+ *            list as the X-macro VECTOR_SOA_FIELDS(_X), which expands
+ *            _X(type, name) once per field.
+ *
+ *            All columns share one size and capacity. Row-wise functions
+ *            (push_back, at, emplace_indx, insert_indx, erase_indx, ...) take
+ *            and return T and keep the columns in sync; data_<field>()
+ *            returns a column for cache-dense, vectorizable scans.
+ *
+ *            Names get the vector_soa prefix, so a type can have both an
+ *            ordinary and an SoA vector:
+ *            vector_soa_push_back_T(), vector_soa_data_<field>_T().
+ *
+ * @note      Only dynamic vectors have an SoA layout: with
+ *            VECTOR_NO_DYNAMIC_ALLOC nothing is declared for the type.
+ *
+ * @see       soa_vector_template.c
+ */
+
+#ifdef T
+
+#include "template.h"
+#include "vector_allocator.h"
+#include "vector_error.h"
+
+#include <stdbool.h>
+
+
+#ifndef VECTOR_NO_DYNAMIC_ALLOC
+
+
+#ifndef VECTOR_T
+#define VECTOR_T 				TEMPLATE(vector_soa_t, T)
+#endif // VECTOR_T
+
+#ifndef VECTOR
+#define VECTOR 					TEMPLATE(vector_soa, T)
+#endif // VECTOR
+
+#ifndef VECTOR_FUNC
+#define VECTOR_FUNC(_name) 		TEMPLATE(vector_soa, TEMPLATE(_name, T))
+#endif // VECTOR_FUNC
+
+#ifndef VECTOR_SOA_COLUMN_FUNC
+#define VECTOR_SOA_COLUMN_FUNC(_name, _field) \
+	TEMPLATE(vector_soa, TEMPLATE(TEMPLATE(_name, _field), T))
+#endif // VECTOR_SOA_COLUMN_FUNC
+
+
+typedef struct TEMPLATE(vector_soa_private_t, T) TEMPLATE(vector_soa_private, T);
+
+typedef struct VECTOR_T VECTOR;
+struct VECTOR_PACKED_STRUCT VECTOR_T
+{
+	TEMPLATE(vector_soa_private, T) *__private;
+};
+
+VECTOR_API VECTOR *VECTOR_FUNC(create_vector)(
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+	const vector_allocator_t *alloc,
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+	vector_size_t init_size,
+	T init_value,
+	vector_error_t *
+);
+VECTOR_API VECTOR *VECTOR_FUNC(copy_create_vector)(
+	const VECTOR *self,
+	vector_error_t *error
+);
+VECTOR_API void VECTOR_FUNC(destroy_vector)(VECTOR **self);
+
+/**
+ * @brief  Gather row @p index from the columns
+ */
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(at)(
+	const VECTOR **self,
+	vector_index_t index,
+	vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(back)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(capacity)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(clear)(VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(emplace_indx)(
+    VECTOR **self,
+    vector_index_t index,
+    T value,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE bool VECTOR_FUNC(empty)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(erase_indx)(
+    VECTOR **self,
+    vector_index_t index,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(front)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(insert_indx)(
+    VECTOR **self,
+    vector_index_t before,
+    T value,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(pop_back)(VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(push_back)(
+    VECTOR **self,
+    T value,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(reserve)(
+    VECTOR **self,
+    vector_size_t new_capacity,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(resize_with)(
+    VECTOR **self,
+    vector_size_t new_size,
+    T value,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(size)(const VECTOR **self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(swap_indx)(
+    VECTOR **self,
+    vector_index_t index_a,
+    vector_index_t index_b,
+    vector_error_t *error
+);
+
+/* Column accessors: _type *vector_soa_data_<field>_T(const VECTOR **self) */
+#define VECTOR_SOA_DECLARE_COLUMN(_type, _field) \
+	VECTOR_API VECTOR_INLINE _type *VECTOR_SOA_COLUMN_FUNC(data, _field)(const VECTOR **self);
+
+VECTOR_SOA_FIELDS(VECTOR_SOA_DECLARE_COLUMN)
+
+#undef VECTOR_SOA_DECLARE_COLUMN
+
+
+#undef VECTOR_T
+#undef VECTOR
+#undef VECTOR_FUNC
+#undef VECTOR_SOA_COLUMN_FUNC
+
+
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+
+#endif // T
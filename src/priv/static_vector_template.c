@@ -19,8 +19,11 @@
 #ifdef T
 
 #include "template.h"
+#include "vector_traits.h"
 #include "vector_config.h"
 #include "vector_error.h"
+#include "vector_atomic.h"
+#include "vector_simd.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -40,13 +43,157 @@
 #define VECTOR_ITERATOR		TEMPLATE(vector_iterator, T)
 #endif // VECTOR_ITERATOR
 
+#ifndef VECTOR_SPAN
+#define VECTOR_SPAN			TEMPLATE(vector_span, T)
+#endif // VECTOR_SPAN
+
+#ifndef VECTOR_SPAN_DATA
+#define VECTOR_SPAN_DATA(_span, _index) \
+	((_span).data[(size_t)(_index) * (_span).stride])
+#endif // VECTOR_SPAN_DATA
+
 
 typedef T * TEMPLATE(vector_iterator, T);
 
+/*
+ * Pool size of this type: VECTOR_INITIALIZE_TYPE_POOL() makes the generator
+ * define VECTOR_TYPE_MAX_N_VECTORS, VECTOR_TYPE_STATIC_BUFFER_SIZE and
+ * VECTOR_TYPE_POOL_PLACEMENT around the include, the global options are the
+ * defaults. These macros are per type and undefined at the end of the file.
+ */
+#ifdef VECTOR_TYPE_MAX_N_VECTORS
+#define VECTOR_N_VECTORS 		VECTOR_TYPE_MAX_N_VECTORS
+#else // VECTOR_TYPE_MAX_N_VECTORS
+#define VECTOR_N_VECTORS 		VECTOR_MAX_N_VECTORS
+#endif // VECTOR_TYPE_MAX_N_VECTORS
+
+#ifdef VECTOR_TYPE_STATIC_BUFFER_SIZE
+#define VECTOR_BUFFER_SIZE 		VECTOR_TYPE_STATIC_BUFFER_SIZE
+#else // VECTOR_TYPE_STATIC_BUFFER_SIZE
+#define VECTOR_BUFFER_SIZE 		VECTOR_STATIC_BUFFER_SIZE
+#endif // VECTOR_TYPE_STATIC_BUFFER_SIZE
+
+/* Section and alignment of the element arena, see VECTOR_SECTION() */
+#ifdef VECTOR_TYPE_POOL_PLACEMENT
+#define VECTOR_POOL_PLACEMENT 	VECTOR_TYPE_POOL_PLACEMENT
+#else // VECTOR_TYPE_POOL_PLACEMENT
+#define VECTOR_POOL_PLACEMENT
+#endif // VECTOR_TYPE_POOL_PLACEMENT
+
+/* Boundary of every buffer and pool entry, see VECTOR_STATIC_ALIGN */
+#if defined(VECTOR_TYPE_STATIC_ALIGN)
+#define VECTOR_ALIGN 			VECTOR_TYPE_STATIC_ALIGN
+#elif defined(VECTOR_STATIC_ALIGN)
+#define VECTOR_ALIGN 			VECTOR_STATIC_ALIGN
+#endif // VECTOR_TYPE_STATIC_ALIGN
+
+/*
+ * Elements per arena block. Aligned, it is raised until every block starts
+ * on VECTOR_ALIGN: the largest power of two dividing sizeof(T) (capped at
+ * VECTOR_ALIGN) is the byte step an element offset can be aligned in.
+ */
+#ifdef VECTOR_ALIGN
+#define VECTOR_SLOT_ALIGNED 	VECTOR_ALIGNED(VECTOR_ALIGN)
+#define VECTOR_ELEMENT_GRAIN \
+	((sizeof(T) & (0 - sizeof(T))) < VECTOR_ALIGN \
+		? (sizeof(T) & (0 - sizeof(T))) : VECTOR_ALIGN)
+#define VECTOR_ARENA_UNIT \
+	((vector_size_t)(VECTOR_ALIGN / VECTOR_ELEMENT_GRAIN > VECTOR_STATIC_MIN_BLOCK \
+		? VECTOR_ALIGN / VECTOR_ELEMENT_GRAIN : VECTOR_STATIC_MIN_BLOCK))
+#else // VECTOR_ALIGN
+#define VECTOR_SLOT_ALIGNED
+#define VECTOR_ARENA_UNIT 		((vector_size_t)VECTOR_STATIC_MIN_BLOCK)
+#endif // VECTOR_ALIGN
+
+/* Words of the used-slot bitmap, 32 slots per word */
+#define VECTOR_SLOT_WORDS \
+	((VECTOR_N_VECTORS + 31) / 32)
+
+
+/* Blocks of VECTOR_ARENA_UNIT elements in the element arena */
+#define VECTOR_ARENA_BLOCKS \
+	((VECTOR_N_VECTORS * VECTOR_BUFFER_SIZE) / VECTOR_ARENA_UNIT)
+
+/* Block sizes are 1 << order blocks */
+#ifndef VECTOR_ARENA_ORDERS
+#define VECTOR_ARENA_ORDERS 	32
+#endif // VECTOR_ARENA_ORDERS
+
+/* Tag bit of the first block of a free block */
+#ifndef VECTOR_ARENA_FREE
+#define VECTOR_ARENA_FREE 		0x80
+#endif // VECTOR_ARENA_FREE
+
+/* Words of the bitmap of blocks freed while the arena was held, 32 per word */
+#define VECTOR_ARENA_WORDS \
+	((VECTOR_ARENA_BLOCKS + 31) / 32)
+
+/* Free list link: block number + 1, 0 ends the list; sized for the unaligned block count */
+#if (VECTOR_N_VECTORS * VECTOR_BUFFER_SIZE) / VECTOR_STATIC_MIN_BLOCK < UINT16_MAX
+#define VECTOR_ARENA_LINK 		uint16_t
+#else // VECTOR_N_VECTORS * VECTOR_BUFFER_SIZE / VECTOR_STATIC_MIN_BLOCK < UINT16_MAX
+#define VECTOR_ARENA_LINK 		uint32_t
+#endif // VECTOR_N_VECTORS * VECTOR_BUFFER_SIZE / VECTOR_STATIC_MIN_BLOCK < UINT16_MAX
+
+/* Fails to compile when a block number + 1 does not fit VECTOR_ARENA_LINK */
+typedef char TEMPLATE(vector_arena_link_fits, T)[
+	(VECTOR_ARENA_BLOCKS <= (VECTOR_ARENA_LINK)~(VECTOR_ARENA_LINK)0) ? 1 : -1
+];
+
+/*
+ * Elements in a block of 1 << order units. Block numbers and arena offsets
+ * are uint32_t/size_t, only what a vector reports is vector_size_t: a block
+ * larger than VECTOR_INDEX_MASK holds that many elements.
+ */
+#define VECTOR_ARENA_ELEMENTS(_order) \
+	(((size_t)1 << (_order)) * VECTOR_ARENA_UNIT)
+#define VECTOR_ARENA_CAPACITY(_order) \
+	((vector_size_t)(VECTOR_ARENA_ELEMENTS(_order) < VECTOR_INDEX_MASK \
+		? VECTOR_ARENA_ELEMENTS(_order) : VECTOR_INDEX_MASK))
+
+/*
+ * The storage below is per element type: every name expands to the name
+ * suffixed with T (the macro is not re-expanded inside its own expansion).
+ */
+#ifndef __vector_pool
+#define __vector_pool 			TEMPLATE(__vector_pool, T)
+#define __vector_used 			TEMPLATE(__vector_used, T)
+#define __vector_data 			TEMPLATE(__vector_data, T)
+#define __vector_arena_head 	TEMPLATE(__vector_arena_head, T)
+#define __vector_arena_next 	TEMPLATE(__vector_arena_next, T)
+#define __vector_arena_prev 	TEMPLATE(__vector_arena_prev, T)
+#define __vector_arena_tag 		TEMPLATE(__vector_arena_tag, T)
+#define __vector_arena_orders 	TEMPLATE(__vector_arena_orders, T)
+#define __vector_arena_ready 	TEMPLATE(__vector_arena_ready, T)
+#define __vector_arena_lock 	TEMPLATE(__vector_arena_lock, T)
+#define __vector_arena_deferred TEMPLATE(__vector_arena_deferred, T)
+#define __vector_arena_pending 	TEMPLATE(__vector_arena_pending, T)
+#endif // __vector_pool
+
+
+/* Pool entry, padded to VECTOR_ALIGN so vectors never share a cache line */
+#ifndef VECTOR_POOL_ENTRY
+#define VECTOR_POOL_ENTRY 		TEMPLATE(vector_pool_entry, T)
+#endif // VECTOR_POOL_ENTRY
+
+typedef struct
+{
+	VECTOR_SLOT_ALIGNED VECTOR vector;
+} VECTOR_POOL_ENTRY;
+
+static VECTOR_POOL_ENTRY __vector_pool[VECTOR_N_VECTORS];
+static VECTOR_SLOT_ALIGNED vector_atomic_bits_t __vector_used[VECTOR_SLOT_WORDS];
+static VECTOR_POOL_PLACEMENT VECTOR_SLOT_ALIGNED T __vector_data[VECTOR_N_VECTORS * VECTOR_BUFFER_SIZE];
 
-static VECTOR __vector_pool[VECTOR_MAX_N_VECTORS];
-static bool __vector_used[VECTOR_MAX_N_VECTORS];
-static T __vector_data[VECTOR_MAX_N_VECTORS * VECTOR_STATIC_BUFFER_SIZE];
+static VECTOR_ARENA_LINK __vector_arena_head[VECTOR_ARENA_ORDERS];
+static VECTOR_ARENA_LINK __vector_arena_next[VECTOR_ARENA_BLOCKS];
+static VECTOR_ARENA_LINK __vector_arena_prev[VECTOR_ARENA_BLOCKS];
+static uint8_t __vector_arena_tag[VECTOR_ARENA_BLOCKS];
+static uint32_t __vector_arena_orders;
+static bool __vector_arena_ready;
+static VECTOR_SLOT_ALIGNED vector_atomic_bits_t __vector_arena_lock;
+static vector_atomic_bits_t __vector_arena_deferred[VECTOR_ARENA_WORDS];
+static vector_atomic_bits_t __vector_arena_pending;
 
 
 #ifdef VECTOR_CHECK_ON
@@ -65,7 +212,7 @@ static T __vector_data[VECTOR_MAX_N_VECTORS * VECTOR_STATIC_BUFFER_SIZE];
 #ifndef VECTOR_CHECK_INDEX
 #define VECTOR_CHECK_INDEX(_range, _indx, _err_ptr, _ret) \
     VECTOR_CHECK( \
-        ((_indx) >= 0) && ((vector_size_t)(_indx) < VECTOR_STATIC_BUFFER_SIZE), \
+        ((_indx) >= 0) && ((vector_size_t)(_indx) < VECTOR_SIZE(_range)), \
         _err_ptr, \
         VECTOR_ERROR_INDEX, \
         _ret \
@@ -108,6 +255,46 @@ static T __vector_data[VECTOR_MAX_N_VECTORS * VECTOR_STATIC_BUFFER_SIZE];
 	(__vector_data + (_range)->__begin_index)
 #endif // VECTOR_BEGIN
 
+#ifndef VECTOR_SIZE
+#define VECTOR_SIZE(_range) \
+	((vector_size_t)(_range)->__size)
+#endif // VECTOR_SIZE
+
+
+/*
+ * Element fill: memset for zero values of ZERO_IS_DEFAULT types and
+ * 1-byte TRIVIAL types, assignment loop otherwise.
+ */
+static VECTOR_INLINE void VECTOR_FUNC(fill)(
+	T *dst,
+	vector_size_t count,
+	T value
+)
+{
+#if VECTOR_HAS_TRAIT(ZERO_IS_DEFAULT)
+	static const T zero;
+
+	if (memcmp(&value, &zero, sizeof(T)) == 0)
+	{
+		memset(dst, 0, count * sizeof(T));
+
+		return;
+	}
+#endif // VECTOR_HAS_TRAIT(ZERO_IS_DEFAULT)
+
+#if VECTOR_HAS_TRAIT(TRIVIAL)
+	if (sizeof(T) == 1)
+	{
+		memset(dst, *(const unsigned char *)&value, count);
+
+		return;
+	}
+#endif // VECTOR_HAS_TRAIT(TRIVIAL)
+
+	for (vector_size_t i = 0; i < count; ++i)
+		dst[i] = value;
+}
+
 
 #ifndef VECTOR_LITE
 static VECTOR_INLINE void VECTOR_FUNC(assign)(
@@ -127,6 +314,8 @@ static VECTOR_INLINE T VECTOR_FUNC(at)(
 );
 static VECTOR_INLINE T VECTOR_FUNC(back)(const VECTOR *self);
 static VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(begin)(const VECTOR *self);
+static VECTOR_INLINE vector_size_t VECTOR_FUNC(capacity)(const VECTOR *self);
+static VECTOR_INLINE void VECTOR_FUNC(clear)(VECTOR *self);
 static VECTOR_INLINE T *VECTOR_FUNC(data)(const VECTOR *self);
 static VECTOR_INLINE void VECTOR_FUNC(emplace_indx)(
     VECTOR *self,
@@ -140,6 +329,7 @@ static VECTOR_INLINE void VECTOR_FUNC(emplace_it)(
     T value,
     vector_error_t *error
 );
+static VECTOR_INLINE bool VECTOR_FUNC(empty)(const VECTOR *self);
 static VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(end)(const VECTOR *self);
 static VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_not_of)(
 	const VECTOR *self,
@@ -168,6 +358,28 @@ static VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(it)(
 	vector_index_t index,
 	vector_error_t *error
 );
+static VECTOR_INLINE void VECTOR_FUNC(pop_back)(VECTOR *self);
+static VECTOR_INLINE void VECTOR_FUNC(push_back)(
+    VECTOR *self,
+    T value,
+    vector_error_t *error
+);
+static VECTOR_INLINE void VECTOR_FUNC(reserve)(
+    VECTOR *self,
+    vector_index_t new_capacity,
+    vector_error_t *error
+);
+static VECTOR_INLINE void VECTOR_FUNC(resize)(
+    VECTOR *self,
+    vector_size_t new_size,
+    vector_error_t *error
+);
+static VECTOR_INLINE void VECTOR_FUNC(resize_with)(
+    VECTOR *self,
+    vector_size_t new_size,
+    T value,
+    vector_error_t *error
+);
 static VECTOR_INLINE void VECTOR_FUNC(reverse_indx)(
     VECTOR *self,
 	vector_index_t begin_index,
@@ -196,20 +408,368 @@ static VECTOR_INLINE void VECTOR_FUNC(swap_it)(
 #endif // VECTOR_LITE
 
 
-VECTOR *VECTOR_FUNC(create_vector)(T init_value, vector_error_t *error)
+/*
+ * Element arena: a binary buddy allocator over __vector_data in blocks of
+ * VECTOR_ARENA_UNIT elements, so every vector gets a buffer of its
+ * own size instead of a fixed VECTOR_BUFFER_SIZE slice. Free blocks
+ * of each order are kept in doubly linked lists threaded through side
+ * arrays, a bit of __vector_arena_orders per non-empty list. Allocating and
+ * freeing walk at most VECTOR_ARENA_ORDERS orders, a bound fixed at compile
+ * time. That walk is the critical section of VECTOR_ARENA_LOCK(), which
+ * never waits (see vector_config.h): a block freed while the arena is held
+ * is marked in __vector_arena_deferred and given back by the holder.
+ */
+
+static void VECTOR_FUNC(arena_push)(uint32_t block, unsigned order)
+{
+	const VECTOR_ARENA_LINK head = __vector_arena_head[order];
+
+	__vector_arena_next[block] = head;
+	__vector_arena_prev[block] = 0;
+	if (head != 0)
+		__vector_arena_prev[head - 1] = (VECTOR_ARENA_LINK)(block + 1);
+
+	__vector_arena_head[order] = (VECTOR_ARENA_LINK)(block + 1);
+	__vector_arena_tag[block] = (uint8_t)(order | VECTOR_ARENA_FREE);
+	__vector_arena_orders |= (uint32_t)1 << order;
+}
+
+static void VECTOR_FUNC(arena_unlink)(uint32_t block, unsigned order)
+{
+	const VECTOR_ARENA_LINK next = __vector_arena_next[block];
+	const VECTOR_ARENA_LINK prev = __vector_arena_prev[block];
+
+	if (prev != 0)
+		__vector_arena_next[prev - 1] = next;
+	else
+		__vector_arena_head[order] = next;
+
+	if (next != 0)
+		__vector_arena_prev[next - 1] = prev;
+
+	if (__vector_arena_head[order] == 0)
+		__vector_arena_orders &= ~((uint32_t)1 << order);
+
+	__vector_arena_tag[block] = (uint8_t)order;
+}
+
+/* Cut the arena into the largest aligned power-of-two blocks */
+static void VECTOR_FUNC(arena_init)(void)
+{
+	uint32_t block = 0;
+
+	while (block < VECTOR_ARENA_BLOCKS)
+	{
+		unsigned order = 0;
+
+		while (order + 1 < VECTOR_ARENA_ORDERS
+			&& (block & (((uint32_t)1 << (order + 1)) - 1)) == 0
+			&& (size_t)block + ((size_t)1 << (order + 1)) <= VECTOR_ARENA_BLOCKS)
+			++order;
+
+		VECTOR_FUNC(arena_push)(block, order);
+		block += (uint32_t)1 << order;
+	}
+
+	__vector_arena_ready = true;
+}
+
+/* Smallest order whose blocks hold count elements */
+static unsigned VECTOR_FUNC(arena_order)(size_t count)
+{
+	const size_t blocks =
+		(count + VECTOR_ARENA_UNIT - 1) / VECTOR_ARENA_UNIT;
+	unsigned order = 0;
+
+	while (order < VECTOR_ARENA_ORDERS && ((size_t)1 << order) < blocks)
+		++order;
+
+	return order;
+}
+
+/* Take a free block of the order, splitting a larger one, or false */
+static bool VECTOR_FUNC(arena_take)(unsigned order, uint32_t *block)
+{
+	if (order >= VECTOR_ARENA_ORDERS)
+		return false;
+
+	const uint32_t fit = __vector_arena_orders & ~(((uint32_t)1 << order) - 1);
+
+	if (fit == 0)
+		return false;
+
+	unsigned from = vector_ctz32(fit);
+	const uint32_t head = (uint32_t)__vector_arena_head[from] - 1;
+
+	VECTOR_FUNC(arena_unlink)(head, from);
+
+	while (from > order)
+	{
+		--from;
+		VECTOR_FUNC(arena_push)(head + ((uint32_t)1 << from), from);
+	}
+
+	__vector_arena_tag[head] = (uint8_t)order;
+	*block = head;
+
+	return true;
+}
+
+/* Return a block, merging it with its free buddies */
+static void VECTOR_FUNC(arena_give)(uint32_t block)
+{
+	unsigned order = __vector_arena_tag[block];
+
+	while (order + 1 < VECTOR_ARENA_ORDERS)
+	{
+		const uint32_t buddy = block ^ ((uint32_t)1 << order);
+
+		if ((size_t)buddy + ((size_t)1 << order) > VECTOR_ARENA_BLOCKS
+			|| __vector_arena_tag[buddy] != (order | VECTOR_ARENA_FREE))
+			break;
+
+		VECTOR_FUNC(arena_unlink)(buddy, order);
+
+		if (buddy < block)
+			block = buddy;
+		++order;
+	}
+
+	VECTOR_FUNC(arena_push)(block, order);
+}
+
+/* Enter the arena, false when another context holds it */
+static VECTOR_INLINE bool VECTOR_FUNC(arena_lock)(VECTOR_ARENA_STATE *state)
 {
-	for (vector_index_t i = 0; i < VECTOR_MAX_STATIC_VECTORS; ++i)
+	*state = 0;
+
+	return VECTOR_ARENA_LOCK(__vector_arena_lock, *state);
+}
+
+/* Give back the blocks freed while the arena was held, then leave it */
+static void VECTOR_FUNC(arena_unlock)(VECTOR_ARENA_STATE state)
+{
+	if (vector_atomic_bits_take(&__vector_arena_pending) != 0)
+	{
+		for (uint32_t w = 0; w < VECTOR_ARENA_WORDS; ++w)
+		{
+			uint32_t blocks = vector_atomic_bits_take(&__vector_arena_deferred[w]);
+
+			while (blocks != 0)
+			{
+				VECTOR_FUNC(arena_give)(w * 32 + vector_ctz32(blocks));
+				blocks &= blocks - 1;
+			}
+		}
+	}
+
+	VECTOR_ARENA_UNLOCK(__vector_arena_lock, state);
+}
+
+/* Return a block now, or leave it to the holder of the arena */
+static void VECTOR_FUNC(arena_release)(uint32_t block)
+{
+	VECTOR_ARENA_STATE state;
+
+	if (VECTOR_FUNC(arena_lock)(&state))
 	{
-	    if (!__vector_used[i])
-	    {
-	        __vector_used[i] = true;
-	        VECTOR *new_vec = &__vector_pool[i];
-	        *new_vec = (VECTOR){ 
-				.__begin_index = i * VECTOR_MAX_STATIC_VECTORS 
-			};
+		VECTOR_FUNC(arena_give)(block);
+		VECTOR_FUNC(arena_unlock)(state);
+
+		return;
+	}
+
+	vector_atomic_bits_set(&__vector_arena_deferred[block / 32], (uint32_t)1 << (block % 32));
+	vector_atomic_bits_set(&__vector_arena_pending, 1);
+}
+
+/* Buffer of at least count elements for self, false when the arena is full or held */
+static bool VECTOR_FUNC(arena_alloc)(VECTOR *self, vector_size_t count)
+{
+	const unsigned order = VECTOR_FUNC(arena_order)(count);
+	VECTOR_ARENA_STATE state;
+	uint32_t block;
+
+	if (!VECTOR_FUNC(arena_lock)(&state))
+		return false;
+
+	if (!__vector_arena_ready)
+		VECTOR_FUNC(arena_init)();
+
+	const bool taken = VECTOR_FUNC(arena_take)(order, &block);
+
+	VECTOR_FUNC(arena_unlock)(state);
+
+	if (!taken)
+		return false;
+
+	self->__begin_index = (size_t)block * VECTOR_ARENA_UNIT;
+	self->__capacity = VECTOR_ARENA_CAPACITY(order);
+
+	return true;
+}
+
+static void VECTOR_FUNC(arena_free)(VECTOR *self)
+{
+	VECTOR_FUNC(arena_release)((uint32_t)(self->__begin_index / VECTOR_ARENA_UNIT));
+
+	self->__capacity = 0;
+	self->__size = 0;
+}
+
+/*
+ * Grow the buffer of self to count elements: in place when the buddies
+ * after it are free, otherwise the live elements move into a new block and
+ * the old one is freed. count is a size_t so capacity + 1 does not wrap.
+ */
+static bool VECTOR_FUNC(arena_grow)(VECTOR *self, size_t count)
+{
+	const unsigned order = VECTOR_FUNC(arena_order)(count);
+	const uint32_t block = (uint32_t)(self->__begin_index / VECTOR_ARENA_UNIT);
+	uint32_t moved;
 
-	        for (vector_index_t j = 0; j < VECTOR_STATIC_BUFFER_SIZE; ++j)
-				VECTOR_DATA(new_vec, j) = init_value;
+	if (count > VECTOR_INDEX_MASK || order >= VECTOR_ARENA_ORDERS)
+		return false;
+
+	VECTOR_ARENA_STATE state;
+
+	if (!VECTOR_FUNC(arena_lock)(&state))
+		return false;
+
+	unsigned have = __vector_arena_tag[block];
+
+	/* Check the whole chain first: a partial merge would leak the buddies */
+	unsigned reach = have;
+
+	while (reach < order)
+	{
+		const uint32_t buddy = block ^ ((uint32_t)1 << reach);
+
+		if (buddy < block
+			|| (size_t)buddy + ((size_t)1 << reach) > VECTOR_ARENA_BLOCKS
+			|| __vector_arena_tag[buddy] != (reach | VECTOR_ARENA_FREE))
+			break;
+
+		++reach;
+	}
+
+	if (reach == order)
+	{
+		for (; have < order; ++have)
+			VECTOR_FUNC(arena_unlink)(block ^ ((uint32_t)1 << have), have);
+
+		__vector_arena_tag[block] = (uint8_t)order;
+		VECTOR_FUNC(arena_unlock)(state);
+
+		self->__capacity = VECTOR_ARENA_CAPACITY(order);
+
+		return true;
+	}
+
+	if (!VECTOR_FUNC(arena_take)(order, &moved))
+	{
+		VECTOR_FUNC(arena_unlock)(state);
+
+		return false;
+	}
+
+	VECTOR_FUNC(arena_unlock)(state);
+
+	memcpy(
+		__vector_data + (size_t)moved * VECTOR_ARENA_UNIT,
+		VECTOR_BEGIN(self),
+		VECTOR_SIZE(self) * sizeof(T)
+	);
+
+	VECTOR_FUNC(arena_release)(block);
+
+	self->__begin_index = (size_t)moved * VECTOR_ARENA_UNIT;
+	self->__capacity = VECTOR_ARENA_CAPACITY(order);
+
+	return true;
+}
+
+/*
+ * Claim a free slot of the pool: the first clear bit of the used bitmap is
+ * found with one ctz per word and set with a compare-and-swap, retried when
+ * another context changed the word in between. Lock-free, and the arena
+ * block taken next never waits either: a create from an interrupt handler
+ * that finds the arena held fails with VECTOR_ERROR_NO_FREE_VECTOR.
+ */
+static vector_index_t VECTOR_FUNC(claim_slot)(void)
+{
+	for (vector_index_t w = 0; w < VECTOR_SLOT_WORDS; ++w)
+	{
+		const vector_index_t first = w * 32;
+		const uint32_t valid = (VECTOR_N_VECTORS - first >= 32)
+			? UINT32_MAX
+			: ((uint32_t)1 << (VECTOR_N_VECTORS - first)) - 1;
+		uint32_t used = vector_atomic_bits_load(&__vector_used[w]);
+
+		while ((~used & valid) != 0)
+		{
+			const unsigned bit = vector_ctz32(~used & valid);
+
+			if (vector_atomic_bits_cas(&__vector_used[w], used, used | ((uint32_t)1 << bit)))
+				return first + bit;
+
+			used = vector_atomic_bits_load(&__vector_used[w]);
+		}
+	}
+
+	return VECTOR_INVALID_INDEX;
+}
+
+/* Hand a claimed slot back to the pool */
+static VECTOR_INLINE void VECTOR_FUNC(release_slot)(vector_index_t i)
+{
+	vector_atomic_bits_clear(&__vector_used[i / 32], (uint32_t)1 << (i % 32));
+}
+
+VECTOR_API VECTOR *VECTOR_FUNC(create_vector)(
+	vector_size_t init_size,
+	T init_value,
+	vector_error_t *error
+)
+{
+	return VECTOR_FUNC(create_vector_capacity)(
+		init_size,
+		init_size,
+		init_value,
+		error
+	);
+}
+
+VECTOR_API VECTOR *VECTOR_FUNC(create_vector_capacity)(
+	vector_size_t capacity,
+	vector_size_t init_size,
+	T init_value,
+	vector_error_t *error
+)
+{
+	if (capacity < init_size)
+		capacity = init_size;
+
+	const vector_index_t i = VECTOR_FUNC(claim_slot)();
+
+	if (i != VECTOR_INVALID_INDEX)
+	{
+	        VECTOR *new_vec = &__vector_pool[i].vector;
+	        *new_vec = (VECTOR){ 0 };
+
+	        if (!VECTOR_FUNC(arena_alloc)(new_vec, capacity))
+	        {
+	        	VECTOR_FUNC(release_slot)(i);
+
+	        	if (error)
+	        		*error = VECTOR_ERROR_NO_FREE_VECTOR;
+
+	        	return NULL;
+	        }
+
+	        /* Only the live elements are written */
+	        new_vec->__size = init_size;
+	        VECTOR_FUNC(fill)(VECTOR_BEGIN(new_vec), init_size, init_value);
 
 #ifndef VECTOR_LITE
 			new_vec->assign = VECTOR_FUNC(assign);
@@ -217,9 +777,12 @@ VECTOR *VECTOR_FUNC(create_vector)(T init_value, vector_error_t *error)
 			new_vec->at = VECTOR_FUNC(at);
 			new_vec->back = VECTOR_FUNC(back);
 			new_vec->begin = VECTOR_FUNC(begin);
+			new_vec->capacity = VECTOR_FUNC(capacity);
+			new_vec->clear = VECTOR_FUNC(clear);
 			new_vec->data = VECTOR_FUNC(data);
 			new_vec->emplace_indx = VECTOR_FUNC(emplace_indx);
 			new_vec->emplace_it = VECTOR_FUNC(emplace_it);
+			new_vec->empty = VECTOR_FUNC(empty);
 			new_vec->end = VECTOR_FUNC(end);
 			new_vec->find_first_not_of = VECTOR_FUNC(find_first_not_of);
 			new_vec->find_last_not_of = VECTOR_FUNC(find_last_not_of);
@@ -228,6 +791,11 @@ VECTOR *VECTOR_FUNC(create_vector)(T init_value, vector_error_t *error)
 			new_vec->front = VECTOR_FUNC(front);
 			new_vec->indx = VECTOR_FUNC(indx);
 			new_vec->it = VECTOR_FUNC(it);
+			new_vec->pop_back = VECTOR_FUNC(pop_back);
+			new_vec->push_back = VECTOR_FUNC(push_back);
+			new_vec->reserve = VECTOR_FUNC(reserve);
+			new_vec->resize = VECTOR_FUNC(resize);
+			new_vec->resize_with = VECTOR_FUNC(resize_with);
 			new_vec->reverse_indx = VECTOR_FUNC(reverse_indx);
 			new_vec->reverse_it = VECTOR_FUNC(reverse_it);
 			new_vec->size = VECTOR_FUNC(size);
@@ -236,10 +804,9 @@ VECTOR *VECTOR_FUNC(create_vector)(T init_value, vector_error_t *error)
 #endif // VECTOR_LITE
 
 	        if (error)
-	        	*error = VECTOR_SUCCESS;
+	        	*error = VECTOR_ERROR_SUCCESS;
 
 	        return new_vec;
-	    }
 	}
 
 	if (error)
@@ -248,29 +815,36 @@ VECTOR *VECTOR_FUNC(create_vector)(T init_value, vector_error_t *error)
 	return NULL;
 }
 
-VECTOR *VECTOR_FUNC(copy_create_vector)(
+VECTOR_API VECTOR *VECTOR_FUNC(copy_create_vector)(
 	const VECTOR *other,
 	vector_error_t *error
 )
 {
 	VECTOR_CHECK_INPUT_RANGE(other, error, NULL)
 
-	for (vector_index_t i = 0; i < VECTOR_MAX_STATIC_VECTORS; ++i)
+	const vector_index_t i = VECTOR_FUNC(claim_slot)();
+
+	if (i != VECTOR_INVALID_INDEX)
 	{
-	    if (!__vector_used[i])
-	    {
-	        __vector_used[i] = true;
-			
-	        VECTOR *new_vec = &__vector_pool[i];
-	        (*new_vec) = (VECTOR){ 
-				.__begin_index = i * VECTOR_MAX_STATIC_VECTORS 
-			};
+	        VECTOR *new_vec = &__vector_pool[i].vector;
+	        (*new_vec) = (VECTOR){ 0 };
+
+	        if (!VECTOR_FUNC(arena_alloc)(new_vec, VECTOR_SIZE(other)))
+	        {
+	        	VECTOR_FUNC(release_slot)(i);
+
+	        	if (error)
+	        		*error = VECTOR_ERROR_NO_FREE_VECTOR;
+
+	        	return NULL;
+	        }
 
 	    	memcpy(
-				VECTOR_BEGIN(new_vec)
+				VECTOR_BEGIN(new_vec),
 				VECTOR_BEGIN(other),
-				VECTOR_STATIC_BUFFER_SIZE
+				VECTOR_SIZE(other) * sizeof(T)
 	    	);
+	    	new_vec->__size = VECTOR_SIZE(other);
 
 #ifndef VECTOR_LITE
 			new_vec->assign = other->assign;
@@ -278,9 +852,12 @@ VECTOR *VECTOR_FUNC(copy_create_vector)(
 			new_vec->at = other->at;
 			new_vec->back = other->back;
 			new_vec->begin = other->begin;
+			new_vec->capacity = other->capacity;
+			new_vec->clear = other->clear;
 			new_vec->data = other->data;
 			new_vec->emplace_indx = other->emplace_indx;
 			new_vec->emplace_it = other->emplace_it;
+			new_vec->empty = other->empty;
 			new_vec->end = other->end;
 			new_vec->find_first_not_of = other->find_first_not_of;
 			new_vec->find_last_not_of = other->find_last_not_of;
@@ -289,6 +866,11 @@ VECTOR *VECTOR_FUNC(copy_create_vector)(
 			new_vec->front = other->front;
 			new_vec->indx = other->indx;
 			new_vec->it = other->it;
+			new_vec->pop_back = other->pop_back;
+			new_vec->push_back = other->push_back;
+			new_vec->reserve = other->reserve;
+			new_vec->resize = other->resize;
+			new_vec->resize_with = other->resize_with;
 			new_vec->reverse_indx = other->reverse_indx;
 			new_vec->reverse_it = other->reverse_it;
 			new_vec->size = other->size;
@@ -297,10 +879,9 @@ VECTOR *VECTOR_FUNC(copy_create_vector)(
 #endif // VECTOR_LITE
 
 			if (error)
-				*error = VECTOR_SUCCESS;
+				*error = VECTOR_ERROR_SUCCESS;
 
 			return new_vec;
-		}
 	}
 
 	if (error)
@@ -309,7 +890,7 @@ VECTOR *VECTOR_FUNC(copy_create_vector)(
 	return NULL;
 }
 
-VECTOR *VECTOR_FUNC(move_create_vector)(
+VECTOR_API VECTOR *VECTOR_FUNC(move_create_vector)(
 	VECTOR *other,
 	vector_error_t *error
 )
@@ -317,17 +898,113 @@ VECTOR *VECTOR_FUNC(move_create_vector)(
 	VECTOR_CHECK_INPUT_RANGE(other, error, NULL)
 
 	if (error)
-		*error = VECTOR_SUCCESS;
+		*error = VECTOR_ERROR_SUCCESS;
 
 	return other;
 }
 
-void VECTOR_FUNC(destroy_vector)(VECTOR *self)
+VECTOR_API void VECTOR_FUNC(destroy_vector)(VECTOR *self)
 {
 	if (self == NULL)
 		return;
 
-	__vector_used[self->__begin_index] = false;
+	VECTOR_FUNC(arena_free)(self);
+	VECTOR_FUNC(release_slot)((vector_index_t)((VECTOR_POOL_ENTRY *)self - __vector_pool));
+}
+
+VECTOR_API size_t VECTOR_FUNC(static_footprint)(void)
+{
+	return sizeof(__vector_pool) + sizeof(__vector_used) + sizeof(__vector_data)
+		+ sizeof(__vector_arena_head) + sizeof(__vector_arena_next)
+		+ sizeof(__vector_arena_prev) + sizeof(__vector_arena_tag)
+		+ sizeof(__vector_arena_orders) + sizeof(__vector_arena_ready)
+		+ sizeof(__vector_arena_lock) + sizeof(__vector_arena_deferred)
+		+ sizeof(__vector_arena_pending);
+}
+
+VECTOR_API void VECTOR_FUNC(assign_span)(
+	VECTOR *self,
+	VECTOR_SPAN span,
+	vector_error_t *error
+)
+{
+	const vector_size_t size = self->__size;
+	vector_error_t status = VECTOR_ERROR_SUCCESS;
+
+	if (span.size > self->__capacity && !VECTOR_FUNC(arena_grow)(self, span.size))
+	{
+		if (error != NULL)
+			*error = VECTOR_ERROR_CAPACITY;
+
+		return;
+	}
+
+	/* Written as an overwrite of the front, then the size follows the span */
+	if (span.size > size)
+		self->__size = span.size;
+
+	VECTOR_FUNC(emplace_span_indx)(self, 0, span, &status);
+
+	self->__size = (status == VECTOR_ERROR_SUCCESS) ? span.size : size;
+
+	if (error != NULL)
+		*error = status;
+}
+
+VECTOR_API void VECTOR_FUNC(emplace_span_indx)(
+	VECTOR *self,
+	vector_index_t index,
+	VECTOR_SPAN span,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(
+		(index >= 0) && ((vector_size_t)index + span.size <= VECTOR_SIZE(self)),
+		error,
+		VECTOR_ERROR_INDEX,
+	)
+
+	if (span.stride == 1)
+		memmove(VECTOR_BEGIN(self) + index, span.data, span.size * sizeof(T));
+	else if (span.data + (size_t)span.size * span.stride <= VECTOR_BEGIN(self)
+		|| span.data >= VECTOR_BEGIN(self) + VECTOR_SIZE(self))
+	{
+		for (vector_size_t i = 0; i < span.size; ++i)
+			VECTOR_DATA(self, index + i) = VECTOR_SPAN_DATA(span, i);
+	}
+	else if (span.stride == 0)
+		VECTOR_FUNC(fill)(VECTOR_BEGIN(self) + index, span.size, *span.data);
+	else
+	{
+		/*
+		 * The span points into the buffer. Element i lands lag slots after
+		 * span.data and is read from i * stride, so writing slot i clobbers
+		 * element (i + lag) / stride. That element is still unread going
+		 * forwards only when i * (stride - 1) < lag: copy the elements from
+		 * split on forwards, then the ones below it backwards. No scratch
+		 * buffer, so the span may be as long as the vector.
+		 */
+		T *const dst = VECTOR_BEGIN(self) + index;
+		const ptrdiff_t lag = dst - span.data;
+		vector_size_t split = 0;
+
+		if (lag > 0)
+		{
+			const size_t step = (size_t)span.stride - 1;
+			const size_t first = ((size_t)lag + step - 1) / step;
+
+			split = (first < span.size) ? (vector_size_t)first : span.size;
+		}
+
+		for (vector_size_t i = split; i < span.size; ++i)
+			dst[i] = VECTOR_SPAN_DATA(span, i);
+
+		for (vector_size_t i = split; i-- > 0;)
+			dst[i] = VECTOR_SPAN_DATA(span, i);
+	}
+
+	if (error != NULL)
+		(*error) = VECTOR_ERROR_SUCCESS;
 }
 
 
@@ -337,8 +1014,7 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(assign)(
 	vector_error_t *error
 )
 {
-    for (vector_index_t i = 0; i < VECTOR_STATIC_BUFFER_SIZE; ++i)
-		VECTOR_DATA(self, i) = value;
+    VECTOR_FUNC(fill)(VECTOR_BEGIN(self), VECTOR_SIZE(self), value);
 
 	if (error != NULL)
 		(*error) = VECTOR_ERROR_SUCCESS;
@@ -352,14 +1028,11 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(assign_range)(
 {
 	VECTOR_CHECK_INPUT_RANGE(range, error, )
 
-	memcpy(
-		VECTOR_BEGIN(self),
-		VECTOR_BEGIN(range),
-		VECTOR_STATIC_BUFFER_SIZE
+	VECTOR_FUNC(assign_span)(
+		self,
+		TEMPLATE(vector_span, TEMPLATE(from, T))(VECTOR_BEGIN(range), VECTOR_SIZE(range)),
+		error
 	);
-
-	if (error != NULL)
-		(*error) = VECTOR_ERROR_SUCCESS;
 }
 
 VECTOR_STATIC VECTOR_INLINE T VECTOR_FUNC(at)(
@@ -368,7 +1041,7 @@ VECTOR_STATIC VECTOR_INLINE T VECTOR_FUNC(at)(
 	vector_error_t *error
 )
 {
-	VECTOR_CHECK_INDEX(self, index, error, (T)0)
+	VECTOR_CHECK_INDEX(self, index, error, (T){0})
 
 	if (error != NULL)
 		(*error) = VECTOR_ERROR_SUCCESS;
@@ -378,7 +1051,7 @@ VECTOR_STATIC VECTOR_INLINE T VECTOR_FUNC(at)(
 
 VECTOR_STATIC VECTOR_INLINE T VECTOR_FUNC(back)(const VECTOR *self)
 {
-	return VECTOR_DATA(self, VECTOR_STATIC_BUFFER_SIZE - 1);
+	return VECTOR_DATA(self, VECTOR_SIZE(self) - 1);
 }
 
 VECTOR_STATIC VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(begin)(const VECTOR *self)
@@ -386,6 +1059,16 @@ VECTOR_STATIC VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(begin)(const VECTOR *sel
     return VECTOR_BEGIN(self);
 }
 
+VECTOR_STATIC VECTOR_INLINE vector_size_t VECTOR_FUNC(capacity)(const VECTOR *self)
+{
+	return self->__capacity;
+}
+
+VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(clear)(VECTOR *self)
+{
+	self->__size = 0;
+}
+
 VECTOR_STATIC VECTOR_INLINE T *VECTOR_FUNC(data)(const VECTOR *self)
 {
 	return VECTOR_BEGIN(self);
@@ -421,9 +1104,14 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(emplace_it)(
 	);
 }
 
+VECTOR_STATIC VECTOR_INLINE bool VECTOR_FUNC(empty)(const VECTOR *self)
+{
+	return VECTOR_SIZE(self) == 0;
+}
+
 VECTOR_STATIC VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(end)(const VECTOR *self)
 {
-	return VECTOR_BEGIN(self) + VECTOR_STATIC_BUFFER_SIZE;
+	return VECTOR_BEGIN(self) + VECTOR_SIZE(self);
 }
 
 VECTOR_STATIC VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_not_of)(
@@ -431,8 +1119,8 @@ VECTOR_STATIC VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_not_of)(
 	T value
 )
 {
-    for (vector_index_t i = 0; i < VECTOR_STATIC_BUFFER_SIZE; ++i)
-        if (VECTOR_DATA(self, i) != value)
+    for (vector_index_t i = 0; i < VECTOR_SIZE(self); ++i)
+        if (!VECTOR_EQ(VECTOR_DATA(self, i), value))
             return i;
 
     return VECTOR_INVALID_INDEX;
@@ -443,8 +1131,8 @@ VECTOR_STATIC VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_not_of)(
 	T value
 )
 {
-    for (vector_index_t i = VECTOR_STATIC_BUFFER_SIZE - 1; i >= 0; --i)
-        if (VECTOR_DATA(self, i) != value)
+    for (vector_index_t i = (vector_index_t)VECTOR_SIZE(self) - 1; i >= 0; --i)
+        if (!VECTOR_EQ(VECTOR_DATA(self, i), value))
             return i;
 
     return VECTOR_INVALID_INDEX;
@@ -455,8 +1143,23 @@ VECTOR_STATIC VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_of)(
 	T value
 )
 {
-    for (vector_index_t i = 0; i < VECTOR_STATIC_BUFFER_SIZE; ++i)
-        if (VECTOR_DATA(self, i) == value)
+#if VECTOR_HAS_TRAIT(BITWISE_EQ) && !defined(VECTOR_HOOK_EQUAL)
+	if (sizeof(T) == 1)
+	{
+		const T *hit = (const T *)memchr(
+			VECTOR_BEGIN(self),
+			*(const unsigned char *)&value,
+			VECTOR_SIZE(self)
+		);
+
+		return (hit != NULL)
+			? (vector_index_t)(hit - VECTOR_BEGIN(self))
+			: VECTOR_INVALID_INDEX;
+	}
+#endif // BITWISE_EQ && !VECTOR_HOOK_EQUAL
+
+    for (vector_index_t i = 0; i < VECTOR_SIZE(self); ++i)
+        if (VECTOR_EQ(VECTOR_DATA(self, i), value))
             return i;
 
     return VECTOR_INVALID_INDEX;
@@ -467,8 +1170,8 @@ VECTOR_STATIC VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_of)(
 	T value
 )
 {
-	for (vector_index_t i = VECTOR_STATIC_BUFFER_SIZE - 1; i >= 0; --i)
-        if (VECTOR_DATA(self, i) == value)
+	for (vector_index_t i = (vector_index_t)VECTOR_SIZE(self) - 1; i >= 0; --i)
+        if (VECTOR_EQ(VECTOR_DATA(self, i), value))
             return i;
 
     return VECTOR_INVALID_INDEX;
@@ -510,6 +1213,133 @@ VECTOR_STATIC VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(it)(
 	return VECTOR_BEGIN(self) + index;
 }
 
+VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(pop_back)(VECTOR *self)
+{
+	if (self->__size > 0)
+		--self->__size;
+}
+
+VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(push_back)(
+	VECTOR *self,
+	T value,
+	vector_error_t *error
+)
+{
+	/* A full block grows to the next order, i.e. doubles */
+	if (VECTOR_UNLIKELY(self->__size == self->__capacity)
+		&& !VECTOR_FUNC(arena_grow)(self, (size_t)self->__capacity + 1))
+	{
+		if (error != NULL)
+			*error = VECTOR_ERROR_CAPACITY;
+
+		return;
+	}
+
+	VECTOR_DATA(self, self->__size) = value;
+	++self->__size;
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+/* Unchecked fast paths: no error parameter, no checks */
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(at_unchecked)(
+	const VECTOR *self,
+	vector_index_t index
+)
+{
+	return VECTOR_DATA(self, index);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(emplace_indx_unchecked)(
+	VECTOR *self,
+	vector_index_t index,
+	T value
+)
+{
+	VECTOR_DATA(self, index) = value;
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(pop_back_unchecked)(VECTOR *self)
+{
+	--self->__size;
+}
+
+VECTOR_API VECTOR_INLINE bool VECTOR_FUNC(push_back_unchecked)(VECTOR *self, T value)
+{
+	if (VECTOR_UNLIKELY(self->__size == self->__capacity)
+		&& !VECTOR_FUNC(arena_grow)(self, (size_t)self->__capacity + 1))
+		return false;
+
+	VECTOR_DATA(self, self->__size) = value;
+	++self->__size;
+
+	return true;
+}
+
+VECTOR_API VECTOR_INLINE T *VECTOR_FUNC(view)(const VECTOR *self, vector_size_t *size)
+{
+	*size = VECTOR_SIZE(self);
+
+	return VECTOR_BEGIN(self);
+}
+
+VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(reserve)(
+	VECTOR *self,
+	vector_index_t new_capacity,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(new_capacity >= 0, error, VECTOR_ERROR_CAPACITY, )
+
+	if ((size_t)new_capacity > self->__capacity
+		&& !VECTOR_FUNC(arena_grow)(self, (size_t)new_capacity))
+	{
+		if (error != NULL)
+			*error = VECTOR_ERROR_CAPACITY;
+
+		return;
+	}
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(resize)(
+	VECTOR *self,
+	vector_size_t new_size,
+	vector_error_t *error
+)
+{
+	static const T zero;
+
+	VECTOR_FUNC(resize_with)(self, new_size, zero, error);
+}
+
+VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(resize_with)(
+	VECTOR *self,
+	vector_size_t new_size,
+	T value,
+	vector_error_t *error
+)
+{
+	if (new_size > self->__capacity && !VECTOR_FUNC(arena_grow)(self, new_size))
+	{
+		if (error != NULL)
+			*error = VECTOR_ERROR_CAPACITY;
+
+		return;
+	}
+
+	if (new_size > self->__size)
+		VECTOR_FUNC(fill)(VECTOR_BEGIN(self) + self->__size, new_size - self->__size, value);
+
+	self->__size = new_size;
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
 VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(reverse_indx)(
 	VECTOR *self,
 	vector_index_t begin_index,
@@ -562,7 +1392,7 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(reverse_it)(
 
 VECTOR_STATIC VECTOR_INLINE vector_size_t VECTOR_FUNC(size)(const VECTOR *self)
 {
-    return VECTOR_STATIC_BUFFER_SIZE;
+    return VECTOR_SIZE(self);
 }
 
 VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(swap_indx)(
@@ -610,7 +1440,24 @@ VECTOR_STATIC VECTOR_INLINE void VECTOR_FUNC(swap_it)(
 #undef VECTOR
 #undef VECTOR_FUNC
 #undef VECTOR_ITERATOR
+#undef VECTOR_SPAN
 #undef PRIVATE
+#undef VECTOR_EQ
+#undef VECTOR_LESS
+#undef VECTOR_N_VECTORS
+#undef VECTOR_BUFFER_SIZE
+#undef VECTOR_POOL_PLACEMENT
+#undef VECTOR_SLOT_WORDS
+#undef VECTOR_ARENA_BLOCKS
+#undef VECTOR_ARENA_WORDS
+#undef VECTOR_ARENA_LINK
+#undef VECTOR_ARENA_ELEMENTS
+#undef VECTOR_ARENA_CAPACITY
+#undef VECTOR_ALIGN
+#undef VECTOR_SLOT_ALIGNED
+#undef VECTOR_ELEMENT_GRAIN
+#undef VECTOR_ARENA_UNIT
+#undef VECTOR_POOL_ENTRY
 
 
 #endif // T
@@ -5,9 +5,6 @@
  *      Author: Terentev
  */
 
-#ifndef __STATIC_VECTOR_TEMPLATE_H__
-#define __STATIC_VECTOR_TEMPLATE_H__
-
 #ifdef T
 
 #include "template.h"
@@ -15,6 +12,7 @@
 #include "vector_error.h"
 
 #include <stdbool.h>
+#include <stddef.h>
 
 
 #ifndef VECTOR_T
@@ -33,6 +31,10 @@
 #define VECTOR_ITERATOR 		TEMPLATE(vector_iterator, T)
 #endif // VECTOR_ITERATOR
 
+#ifndef VECTOR_SPAN
+#define VECTOR_SPAN 			TEMPLATE(vector_span, T)
+#endif // VECTOR_SPAN
+
 
 typedef T * TEMPLATE(vector_iterator, T);
 
@@ -47,6 +49,8 @@ struct VECTOR_T VECTOR_PACKED_STRUCT
     T (*at)(const VECTOR *, vector_index_t, vector_error_t *);
     T (*back)(const VECTOR *);
     VECTOR_ITERATOR (*begin)(const VECTOR *);
+    vector_size_t (*capacity)(const VECTOR *);
+    void (*clear)(VECTOR *);
     T *(*data)(const VECTOR *);
    void (*emplace_indx)(
 		VECTOR *, 
@@ -60,6 +64,7 @@ struct VECTOR_T VECTOR_PACKED_STRUCT
 		T,
 		vector_error_t *
 	);
+    bool (*empty)(const VECTOR *);
     VECTOR_ITERATOR (*end)(const VECTOR *);
 	vector_index_t (*find_first_not_of)(const VECTOR *, T);
 	vector_index_t (*find_last_not_of)(const VECTOR *, T);
@@ -76,6 +81,11 @@ struct VECTOR_T VECTOR_PACKED_STRUCT
 		vector_index_t,
 		vector_error_t *
 	);
+    void (*pop_back)(VECTOR *);
+    void (*push_back)(VECTOR *, T, vector_error_t *);
+    void (*reserve)(VECTOR *, vector_index_t, vector_error_t *);
+    void (*resize)(VECTOR *, vector_size_t, vector_error_t *);
+    void (*resize_with)(VECTOR *, vector_size_t, T, vector_error_t *);
     void (*reverse_indx)(
     	VECTOR *,
 		vector_index_t,
@@ -103,99 +113,205 @@ struct VECTOR_T VECTOR_PACKED_STRUCT
 	);
 #endif // VECTOR_LITE
 
-    const uint64_t __begin_index;
+    size_t __begin_index;
+    vector_size_t __capacity;
+    vector_size_t __size;
 };
 
-VECTOR *VECTOR_FUNC(create_vector)(T init_value, vector_error_t *error);
-VECTOR *VECTOR_FUNC(copy_create_vector)(
+/**
+ * @brief  Create a vector of @p init_size elements set to @p init_value
+ *
+ * Only the @p init_size elements are written.
+ */
+VECTOR_API VECTOR *VECTOR_FUNC(create_vector)(
+	vector_size_t init_size,
+	T init_value,
+	vector_error_t *error
+);
+/**
+ * @brief  create_vector() with room for @p capacity elements
+ *
+ * The buffer is a block of the static arena: @p capacity is rounded up to
+ * VECTOR_STATIC_MIN_BLOCK times a power of two. VECTOR_ERROR_NO_FREE_VECTOR
+ * when no slot or no block of that size is free.
+ */
+VECTOR_API VECTOR *VECTOR_FUNC(create_vector_capacity)(
+	vector_size_t capacity,
+	vector_size_t init_size,
+	T init_value,
+	vector_error_t *error
+);
+VECTOR_API VECTOR *VECTOR_FUNC(copy_create_vector)(
 	const VECTOR *self,
 	vector_error_t *error
 );
-VECTOR *VECTOR_FUNC(move_create_vector)(
+VECTOR_API VECTOR *VECTOR_FUNC(move_create_vector)(
+	VECTOR *self,
+	vector_error_t *error
+);
+VECTOR_API void VECTOR_FUNC(destroy_vector)(VECTOR *self);
+/**
+ * @brief  Bytes of static storage of this type (slots, arena, free lists)
+ */
+VECTOR_API size_t VECTOR_FUNC(static_footprint)(void);
+
+/**
+ * @brief  Replace the elements with the elements of @p span
+ */
+VECTOR_API void VECTOR_FUNC(assign_span)(
 	VECTOR *self,
+	VECTOR_SPAN span,
+	vector_error_t *error
+);
+/**
+ * @brief  Overwrite the elements from @p index with the elements of @p span
+ */
+VECTOR_API void VECTOR_FUNC(emplace_span_indx)(
+	VECTOR *self,
+	vector_index_t index,
+	VECTOR_SPAN span,
 	vector_error_t *error
 );
-void VECTOR_FUNC(destroy_vector)(VECTOR *self);
+
+/*
+ * Unchecked variants for inner loops: no error parameter and no checks
+ * even with VECTOR_CHECK_ON. The index must be valid and pop_back needs a
+ * non-empty vector; keep the checked functions for boundary code.
+ */
+/**
+ * @brief  Element at @p index
+ */
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(at_unchecked)(
+	const VECTOR *self,
+	vector_index_t index
+);
+/**
+ * @brief  Overwrite the element at @p index
+ */
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(emplace_indx_unchecked)(
+	VECTOR *self,
+	vector_index_t index,
+	T value
+);
+/**
+ * @brief  Remove the last element
+ */
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(pop_back_unchecked)(VECTOR *self);
+/**
+ * @brief  Append @p value, false only when the arena has no larger block
+ */
+VECTOR_API VECTOR_INLINE bool VECTOR_FUNC(push_back_unchecked)(VECTOR *self, T value);
+/**
+ * @brief  Element buffer, its size stored in @p size
+ *
+ * data() and size() in one call, used by the VECTOR_EACH loops.
+ */
+VECTOR_API VECTOR_INLINE T *VECTOR_FUNC(view)(const VECTOR *self, vector_size_t *size);
 
 #ifdef VECTOR_LITE
-VECTOR_INLINE void VECTOR_FUNC(assign)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(assign)(
     VECTOR *self,
     T value,
     vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(assign_range)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(assign_range)(
     VECTOR *self,
     const VECTOR *range,
     vector_error_t *error
 );
-VECTOR_INLINE T VECTOR_FUNC(at)(
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(at)(
 	const VECTOR *self,
 	vector_index_t index,
 	vector_error_t *error
 );
-VECTOR_INLINE T VECTOR_FUNC(back)(const VECTOR *self);
-VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(begin)(const VECTOR *self);
-VECTOR_INLINE T *VECTOR_FUNC(data)(const VECTOR *self);
-VECTOR_INLINE void VECTOR_FUNC(emplace_indx)(
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(back)(const VECTOR *self);
+VECTOR_API VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(begin)(const VECTOR *self);
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(capacity)(const VECTOR *self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(clear)(VECTOR *self);
+VECTOR_API VECTOR_INLINE T *VECTOR_FUNC(data)(const VECTOR *self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(emplace_indx)(
     VECTOR *self,
 	vector_index_t index,
     T value,
     vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(emplace_it)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(emplace_it)(
     VECTOR *self,
     const VECTOR_ITERATOR it,
     T value,
     vector_error_t *error
 );
-VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(end)(const VECTOR *self);
-VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_not_of)(
+VECTOR_API VECTOR_INLINE bool VECTOR_FUNC(empty)(const VECTOR *self);
+VECTOR_API VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(end)(const VECTOR *self);
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_not_of)(
 	const VECTOR *self,
 	T value
 );
-VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_not_of)(
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_not_of)(
 	const VECTOR *self,
 	T value
 );
-VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_of)(
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_first_of)(
 	const VECTOR *self,
 	T value
 );
-VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_of)(
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(find_last_of)(
 	const VECTOR *self,
 	T value
 );
-VECTOR_INLINE T VECTOR_FUNC(front)(const VECTOR *self);
-VECTOR_INLINE vector_index_t VECTOR_FUNC(indx)(
+VECTOR_API VECTOR_INLINE T VECTOR_FUNC(front)(const VECTOR *self);
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_FUNC(indx)(
 	const VECTOR *self,
     const VECTOR_ITERATOR it,
 	vector_error_t *error
 );
-VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(it)(
+VECTOR_API VECTOR_INLINE VECTOR_ITERATOR VECTOR_FUNC(it)(
     const VECTOR *self,
 	vector_index_t index,
 	vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(reverse_indx)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(pop_back)(VECTOR *self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(push_back)(
+    VECTOR *self,
+    T value,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(reserve)(
+    VECTOR *self,
+    vector_index_t new_capacity,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(resize)(
+    VECTOR *self,
+    vector_size_t new_size,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(resize_with)(
+    VECTOR *self,
+    vector_size_t new_size,
+    T value,
+    vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(reverse_indx)(
     VECTOR *self,
 	vector_index_t begin_index,
 	vector_index_t end_index,
     vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(reverse_it)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(reverse_it)(
     VECTOR *self,
     VECTOR_ITERATOR itb,
     VECTOR_ITERATOR ite,
     vector_error_t *error
 );
-VECTOR_INLINE vector_size_t VECTOR_FUNC(size)(const VECTOR *self);
-VECTOR_INLINE void VECTOR_FUNC(swap_indx)(
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_FUNC(size)(const VECTOR *self);
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(swap_indx)(
     VECTOR *self,
 	vector_index_t index_a,
 	vector_index_t index_b,
     vector_error_t *error
 );
-VECTOR_INLINE void VECTOR_FUNC(swap_it)(
+VECTOR_API VECTOR_INLINE void VECTOR_FUNC(swap_it)(
     VECTOR *self,
     VECTOR_ITERATOR it_a,
     VECTOR_ITERATOR it_b,
@@ -208,8 +324,7 @@ VECTOR_INLINE void VECTOR_FUNC(swap_it)(
 #undef VECTOR
 #undef VECTOR_FUNC
 #undef VECTOR_ITERATOR
+#undef VECTOR_SPAN
 
 
 #endif // T
-
-#endif // __STATIC_VECTOR_TEMPLATE_H__
@@ -33,5 +33,23 @@
  */
 #define TEMPLATE(X, Y) CAT(X, Y)
 
+/**
+ * @def   STR
+ * @brief Turn a token into a string literal
+ *
+ * @param X Token
+ * @return  #X
+ */
+#define STR(X) #X
+
+/**
+ * @def   STRINGIFY
+ * @brief Turn the expansion of a macro into a string literal
+ *
+ * @param X Macro (e.g. T)
+ * @return  STR(X)
+ */
+#define STRINGIFY(X) STR(X)
+
 
 #endif // __TEMPLATE_H__ //
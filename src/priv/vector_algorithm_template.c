@@ -0,0 +1,1306 @@
+/**
+ * @file      vector_algorithm_template.c
+ * @brief     Template implementation of vector algorithms
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Works on the element buffer through VECTOR_BEGIN and VECTOR_SIZE,
+ *            which are provided by the container template included before
+ *            this file, so the same code serves dynamic and static vectors.
+ *
+ * @note      This file should not be included directly.
+ *            Use the generated vector_impl.c instead.
+ *
+ * @see       vector_algorithm_template.h
+ */
+
+#ifdef T
+
+#include "template.h"
+#include "vector_traits.h"
+#include "vector_error.h"
+#include "vector_simd.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#ifndef VECTOR_SORT_INSERTION_THRESHOLD
+#define VECTOR_SORT_INSERTION_THRESHOLD 	16
+#endif // VECTOR_SORT_INSERTION_THRESHOLD
+
+#ifndef VECTOR_SORT_RADIX_THRESHOLD
+#define VECTOR_SORT_RADIX_THRESHOLD 		64
+#endif // VECTOR_SORT_RADIX_THRESHOLD
+
+/* Elements summed before the overflow check of integer sums */
+#ifndef VECTOR_SUM_CHUNK
+#define VECTOR_SUM_CHUNK 					4096
+#endif // VECTOR_SUM_CHUNK
+
+/* Block summed directly by pairwise summation of floating-point sums */
+#ifndef VECTOR_SUM_PAIRWISE_BLOCK
+#define VECTOR_SUM_PAIRWISE_BLOCK 			128
+#endif // VECTOR_SUM_PAIRWISE_BLOCK
+
+/* Size ratio from which set operations gallop through the larger input */
+#ifndef VECTOR_GALLOP_RATIO
+#define VECTOR_GALLOP_RATIO 				16
+#endif // VECTOR_GALLOP_RATIO
+
+
+#ifndef VECTOR
+#define VECTOR 				TEMPLATE(vector, T)
+#endif // VECTOR
+
+#ifndef VECTOR_FUNC
+#define VECTOR_FUNC(_name) 	TEMPLATE(vector, TEMPLATE(_name, T))
+#endif // VECTOR_FUNC
+
+#ifndef PRIVATE
+#define PRIVATE(_range)		((_range)->__private)
+#endif // PRIVATE
+
+/* Static vectors never share buffers, dynamic ones define it (VECTOR_COW) */
+#ifndef VECTOR_COW_DETACH
+#define VECTOR_COW_DETACH(_range, _err_ptr, _ret) ;
+#endif // VECTOR_COW_DETACH
+
+#ifndef VECTOR_INDEX_DIRTY
+#define VECTOR_INDEX_DIRTY(_range) ;
+#endif // VECTOR_INDEX_DIRTY
+
+#ifndef VECTOR_NO_DYNAMIC_ALLOC
+#ifdef VECTOR_USE_CUSTOM_ALLOCATOR
+#define VECTOR_SCRATCH_ALLOC(_vec, _size) 	PRIVATE((_vec))->__allocator->malloc((_size))
+#define VECTOR_SCRATCH_FREE(_vec, _ptr) 	PRIVATE((_vec))->__allocator->free((_ptr))
+#else // VECTOR_USE_CUSTOM_ALLOCATOR
+#define VECTOR_SCRATCH_ALLOC(_vec, _size) 	malloc((_size))
+#define VECTOR_SCRATCH_FREE(_vec, _ptr) 	free((_ptr))
+#endif // VECTOR_USE_CUSTOM_ALLOCATOR
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+
+
+#if VECTOR_HAS_LESS || VECTOR_HAS_TRAIT(RADIX)
+
+static void VECTOR_FUNC(insertion_sort)(T *data, vector_size_t count)
+{
+	for (vector_size_t i = 1; i < count; ++i)
+	{
+		T value = data[i];
+		vector_size_t j = i;
+
+		for (; j > 0 && VECTOR_LESS(value, data[j - 1]); --j)
+			data[j] = data[j - 1];
+		data[j] = value;
+	}
+}
+
+static void VECTOR_FUNC(sift_down)(T *data, vector_size_t root, vector_size_t count)
+{
+	T value = data[root];
+
+	for (vector_size_t child = 2 * root + 1; child < count; child = 2 * root + 1)
+	{
+		if (child + 1 < count && VECTOR_LESS(data[child], data[child + 1]))
+			++child;
+		if (!VECTOR_LESS(value, data[child]))
+			break;
+
+		data[root] = data[child];
+		root = child;
+	}
+	data[root] = value;
+}
+
+static void VECTOR_FUNC(heap_sort)(T *data, vector_size_t count)
+{
+	for (vector_size_t i = count / 2; i > 0; --i)
+		VECTOR_FUNC(sift_down)(data, i - 1, count);
+
+	for (vector_size_t end = count; end > 1; --end)
+	{
+		T tmp = data[0];
+		data[0] = data[end - 1];
+		data[end - 1] = tmp;
+		VECTOR_FUNC(sift_down)(data, 0, end - 1);
+	}
+}
+
+/*
+ * Hoare partition around the median of three: returns left, 0 < left < count,
+ * with data[0..left) <= pivot <= data[left..count). Shared by sort and select.
+ */
+static vector_size_t VECTOR_FUNC(partition_pivot)(T *data, vector_size_t count)
+{
+	const vector_size_t mid = count / 2;
+	T tmp;
+
+	if (VECTOR_LESS(data[mid], data[0]))
+		{ tmp = data[mid]; data[mid] = data[0]; data[0] = tmp; }
+	if (VECTOR_LESS(data[count - 1], data[mid]))
+		{ tmp = data[count - 1]; data[count - 1] = data[mid]; data[mid] = tmp; }
+	if (VECTOR_LESS(data[mid], data[0]))
+		{ tmp = data[mid]; data[mid] = data[0]; data[0] = tmp; }
+
+	const T pivot = data[mid];
+	vector_size_t i = 0;
+	vector_size_t j = count - 1;
+
+	for (;;)
+	{
+		while (VECTOR_LESS(data[i], pivot))
+			++i;
+		while (VECTOR_LESS(pivot, data[j]))
+			--j;
+		if (i >= j)
+			break;
+
+		tmp = data[i]; data[i] = data[j]; data[j] = tmp;
+		++i;
+		--j;
+	}
+
+	return j + 1;
+}
+
+/* Quicksort with median-of-three pivot, heap sort once depth runs out */
+static void VECTOR_FUNC(intro_sort)(T *data, vector_size_t count, unsigned depth)
+{
+	while (count > VECTOR_SORT_INSERTION_THRESHOLD)
+	{
+		if (depth-- == 0)
+		{
+			VECTOR_FUNC(heap_sort)(data, count);
+			return;
+		}
+
+		const vector_size_t left = VECTOR_FUNC(partition_pivot)(data, count);
+
+		/* Recurse into the smaller half, iterate over the larger one */
+		if (left < count - left)
+		{
+			VECTOR_FUNC(intro_sort)(data, left, depth);
+			data += left;
+			count -= left;
+		}
+		else
+		{
+			VECTOR_FUNC(intro_sort)(data + left, count - left, depth);
+			count = left;
+		}
+	}
+
+	VECTOR_FUNC(insertion_sort)(data, count);
+}
+
+/* Depth limit of introsort and introselect: 2 * log2(count) */
+static unsigned VECTOR_FUNC(sort_depth)(vector_size_t count)
+{
+	unsigned depth = 0;
+
+	for (vector_size_t n = count; n > 1; n >>= 1)
+		depth += 2;
+
+	return depth;
+}
+
+#if VECTOR_HAS_TRAIT(RADIX) && !defined(VECTOR_HOOK_LESS) && !defined(VECTOR_NO_DYNAMIC_ALLOC)
+/* LSD radix sort by bytes of the integer value, the sign bit is flipped for signed T */
+static void VECTOR_FUNC(radix_sort)(T *data, T *buffer, vector_size_t count)
+{
+	const uint64_t flip = ((T)-1 < (T)0) ? ((uint64_t)1 << (8 * sizeof(T) - 1)) : 0;
+	vector_size_t offset[256];
+	T *src = data;
+	T *dst = buffer;
+
+	for (unsigned shift = 0; shift < 8 * sizeof(T); shift += 8)
+	{
+		memset(offset, 0, sizeof(offset));
+		for (vector_size_t i = 0; i < count; ++i)
+			++offset[(uint8_t)((((uint64_t)src[i]) ^ flip) >> shift)];
+
+		/* All keys share this byte: the pass would not move anything */
+		if (offset[(uint8_t)((((uint64_t)src[0]) ^ flip) >> shift)] == count)
+			continue;
+
+		vector_size_t sum = 0;
+		for (unsigned d = 0; d < 256; ++d)
+		{
+			const vector_size_t n = offset[d];
+			offset[d] = sum;
+			sum += n;
+		}
+
+		for (vector_size_t i = 0; i < count; ++i)
+			dst[offset[(uint8_t)((((uint64_t)src[i]) ^ flip) >> shift)]++] = src[i];
+
+		T *tmp = src;
+		src = dst;
+		dst = tmp;
+	}
+
+	if (src != data)
+		memcpy(data, src, count * sizeof(T));
+}
+#endif // RADIX && !VECTOR_HOOK_LESS && !VECTOR_NO_DYNAMIC_ALLOC
+
+VECTOR_API void VECTOR_FUNC(sort)(VECTOR_SELF self, vector_error_t *error)
+{
+	VECTOR_CHECK_INPUT_RANGE(self, error, )
+
+	const vector_size_t count = VECTOR_SIZE(VECTOR_DEREF(self));
+
+	if (count < 2)
+	{
+		if (error != NULL)
+			*error = VECTOR_ERROR_SUCCESS;
+		return;
+	}
+
+	VECTOR_COW_DETACH(VECTOR_DEREF(self), error, )
+
+	T *data = VECTOR_BEGIN(VECTOR_DEREF(self));
+
+#if VECTOR_HAS_TRAIT(RADIX) && !defined(VECTOR_HOOK_LESS) && !defined(VECTOR_NO_DYNAMIC_ALLOC)
+	if (count >= VECTOR_SORT_RADIX_THRESHOLD)
+	{
+		T *buffer = (T *)VECTOR_SCRATCH_ALLOC(VECTOR_DEREF(self), count * sizeof(T));
+
+		/* Without scratch memory fall back to the in-place sort */
+		if (buffer != NULL)
+		{
+			VECTOR_FUNC(radix_sort)(data, buffer, count);
+			VECTOR_SCRATCH_FREE(VECTOR_DEREF(self), buffer);
+			VECTOR_INDEX_DIRTY(VECTOR_DEREF(self))
+
+			if (error != NULL)
+				*error = VECTOR_ERROR_SUCCESS;
+			return;
+		}
+	}
+#endif // RADIX && !VECTOR_HOOK_LESS && !VECTOR_NO_DYNAMIC_ALLOC
+
+	VECTOR_FUNC(intro_sort)(data, count, VECTOR_FUNC(sort_depth)(count));
+	VECTOR_INDEX_DIRTY(VECTOR_DEREF(self))
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+/* Introselect: quickselect on the side holding nth, heap sort once depth runs out */
+static void VECTOR_FUNC(intro_select)(
+	T *data,
+	vector_size_t count,
+	vector_size_t nth,
+	unsigned depth
+)
+{
+	while (count > VECTOR_SORT_INSERTION_THRESHOLD)
+	{
+		if (depth-- == 0)
+		{
+			VECTOR_FUNC(heap_sort)(data, count);
+			return;
+		}
+
+		const vector_size_t left = VECTOR_FUNC(partition_pivot)(data, count);
+
+		if (nth < left)
+			count = left;
+		else
+		{
+			data += left;
+			nth -= left;
+			count -= left;
+		}
+	}
+
+	VECTOR_FUNC(insertion_sort)(data, count);
+}
+
+VECTOR_API void VECTOR_FUNC(nth_element)(
+	VECTOR_SELF self,
+	vector_index_t nth,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK_INPUT_RANGE(self, error, )
+
+	const vector_size_t count = VECTOR_SIZE(VECTOR_DEREF(self));
+
+	VECTOR_CHECK(
+		(nth >= 0) && ((vector_size_t)nth < count),
+		error,
+		VECTOR_ERROR_INDEX,
+	)
+
+	VECTOR_COW_DETACH(VECTOR_DEREF(self), error, )
+
+	VECTOR_FUNC(intro_select)(
+		VECTOR_BEGIN(VECTOR_DEREF(self)),
+		count,
+		(vector_size_t)nth,
+		VECTOR_FUNC(sort_depth)(count)
+	);
+	VECTOR_INDEX_DIRTY(VECTOR_DEREF(self))
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API void VECTOR_FUNC(partial_sort)(
+	VECTOR_SELF self,
+	vector_size_t count,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK_INPUT_RANGE(self, error, )
+
+	const vector_size_t size = VECTOR_SIZE(VECTOR_DEREF(self));
+
+	if (count > size)
+		count = size;
+
+	if (count == 0)
+	{
+		if (error != NULL)
+			*error = VECTOR_ERROR_SUCCESS;
+		return;
+	}
+
+	VECTOR_COW_DETACH(VECTOR_DEREF(self), error, )
+
+	T *data = VECTOR_BEGIN(VECTOR_DEREF(self));
+
+	/* Select the count smallest into the front, then sort only them */
+	if (count < size)
+		VECTOR_FUNC(intro_select)(data, size, count - 1, VECTOR_FUNC(sort_depth)(size));
+
+	VECTOR_FUNC(intro_sort)(data, count, VECTOR_FUNC(sort_depth)(count));
+	VECTOR_INDEX_DIRTY(VECTOR_DEREF(self))
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+#ifndef VECTOR_NO_DYNAMIC_ALLOC
+
+/* sift_down of a min-heap: the smallest of the kept elements is on top */
+static void VECTOR_FUNC(sift_down_min)(T *data, vector_size_t root, vector_size_t count)
+{
+	T value = data[root];
+
+	for (vector_size_t child = 2 * root + 1; child < count; child = 2 * root + 1)
+	{
+		if (child + 1 < count && VECTOR_LESS(data[child + 1], data[child]))
+			++child;
+		if (!VECTOR_LESS(data[child], value))
+			break;
+
+		data[root] = data[child];
+		root = child;
+	}
+	data[root] = value;
+}
+
+VECTOR_API void VECTOR_FUNC(top_k)(
+	VECTOR **dst,
+	const VECTOR **src,
+	vector_size_t k,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK_INPUT_RANGE(dst, error, )
+	VECTOR_CHECK_INPUT_RANGE(src, error, )
+	VECTOR_CHECK(*dst != *src, error, VECTOR_ERROR_INDEX, )
+
+	const vector_size_t size = VECTOR_SIZE(*src);
+
+	if (k > size)
+		k = size;
+
+	/* No heap to compare against: dst may not even have a buffer */
+	if (k == 0)
+	{
+		PRIVATE(*dst)->__size = 0;
+		VECTOR_INDEX_DIRTY(*dst)
+
+		if (error != NULL)
+			*error = VECTOR_ERROR_SUCCESS;
+
+		return;
+	}
+
+	if (!VECTOR_FUNC(ensure_capacity)(dst, k, error))
+		return;
+
+	VECTOR_COW_DETACH(*dst, error, )
+
+	const T *data = VECTOR_BEGIN(*src);
+	T *heap = VECTOR_BEGIN(*dst);
+
+	for (vector_size_t i = 0; i < k; ++i)
+		heap[i] = data[i];
+
+	for (vector_size_t i = k / 2; i > 0; --i)
+		VECTOR_FUNC(sift_down_min)(heap, i - 1, k);
+
+	/* One compare per element: most of them do not beat the k-th largest */
+	for (vector_size_t i = k; i < size; ++i)
+	{
+		if (VECTOR_LESS(heap[0], data[i]))
+		{
+			heap[0] = data[i];
+			VECTOR_FUNC(sift_down_min)(heap, 0, k);
+		}
+	}
+
+	/* Popping the minimum to the back leaves the heap in descending order */
+	for (vector_size_t end = k; end > 1; --end)
+	{
+		T tmp = heap[0];
+		heap[0] = heap[end - 1];
+		heap[end - 1] = tmp;
+		VECTOR_FUNC(sift_down_min)(heap, 0, end - 1);
+	}
+
+	PRIVATE(*dst)->__size = k;
+	VECTOR_INDEX_DIRTY(*dst)
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+
+#endif // VECTOR_HAS_LESS || RADIX
+
+VECTOR_API vector_size_t VECTOR_FUNC(count)(VECTOR_CSELF self, T value)
+{
+	const T *data = VECTOR_BEGIN(VECTOR_DEREF(self));
+	const vector_size_t size = VECTOR_SIZE(VECTOR_DEREF(self));
+	vector_size_t count = 0;
+	vector_size_t i = 0;
+
+#if VECTOR_HAS_TRAIT(BITWISE_EQ) && !defined(VECTOR_HOOK_EQUAL)
+	/* 1-byte types: one 16-byte compare and a popcount per group */
+	if (sizeof(T) == 1)
+	{
+		const uint8_t byte = *(const uint8_t *)&value;
+
+		for (; i + 16 <= size; i += 16)
+			count += (vector_size_t)vector_popcount64(
+				vector_simd_match16((const uint8_t *)data + i, byte)
+			);
+	}
+#endif // BITWISE_EQ && !VECTOR_HOOK_EQUAL
+
+	for (; i < size; ++i)
+		count += VECTOR_EQ(data[i], value) ? 1 : 0;
+
+	return count;
+}
+
+#if VECTOR_HAS_LESS
+
+VECTOR_API void VECTOR_FUNC(minmax)(
+	VECTOR_CSELF self,
+	T *min,
+	T *max,
+	vector_error_t *error
+)
+{
+	const T *data = VECTOR_BEGIN(VECTOR_DEREF(self));
+	const vector_size_t size = VECTOR_SIZE(VECTOR_DEREF(self));
+
+	VECTOR_CHECK(size > 0, error, VECTOR_ERROR_INDEX, )
+
+	/* Select form without early exits, vectorized for arithmetic types */
+	T lo = data[0];
+	T hi = data[0];
+
+	for (vector_size_t i = 1; i < size; ++i)
+	{
+		lo = VECTOR_LESS(data[i], lo) ? data[i] : lo;
+		hi = VECTOR_LESS(hi, data[i]) ? data[i] : hi;
+	}
+
+	if (min != NULL)
+		*min = lo;
+	if (max != NULL)
+		*max = hi;
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API T VECTOR_FUNC(min)(VECTOR_CSELF self, vector_error_t *error)
+{
+	const T *data = VECTOR_BEGIN(VECTOR_DEREF(self));
+	const vector_size_t size = VECTOR_SIZE(VECTOR_DEREF(self));
+
+	VECTOR_CHECK(size > 0, error, VECTOR_ERROR_INDEX, (T){0})
+
+	T lo = data[0];
+
+	for (vector_size_t i = 1; i < size; ++i)
+		lo = VECTOR_LESS(data[i], lo) ? data[i] : lo;
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return lo;
+}
+
+VECTOR_API T VECTOR_FUNC(max)(VECTOR_CSELF self, vector_error_t *error)
+{
+	const T *data = VECTOR_BEGIN(VECTOR_DEREF(self));
+	const vector_size_t size = VECTOR_SIZE(VECTOR_DEREF(self));
+
+	VECTOR_CHECK(size > 0, error, VECTOR_ERROR_INDEX, (T){0})
+
+	T hi = data[0];
+
+	for (vector_size_t i = 1; i < size; ++i)
+		hi = VECTOR_LESS(hi, data[i]) ? data[i] : hi;
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return hi;
+}
+
+/*
+ * Integers: a vectorized min/max pass, then a scan for its first position.
+ * Other types (NaN, hooks) track the index in a single pass.
+ */
+VECTOR_API vector_index_t VECTOR_FUNC(argmin)(VECTOR_CSELF self)
+{
+	const T *data = VECTOR_BEGIN(VECTOR_DEREF(self));
+	const vector_size_t size = VECTOR_SIZE(VECTOR_DEREF(self));
+
+	if (size == 0)
+		return VECTOR_INVALID_INDEX;
+
+#if VECTOR_HAS_TRAIT(RADIX) && !defined(VECTOR_HOOK_LESS)
+	const T lo = VECTOR_FUNC(min)(self, NULL);
+
+	for (vector_size_t i = 0; i < size; ++i)
+	{
+		if (data[i] == lo)
+			return (vector_index_t)i;
+	}
+
+	return VECTOR_INVALID_INDEX;
+#else // RADIX && !VECTOR_HOOK_LESS
+	vector_size_t best = 0;
+
+	for (vector_size_t i = 1; i < size; ++i)
+	{
+		if (VECTOR_LESS(data[i], data[best]))
+			best = i;
+	}
+
+	return (vector_index_t)best;
+#endif // RADIX && !VECTOR_HOOK_LESS
+}
+
+VECTOR_API vector_index_t VECTOR_FUNC(argmax)(VECTOR_CSELF self)
+{
+	const T *data = VECTOR_BEGIN(VECTOR_DEREF(self));
+	const vector_size_t size = VECTOR_SIZE(VECTOR_DEREF(self));
+
+	if (size == 0)
+		return VECTOR_INVALID_INDEX;
+
+#if VECTOR_HAS_TRAIT(RADIX) && !defined(VECTOR_HOOK_LESS)
+	const T hi = VECTOR_FUNC(max)(self, NULL);
+
+	for (vector_size_t i = 0; i < size; ++i)
+	{
+		if (data[i] == hi)
+			return (vector_index_t)i;
+	}
+
+	return VECTOR_INVALID_INDEX;
+#else // RADIX && !VECTOR_HOOK_LESS
+	vector_size_t best = 0;
+
+	for (vector_size_t i = 1; i < size; ++i)
+	{
+		if (VECTOR_LESS(data[best], data[i]))
+			best = i;
+	}
+
+	return (vector_index_t)best;
+#endif // RADIX && !VECTOR_HOOK_LESS
+}
+
+#endif // VECTOR_HAS_LESS
+
+VECTOR_API vector_size_t VECTOR_FUNC(partition)(
+	VECTOR_SELF self,
+	TEMPLATE(vector_pred_fn, T) pred,
+	void *ctx,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK_INPUT_RANGE(self, error, 0)
+	VECTOR_CHECK(pred != NULL, error, VECTOR_ERROR_NULL, 0)
+	VECTOR_COW_DETACH(VECTOR_DEREF(self), error, 0)
+
+	T *data = VECTOR_BEGIN(VECTOR_DEREF(self));
+	vector_size_t first = 0;
+	vector_size_t last = VECTOR_SIZE(VECTOR_DEREF(self));
+
+	/* Swap the leftmost false with the rightmost true until they cross */
+	for (;;)
+	{
+		while (first < last && pred(data[first], ctx))
+			++first;
+		while (first < last && !pred(data[last - 1], ctx))
+			--last;
+		if (first >= last)
+			break;
+
+		T tmp = data[first];
+		data[first] = data[last - 1];
+		data[last - 1] = tmp;
+		++first;
+		--last;
+	}
+
+	VECTOR_INDEX_DIRTY(VECTOR_DEREF(self))
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return first;
+}
+
+static void VECTOR_FUNC(reverse)(T *data, vector_size_t count)
+{
+	for (vector_size_t i = 0; i < count / 2; ++i)
+	{
+		T tmp = data[i];
+		data[i] = data[count - 1 - i];
+		data[count - 1 - i] = tmp;
+	}
+}
+
+/* Divide and conquer with rotations: O(n log n) moves, no extra memory */
+static vector_size_t VECTOR_FUNC(stable_partition_inplace)(
+	T *data,
+	vector_size_t count,
+	TEMPLATE(vector_pred_fn, T) pred,
+	void *ctx
+)
+{
+	if (count <= 1)
+		return (count == 1 && pred(data[0], ctx)) ? 1 : 0;
+
+	const vector_size_t mid = count / 2;
+	const vector_size_t left = VECTOR_FUNC(stable_partition_inplace)(data, mid, pred, ctx);
+	const vector_size_t right = VECTOR_FUNC(stable_partition_inplace)(data + mid, count - mid, pred, ctx);
+
+	/* [left true | mid - left false | right true]: rotate the middle two */
+	VECTOR_FUNC(reverse)(data + left, mid - left);
+	VECTOR_FUNC(reverse)(data + mid, right);
+	VECTOR_FUNC(reverse)(data + left, mid - left + right);
+
+	return left + right;
+}
+
+VECTOR_API vector_size_t VECTOR_FUNC(stable_partition)(
+	VECTOR_SELF self,
+	TEMPLATE(vector_pred_fn, T) pred,
+	void *ctx,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK_INPUT_RANGE(self, error, 0)
+	VECTOR_CHECK(pred != NULL, error, VECTOR_ERROR_NULL, 0)
+	VECTOR_COW_DETACH(VECTOR_DEREF(self), error, 0)
+
+	T *data = VECTOR_BEGIN(VECTOR_DEREF(self));
+	const vector_size_t count = VECTOR_SIZE(VECTOR_DEREF(self));
+	vector_size_t kept = 0;
+
+#ifndef VECTOR_NO_DYNAMIC_ALLOC
+	T *buffer = (count > 0)
+		? (T *)VECTOR_SCRATCH_ALLOC(VECTOR_DEREF(self), count * sizeof(T))
+		: NULL;
+
+	/* Linear with scratch memory: true compacted in place, false set aside */
+	if (buffer != NULL)
+	{
+		vector_size_t rejected = 0;
+
+		for (vector_size_t i = 0; i < count; ++i)
+		{
+			if (pred(data[i], ctx))
+				data[kept++] = data[i];
+			else
+				buffer[rejected++] = data[i];
+		}
+
+		for (vector_size_t i = 0; i < rejected; ++i)
+			data[kept + i] = buffer[i];
+
+		VECTOR_SCRATCH_FREE(VECTOR_DEREF(self), buffer);
+	}
+	else
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+		kept = VECTOR_FUNC(stable_partition_inplace)(data, count, pred, ctx);
+
+	VECTOR_INDEX_DIRTY(VECTOR_DEREF(self))
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return kept;
+}
+
+VECTOR_API vector_size_t VECTOR_FUNC(unique)(VECTOR_SELF self, vector_error_t *error)
+{
+	VECTOR_CHECK_INPUT_RANGE(self, error, 0)
+
+	const vector_size_t size = VECTOR_SIZE(VECTOR_DEREF(self));
+	const T *data = VECTOR_BEGIN(VECTOR_DEREF(self));
+	vector_size_t first = 1;
+
+	/* Nothing is written (or detached) before the first duplicate */
+	while (first < size && !VECTOR_EQ(data[first - 1], data[first]))
+		++first;
+
+	if (first >= size)
+	{
+		if (error != NULL)
+			*error = VECTOR_ERROR_SUCCESS;
+		return size;
+	}
+
+	VECTOR_COW_DETACH(VECTOR_DEREF(self), error, size)
+
+	T *out = VECTOR_BEGIN(VECTOR_DEREF(self));
+	vector_size_t count = first;
+
+	for (vector_size_t i = first + 1; i < size; ++i)
+	{
+		if (!VECTOR_EQ(out[count - 1], out[i]))
+			out[count++] = out[i];
+	}
+
+#ifdef VECTOR_NO_DYNAMIC_ALLOC
+	self->__size = count;
+#else // VECTOR_NO_DYNAMIC_ALLOC
+	PRIVATE(VECTOR_DEREF(self))->__size = count;
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+	VECTOR_INDEX_DIRTY(VECTOR_DEREF(self))
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return count;
+}
+
+#if VECTOR_HAS_LESS && !defined(VECTOR_NO_DYNAMIC_ALLOC)
+
+/* First index from begin with !(data[index] < value), or count */
+static vector_size_t VECTOR_FUNC(gallop)(
+	const T *data,
+	vector_size_t begin,
+	vector_size_t count,
+	T value
+)
+{
+	vector_size_t step = 1;
+	vector_size_t lo = begin;
+	vector_size_t hi = begin;
+
+	/* Exponential probe, then binary search in the last step */
+	while (hi < count && VECTOR_LESS(data[hi], value))
+	{
+		lo = hi + 1;
+		hi = (count - hi > step) ? hi + step : count;
+		step *= 2;
+	}
+
+	while (lo < hi)
+	{
+		const vector_size_t mid = lo + (hi - lo) / 2;
+
+		if (VECTOR_LESS(data[mid], value))
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return lo;
+}
+
+static T *VECTOR_FUNC(copy_out)(T *out, const T *src, vector_size_t count)
+{
+	for (vector_size_t i = 0; i < count; ++i)
+		out[i] = src[i];
+
+	return out + count;
+}
+
+static T *VECTOR_FUNC(union_kernel)(
+	T *out,
+	const T *a,
+	vector_size_t na,
+	const T *b,
+	vector_size_t nb
+)
+{
+	vector_size_t i = 0;
+	vector_size_t j = 0;
+
+	while (i < na && j < nb)
+	{
+		if (VECTOR_LESS(a[i], b[j]))
+			*out++ = a[i++];
+		else if (VECTOR_LESS(b[j], a[i]))
+			*out++ = b[j++];
+		else
+		{
+			*out++ = a[i++];
+			++j;
+		}
+	}
+
+	out = VECTOR_FUNC(copy_out)(out, a + i, na - i);
+
+	return VECTOR_FUNC(copy_out)(out, b + j, nb - j);
+}
+
+static T *VECTOR_FUNC(merge_kernel)(
+	T *out,
+	const T *a,
+	vector_size_t na,
+	const T *b,
+	vector_size_t nb
+)
+{
+	vector_size_t i = 0;
+	vector_size_t j = 0;
+
+	while (i < na && j < nb)
+		*out++ = VECTOR_LESS(b[j], a[i]) ? b[j++] : a[i++];
+
+	out = VECTOR_FUNC(copy_out)(out, a + i, na - i);
+
+	return VECTOR_FUNC(copy_out)(out, b + j, nb - j);
+}
+
+static T *VECTOR_FUNC(intersection_kernel)(
+	T *out,
+	const T *a,
+	vector_size_t na,
+	const T *b,
+	vector_size_t nb
+)
+{
+	vector_size_t i = 0;
+	vector_size_t j = 0;
+
+	/* Skewed sizes: search every element of the small input in the large one */
+	if (na * (uint64_t)VECTOR_GALLOP_RATIO <= nb)
+	{
+		for (; i < na && j < nb; ++i)
+		{
+			j = VECTOR_FUNC(gallop)(b, j, nb, a[i]);
+
+			if (j < nb && !VECTOR_LESS(a[i], b[j]))
+			{
+				*out++ = a[i];
+				++j;
+			}
+		}
+
+		return out;
+	}
+
+	if (nb * (uint64_t)VECTOR_GALLOP_RATIO <= na)
+	{
+		for (; j < nb && i < na; ++j)
+		{
+			i = VECTOR_FUNC(gallop)(a, i, na, b[j]);
+
+			if (i < na && !VECTOR_LESS(b[j], a[i]))
+				*out++ = a[i++];
+		}
+
+		return out;
+	}
+
+	while (i < na && j < nb)
+	{
+#if VECTOR_HAS_TRAIT(RADIX) && !defined(VECTOR_HOOK_LESS) && defined(VECTOR_SIMD_SSE2)
+		/*
+		 * 32-bit integers: compare groups of four against each other. Only
+		 * valid without duplicates, so groups with an element equal to its
+		 * predecessor take the scalar step below.
+		 */
+		if (sizeof(T) == sizeof(uint32_t)
+			&& i > 0 && j > 0 && i + 4 <= na && j + 4 <= nb
+			&& !vector_simd_adjacent_eq4_u32(a + i)
+			&& !vector_simd_adjacent_eq4_u32(b + j))
+		{
+			for (uint32_t mask = vector_simd_intersect4_u32(a + i, b + j); mask != 0; mask &= mask - 1)
+				*out++ = a[i + vector_ctz32(mask)];
+
+			const T a_last = a[i + 3];
+			const T b_last = b[j + 3];
+
+			/* The group that is not passed is consumed up to the other's last */
+			if (a_last < b_last)
+			{
+				i += 4;
+				while (!(a_last < b[j]))
+					++j;
+			}
+			else if (b_last < a_last)
+			{
+				j += 4;
+				while (!(b_last < a[i]))
+					++i;
+			}
+			else
+			{
+				i += 4;
+				j += 4;
+			}
+
+			continue;
+		}
+#endif // RADIX && !VECTOR_HOOK_LESS && VECTOR_SIMD_SSE2
+
+		if (VECTOR_LESS(a[i], b[j]))
+			++i;
+		else if (VECTOR_LESS(b[j], a[i]))
+			++j;
+		else
+		{
+			*out++ = a[i++];
+			++j;
+		}
+	}
+
+	return out;
+}
+
+static T *VECTOR_FUNC(difference_kernel)(
+	T *out,
+	const T *a,
+	vector_size_t na,
+	const T *b,
+	vector_size_t nb
+)
+{
+	vector_size_t i = 0;
+	vector_size_t j = 0;
+
+	/* Few elements to remove: copy the runs of a between them */
+	if (nb * (uint64_t)VECTOR_GALLOP_RATIO <= na)
+	{
+		for (; j < nb && i < na; ++j)
+		{
+			const vector_size_t next = VECTOR_FUNC(gallop)(a, i, na, b[j]);
+
+			out = VECTOR_FUNC(copy_out)(out, a + i, next - i);
+			i = next;
+
+			if (i < na && !VECTOR_LESS(b[j], a[i]))
+				++i;
+		}
+
+		return VECTOR_FUNC(copy_out)(out, a + i, na - i);
+	}
+
+	if (na * (uint64_t)VECTOR_GALLOP_RATIO <= nb)
+	{
+		for (; i < na; ++i)
+		{
+			j = VECTOR_FUNC(gallop)(b, j, nb, a[i]);
+
+			if (j < nb && !VECTOR_LESS(a[i], b[j]))
+				++j;
+			else
+				*out++ = a[i];
+		}
+
+		return out;
+	}
+
+	while (i < na && j < nb)
+	{
+		if (VECTOR_LESS(a[i], b[j]))
+			*out++ = a[i++];
+		else if (VECTOR_LESS(b[j], a[i]))
+			++j;
+		else
+		{
+			++i;
+			++j;
+		}
+	}
+
+	return VECTOR_FUNC(copy_out)(out, a + i, na - i);
+}
+
+typedef T *(*TEMPLATE(vector_set_kernel, T))(T *, const T *, vector_size_t, const T *, vector_size_t);
+
+static void VECTOR_FUNC(set_operation)(
+	VECTOR **dst,
+	const VECTOR **a,
+	const VECTOR **b,
+	vector_size_t bound,
+	TEMPLATE(vector_set_kernel, T) kernel,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK_INPUT_RANGE(dst, error, )
+	VECTOR_CHECK_INPUT_RANGE(a, error, )
+	VECTOR_CHECK_INPUT_RANGE(b, error, )
+	VECTOR_CHECK(*dst != *a && *dst != *b, error, VECTOR_ERROR_INDEX, )
+
+	if (!VECTOR_FUNC(ensure_capacity)(dst, bound, error))
+		return;
+
+	VECTOR_COW_DETACH(*dst, error, )
+
+	T *out = VECTOR_BEGIN(*dst);
+	const T *end = kernel(
+		out,
+		VECTOR_BEGIN(*a),
+		VECTOR_SIZE(*a),
+		VECTOR_BEGIN(*b),
+		VECTOR_SIZE(*b)
+	);
+
+	PRIVATE(*dst)->__size = (vector_size_t)(end - out);
+	VECTOR_INDEX_DIRTY(*dst)
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API void VECTOR_FUNC(set_union)(
+	VECTOR **dst,
+	const VECTOR **a,
+	const VECTOR **b,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(a != NULL && b != NULL, error, VECTOR_ERROR_NULL, )
+
+	VECTOR_FUNC(set_operation)(
+		dst, a, b,
+		VECTOR_SIZE(*a) + VECTOR_SIZE(*b),
+		VECTOR_FUNC(union_kernel),
+		error
+	);
+}
+
+VECTOR_API void VECTOR_FUNC(set_intersection)(
+	VECTOR **dst,
+	const VECTOR **a,
+	const VECTOR **b,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(a != NULL && b != NULL, error, VECTOR_ERROR_NULL, )
+
+	const vector_size_t na = VECTOR_SIZE(*a);
+	const vector_size_t nb = VECTOR_SIZE(*b);
+
+	VECTOR_FUNC(set_operation)(
+		dst, a, b,
+		(na < nb) ? na : nb,
+		VECTOR_FUNC(intersection_kernel),
+		error
+	);
+}
+
+VECTOR_API void VECTOR_FUNC(set_difference)(
+	VECTOR **dst,
+	const VECTOR **a,
+	const VECTOR **b,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(a != NULL && b != NULL, error, VECTOR_ERROR_NULL, )
+
+	VECTOR_FUNC(set_operation)(
+		dst, a, b,
+		VECTOR_SIZE(*a),
+		VECTOR_FUNC(difference_kernel),
+		error
+	);
+}
+
+VECTOR_API void VECTOR_FUNC(merge)(
+	VECTOR **dst,
+	const VECTOR **a,
+	const VECTOR **b,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(a != NULL && b != NULL, error, VECTOR_ERROR_NULL, )
+
+	VECTOR_FUNC(set_operation)(
+		dst, a, b,
+		VECTOR_SIZE(*a) + VECTOR_SIZE(*b),
+		VECTOR_FUNC(merge_kernel),
+		error
+	);
+}
+
+#endif // VECTOR_HAS_LESS && !VECTOR_NO_DYNAMIC_ALLOC
+
+#if VECTOR_HAS_TRAIT(ARITHMETIC)
+
+#if VECTOR_HAS_TRAIT(RADIX)
+
+/*
+ * Chunks are summed in a wide accumulator with a plain loop the compiler
+ * vectorizes, chunk sums are added to the total with an overflow check.
+ * Elements narrower than 64 bits cannot overflow int64_t within a chunk,
+ * 64-bit elements use __int128 where the compiler has it.
+ */
+VECTOR_API int64_t VECTOR_FUNC(sum)(VECTOR_CSELF self, vector_error_t *error)
+{
+	const T *data = VECTOR_BEGIN(VECTOR_DEREF(self));
+	const vector_size_t size = VECTOR_SIZE(VECTOR_DEREF(self));
+	int64_t total = 0;
+
+	for (vector_size_t begin = 0; begin < size; )
+	{
+		const vector_size_t end = (size - begin > VECTOR_SUM_CHUNK) ? begin + VECTOR_SUM_CHUNK : size;
+		int64_t chunk = 0;
+		bool overflow = false;
+
+		if (sizeof(T) < sizeof(int64_t))
+		{
+			for (vector_size_t i = begin; i < end; ++i)
+				chunk += (int64_t)data[i];
+		}
+		else
+		{
+#ifdef __SIZEOF_INT128__
+			__int128 wide = 0;
+
+			for (vector_size_t i = begin; i < end; ++i)
+				wide += (__int128)data[i];
+
+			overflow = (wide > INT64_MAX) || (wide < INT64_MIN);
+			chunk = (int64_t)wide;
+#else // __SIZEOF_INT128__
+			for (vector_size_t i = begin; i < end && !overflow; ++i)
+			{
+				/* Unsigned values above INT64_MAX never fit */
+				overflow = ((T)-1 > (T)0) && ((uint64_t)data[i] > (uint64_t)INT64_MAX);
+				overflow = overflow || vector_add_overflow_i64(chunk, (int64_t)data[i], &chunk);
+			}
+#endif // __SIZEOF_INT128__
+		}
+
+		if (overflow || vector_add_overflow_i64(total, chunk, &total))
+		{
+			if (error != NULL)
+				*error = VECTOR_ERROR_OVERFLOW;
+
+			return (chunk < 0) ? INT64_MIN : INT64_MAX;
+		}
+
+		begin = end;
+	}
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return total;
+}
+
+#else // VECTOR_HAS_TRAIT(RADIX)
+
+/* Pairwise summation: error grows with log(n) instead of n */
+static double VECTOR_FUNC(sum_pairwise)(const T *data, vector_size_t count)
+{
+	if (count <= VECTOR_SUM_PAIRWISE_BLOCK)
+	{
+		/* Eight independent accumulators keep the vector units busy */
+		double acc[8] = { 0 };
+		vector_size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			for (unsigned lane = 0; lane < 8; ++lane)
+				acc[lane] += (double)data[i + lane];
+		}
+
+		for (; i < count; ++i)
+			acc[0] += (double)data[i];
+
+		return ((acc[0] + acc[1]) + (acc[2] + acc[3])) + ((acc[4] + acc[5]) + (acc[6] + acc[7]));
+	}
+
+	const vector_size_t half = count / 2;
+
+	return VECTOR_FUNC(sum_pairwise)(data, half)
+		+ VECTOR_FUNC(sum_pairwise)(data + half, count - half);
+}
+
+VECTOR_API double VECTOR_FUNC(sum)(VECTOR_CSELF self, vector_error_t *error)
+{
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return VECTOR_FUNC(sum_pairwise)(
+		VECTOR_BEGIN(VECTOR_DEREF(self)),
+		VECTOR_SIZE(VECTOR_DEREF(self))
+	);
+}
+
+VECTOR_API double VECTOR_FUNC(sum_kahan)(VECTOR_CSELF self, vector_error_t *error)
+{
+	const T *data = VECTOR_BEGIN(VECTOR_DEREF(self));
+	const vector_size_t size = VECTOR_SIZE(VECTOR_DEREF(self));
+	double sum = 0.0;
+	double compensation = 0.0;
+
+	for (vector_size_t i = 0; i < size; ++i)
+	{
+		const double y = (double)data[i] - compensation;
+		const double t = sum + y;
+
+		compensation = (t - sum) - y;
+		sum = t;
+	}
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return sum;
+}
+
+#endif // VECTOR_HAS_TRAIT(RADIX)
+
+#endif // VECTOR_HAS_TRAIT(ARITHMETIC)
+
+
+#undef VECTOR
+#undef VECTOR_FUNC
+#undef PRIVATE
+#undef VECTOR_SCRATCH_ALLOC
+#undef VECTOR_SCRATCH_FREE
+
+
+#endif // T
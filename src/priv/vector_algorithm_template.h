@@ -0,0 +1,231 @@
+/**
+ * @file      vector_algorithm_template.h
+ * @brief     Template declarations for vector algorithms
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Algorithms are free functions shared by dynamic and static
+ *            vectors: they take VECTOR_SELF and are not part of the vector
+ *            structure, so they exist in both LITE and non-LITE builds.
+ *            Which algorithms are declared depends on VECTOR_TRAITS: sort
+ *            and the min/max family need an ordering, sum needs ARITHMETIC.
+ *            Selection (nth_element, partial_sort, top_k) shares the
+ *            partition step of the introsort. The set operations on sorted
+ *            vectors need an ordering and write into a dynamic destination.
+ *
+ * @note      Included after the container template for every T.
+ *
+ * @see       vector_algorithm_template.c
+ * @see       vector_traits.h
+ */
+
+#ifdef T
+
+#include "template.h"
+#include "vector_traits.h"
+#include "vector_error.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+#ifndef VECTOR
+#define VECTOR 					TEMPLATE(vector, T)
+#endif // VECTOR
+
+#ifndef VECTOR_FUNC
+#define VECTOR_FUNC(_name) 		TEMPLATE(vector, TEMPLATE(_name, T))
+#endif // VECTOR_FUNC
+
+/* Accumulator of sum(): 64-bit integer or double */
+#if VECTOR_HAS_TRAIT(RADIX)
+#define VECTOR_ACC 				int64_t
+#else // VECTOR_HAS_TRAIT(RADIX)
+#define VECTOR_ACC 				double
+#endif // VECTOR_HAS_TRAIT(RADIX)
+
+
+#if VECTOR_HAS_LESS || VECTOR_HAS_TRAIT(RADIX)
+/**
+ * @brief Sort the vector in ascending order
+ *
+ * RADIX types of dynamic vectors are sorted with LSD radix sort,
+ * other ordered types (ORDERED or a less hook) with introsort.
+ */
+VECTOR_API void VECTOR_FUNC(sort)(VECTOR_SELF self, vector_error_t *error);
+/**
+ * @brief Put the element of sorted position @p nth there (introselect)
+ *
+ * Elements before it are not greater, elements after it are not less.
+ * VECTOR_ERROR_INDEX when @p nth is out of range.
+ */
+VECTOR_API void VECTOR_FUNC(nth_element)(
+	VECTOR_SELF self,
+	vector_index_t nth,
+	vector_error_t *error
+);
+/**
+ * @brief Sort the @p count smallest elements into the front
+ *
+ * The rest is left in unspecified order, @p count is clamped to the size.
+ */
+VECTOR_API void VECTOR_FUNC(partial_sort)(
+	VECTOR_SELF self,
+	vector_size_t count,
+	vector_error_t *error
+);
+#ifndef VECTOR_NO_DYNAMIC_ALLOC
+/**
+ * @brief The @p k largest elements of @p src into @p dst, largest first
+ *
+ * One pass over @p src with a min-heap of @p k elements kept in @p dst,
+ * @p src is not modified and must not be @p dst.
+ */
+VECTOR_API void VECTOR_FUNC(top_k)(
+	VECTOR_SELF dst,
+	VECTOR_CSELF src,
+	vector_size_t k,
+	vector_error_t *error
+);
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+#endif // VECTOR_HAS_LESS || RADIX
+
+typedef bool (*TEMPLATE(vector_pred_fn, T))(T value, void *ctx);
+
+/**
+ * @brief Move the elements for which @p pred is true to the front
+ *
+ * @return Number of elements for which @p pred is true
+ */
+VECTOR_API vector_size_t VECTOR_FUNC(partition)(
+	VECTOR_SELF self,
+	TEMPLATE(vector_pred_fn, T) pred,
+	void *ctx,
+	vector_error_t *error
+);
+/**
+ * @brief partition() keeping the relative order in both groups
+ *
+ * Linear with a scratch buffer of the vector size, O(n log n) in place
+ * for static vectors or when the buffer cannot be allocated.
+ */
+VECTOR_API vector_size_t VECTOR_FUNC(stable_partition)(
+	VECTOR_SELF self,
+	TEMPLATE(vector_pred_fn, T) pred,
+	void *ctx,
+	vector_error_t *error
+);
+
+/**
+ * @brief Number of elements equal to @p value
+ */
+VECTOR_API vector_size_t VECTOR_FUNC(count)(VECTOR_CSELF self, T value);
+
+#if VECTOR_HAS_LESS
+/**
+ * @brief Smallest element, VECTOR_ERROR_INDEX for an empty vector
+ */
+VECTOR_API T VECTOR_FUNC(min)(VECTOR_CSELF self, vector_error_t *error);
+/**
+ * @brief Largest element, VECTOR_ERROR_INDEX for an empty vector
+ */
+VECTOR_API T VECTOR_FUNC(max)(VECTOR_CSELF self, vector_error_t *error);
+/**
+ * @brief Smallest and largest element in one pass
+ */
+VECTOR_API void VECTOR_FUNC(minmax)(
+	VECTOR_CSELF self,
+	T *min,
+	T *max,
+	vector_error_t *error
+);
+/**
+ * @brief Index of the first smallest element, VECTOR_INVALID_INDEX if empty
+ */
+VECTOR_API vector_index_t VECTOR_FUNC(argmin)(VECTOR_CSELF self);
+/**
+ * @brief Index of the first largest element, VECTOR_INVALID_INDEX if empty
+ */
+VECTOR_API vector_index_t VECTOR_FUNC(argmax)(VECTOR_CSELF self);
+#endif // VECTOR_HAS_LESS
+
+/**
+ * @brief Remove adjacent equal elements in place
+ *
+ * @return New number of elements, the vector is shrunk to it
+ */
+VECTOR_API vector_size_t VECTOR_FUNC(unique)(VECTOR_SELF self, vector_error_t *error);
+
+#if VECTOR_HAS_LESS && !defined(VECTOR_NO_DYNAMIC_ALLOC)
+/*
+ * Operations on sorted vectors, equivalence is !(a < b) && !(b < a) and
+ * duplicates are handled like std::set_union and friends. The contents of
+ * dst are replaced; dst is reserved for the largest possible result (no
+ * allocation when it is reserved beforehand) and must not be a or b.
+ */
+/**
+ * @brief Elements of a or b, common elements once
+ */
+VECTOR_API void VECTOR_FUNC(set_union)(
+	VECTOR_SELF dst,
+	VECTOR_CSELF a,
+	VECTOR_CSELF b,
+	vector_error_t *error
+);
+/**
+ * @brief Elements of a that are in b
+ *
+ * Searches the larger input by galloping when the sizes differ by
+ * VECTOR_GALLOP_RATIO or more.
+ */
+VECTOR_API void VECTOR_FUNC(set_intersection)(
+	VECTOR_SELF dst,
+	VECTOR_CSELF a,
+	VECTOR_CSELF b,
+	vector_error_t *error
+);
+/**
+ * @brief Elements of a that are not in b
+ */
+VECTOR_API void VECTOR_FUNC(set_difference)(
+	VECTOR_SELF dst,
+	VECTOR_CSELF a,
+	VECTOR_CSELF b,
+	vector_error_t *error
+);
+/**
+ * @brief All elements of a and b in order, stable (a first on ties)
+ */
+VECTOR_API void VECTOR_FUNC(merge)(
+	VECTOR_SELF dst,
+	VECTOR_CSELF a,
+	VECTOR_CSELF b,
+	vector_error_t *error
+);
+#endif // VECTOR_HAS_LESS && !VECTOR_NO_DYNAMIC_ALLOC
+
+#if VECTOR_HAS_TRAIT(ARITHMETIC)
+/**
+ * @brief Sum of the elements
+ *
+ * Integer types are summed in 64 bits and report VECTOR_ERROR_OVERFLOW when
+ * the sum does not fit int64_t. Floating-point types are summed in double
+ * with pairwise summation.
+ */
+VECTOR_API VECTOR_ACC VECTOR_FUNC(sum)(VECTOR_CSELF self, vector_error_t *error);
+#if !VECTOR_HAS_TRAIT(RADIX)
+/**
+ * @brief Sum with Kahan compensation, slower but with a bounded error
+ */
+VECTOR_API double VECTOR_FUNC(sum_kahan)(VECTOR_CSELF self, vector_error_t *error);
+#endif // !RADIX
+#endif // ARITHMETIC
+
+
+#undef VECTOR
+#undef VECTOR_FUNC
+#undef VECTOR_ACC
+
+
+#endif // T
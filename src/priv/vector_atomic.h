@@ -0,0 +1,245 @@
+/**
+ * @file      vector_atomic.h
+ * @brief     Portable atomic counters for vector templates
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   C11 <stdatomic.h> when available, GCC/Clang __atomic builtins
+ *            or MSVC Interlocked functions otherwise. Only what the templates
+ *            need: a counter with load, increment and decrement, a pointer
+ *            published once with compare-and-swap, and 32-bit bitmap words
+ *            with compare-and-swap, a bounded try-lock, set, clear and take.
+ */
+
+#ifndef __VECTOR_ATOMIC_H__
+#define __VECTOR_ATOMIC_H__
+
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#define VECTOR_ATOMIC_C11
+#include <stdatomic.h>
+#elif defined(_MSC_VER)
+#define VECTOR_ATOMIC_MSVC
+#include <intrin.h>
+#endif // __STDC_VERSION__ >= 201112L && !__STDC_NO_ATOMICS__
+
+
+#ifdef VECTOR_ATOMIC_C11
+typedef atomic_uint_least32_t vector_atomic_count_t;
+#elif defined(VECTOR_ATOMIC_MSVC)
+typedef volatile long vector_atomic_count_t;
+#else // VECTOR_ATOMIC_C11
+typedef uint32_t vector_atomic_count_t;
+#endif // VECTOR_ATOMIC_C11
+
+#ifdef VECTOR_ATOMIC_C11
+typedef atomic_uint_least32_t vector_atomic_bits_t;
+#elif defined(VECTOR_ATOMIC_MSVC)
+typedef volatile long vector_atomic_bits_t;
+#else // VECTOR_ATOMIC_C11
+typedef uint32_t vector_atomic_bits_t;
+#endif // VECTOR_ATOMIC_C11
+
+
+/**
+ * @brief  Set the counter (no other thread may see it yet)
+ */
+static inline void vector_atomic_init(vector_atomic_count_t *count, uint32_t value)
+{
+#ifdef VECTOR_ATOMIC_C11
+	atomic_init(count, value);
+#else // VECTOR_ATOMIC_C11
+	*count = value;
+#endif // VECTOR_ATOMIC_C11
+}
+
+/**
+ * @brief  Current value, acquire: writes released by other threads are visible
+ */
+static inline uint32_t vector_atomic_load(vector_atomic_count_t *count)
+{
+#ifdef VECTOR_ATOMIC_C11
+	return (uint32_t)atomic_load_explicit(count, memory_order_acquire);
+#elif defined(VECTOR_ATOMIC_MSVC)
+	return (uint32_t)_InterlockedOr(count, 0);
+#else // VECTOR_ATOMIC_C11
+	return __atomic_load_n(count, __ATOMIC_ACQUIRE);
+#endif // VECTOR_ATOMIC_C11
+}
+
+/**
+ * @brief  Increment, relaxed (taking a reference needs no ordering)
+ */
+static inline void vector_atomic_inc(vector_atomic_count_t *count)
+{
+#ifdef VECTOR_ATOMIC_C11
+	atomic_fetch_add_explicit(count, 1, memory_order_relaxed);
+#elif defined(VECTOR_ATOMIC_MSVC)
+	_InterlockedIncrement(count);
+#else // VECTOR_ATOMIC_C11
+	__atomic_fetch_add(count, 1, __ATOMIC_RELAXED);
+#endif // VECTOR_ATOMIC_C11
+}
+
+/**
+ * @brief  Decrement and return the new value, acquire-release
+ *
+ * @note   The thread that gets 0 owns the counted object and may free it.
+ */
+static inline uint32_t vector_atomic_dec(vector_atomic_count_t *count)
+{
+#ifdef VECTOR_ATOMIC_C11
+	return (uint32_t)atomic_fetch_sub_explicit(count, 1, memory_order_acq_rel) - 1;
+#elif defined(VECTOR_ATOMIC_MSVC)
+	return (uint32_t)_InterlockedDecrement(count);
+#else // VECTOR_ATOMIC_C11
+	return __atomic_sub_fetch(count, 1, __ATOMIC_ACQ_REL);
+#endif // VECTOR_ATOMIC_C11
+}
+
+/**
+ * @brief  Current bits of a bitmap word, relaxed (validated by the CAS)
+ */
+static inline uint32_t vector_atomic_bits_load(vector_atomic_bits_t *bits)
+{
+#ifdef VECTOR_ATOMIC_C11
+	return (uint32_t)atomic_load_explicit(bits, memory_order_relaxed);
+#elif defined(VECTOR_ATOMIC_MSVC)
+	return (uint32_t)*bits;
+#else // VECTOR_ATOMIC_C11
+	return __atomic_load_n(bits, __ATOMIC_RELAXED);
+#endif // VECTOR_ATOMIC_C11
+}
+
+/**
+ * @brief  Replace @p expected by @p desired, acquire on success
+ *
+ * @return true if the word held @p expected and was replaced
+ */
+static inline bool vector_atomic_bits_cas(
+	vector_atomic_bits_t *bits,
+	uint32_t expected,
+	uint32_t desired
+)
+{
+#ifdef VECTOR_ATOMIC_C11
+	uint_least32_t old = expected;
+
+	return atomic_compare_exchange_strong_explicit(
+		bits, &old, desired, memory_order_acquire, memory_order_relaxed
+	);
+#elif defined(VECTOR_ATOMIC_MSVC)
+	return (uint32_t)_InterlockedCompareExchange(
+		bits, (long)desired, (long)expected
+	) == expected;
+#else // VECTOR_ATOMIC_C11
+	return __atomic_compare_exchange_n(
+		bits, &expected, desired, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED
+	);
+#endif // VECTOR_ATOMIC_C11
+}
+
+/**
+ * @brief  Clear the bits of @p mask, release (the slot is handed back)
+ */
+static inline void vector_atomic_bits_clear(vector_atomic_bits_t *bits, uint32_t mask)
+{
+#ifdef VECTOR_ATOMIC_C11
+	atomic_fetch_and_explicit(bits, ~mask, memory_order_release);
+#elif defined(VECTOR_ATOMIC_MSVC)
+	_InterlockedAnd(bits, (long)~mask);
+#else // VECTOR_ATOMIC_C11
+	__atomic_fetch_and(bits, ~mask, __ATOMIC_RELEASE);
+#endif // VECTOR_ATOMIC_C11
+}
+
+/**
+ * @brief  Take a 0/1 lock word in at most @p tries compare-and-swaps, acquire
+ *
+ * @return false if the word stayed taken: the caller never waits for the holder
+ */
+static inline bool vector_atomic_bits_try_lock(vector_atomic_bits_t *bits, unsigned tries)
+{
+	while (tries-- > 0)
+	{
+		if (vector_atomic_bits_cas(bits, 0, 1))
+			return true;
+	}
+
+	return false;
+}
+
+/**
+ * @brief  Set the bits of @p mask, release (the marked object is handed over)
+ */
+static inline void vector_atomic_bits_set(vector_atomic_bits_t *bits, uint32_t mask)
+{
+#ifdef VECTOR_ATOMIC_C11
+	atomic_fetch_or_explicit(bits, mask, memory_order_release);
+#elif defined(VECTOR_ATOMIC_MSVC)
+	_InterlockedOr(bits, (long)mask);
+#else // VECTOR_ATOMIC_C11
+	__atomic_fetch_or(bits, mask, __ATOMIC_RELEASE);
+#endif // VECTOR_ATOMIC_C11
+}
+
+/**
+ * @brief  Clear the whole word and return the bits it held, acquire
+ */
+static inline uint32_t vector_atomic_bits_take(vector_atomic_bits_t *bits)
+{
+#ifdef VECTOR_ATOMIC_C11
+	return (uint32_t)atomic_exchange_explicit(bits, 0, memory_order_acquire);
+#elif defined(VECTOR_ATOMIC_MSVC)
+	return (uint32_t)_InterlockedExchange(bits, 0);
+#else // VECTOR_ATOMIC_C11
+	return __atomic_exchange_n(bits, 0, __ATOMIC_ACQUIRE);
+#endif // VECTOR_ATOMIC_C11
+}
+
+/**
+ * @brief  Current pointer of @p slot, acquire: the object it points to is visible
+ */
+static inline void *vector_atomic_ptr_load(void **slot)
+{
+#ifdef VECTOR_ATOMIC_C11
+	return atomic_load_explicit((_Atomic(void *) *)slot, memory_order_acquire);
+#elif defined(VECTOR_ATOMIC_MSVC)
+	return _InterlockedCompareExchangePointer(slot, NULL, NULL);
+#else // VECTOR_ATOMIC_C11
+	return __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+#endif // VECTOR_ATOMIC_C11
+}
+
+/**
+ * @brief  Store @p desired in @p slot if it still holds @p expected, acquire-release
+ *
+ * @return The pointer @p slot held: @p expected when @p desired was stored,
+ *         the pointer another thread published first otherwise
+ */
+static inline void *vector_atomic_ptr_cas(void **slot, void *expected, void *desired)
+{
+#ifdef VECTOR_ATOMIC_C11
+	atomic_compare_exchange_strong_explicit(
+		(_Atomic(void *) *)slot, &expected, desired,
+		memory_order_acq_rel, memory_order_acquire
+	);
+
+	return expected;
+#elif defined(VECTOR_ATOMIC_MSVC)
+	return _InterlockedCompareExchangePointer(slot, desired, expected);
+#else // VECTOR_ATOMIC_C11
+	__atomic_compare_exchange_n(
+		slot, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE
+	);
+
+	return expected;
+#endif // VECTOR_ATOMIC_C11
+}
+
+
+#endif // __VECTOR_ATOMIC_H__
@@ -0,0 +1,389 @@
+/**
+ * @file      vector_index_template.c
+ * @brief     Template implementation of the vector hash index
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Open addressing table with one control byte per slot: EMPTY,
+ *            DELETED or the low 7 bits of the hash. Probing loads 16
+ *            control bytes at once and compares them with one SSE2
+ *            instruction (vector_simd_match16), so most lookups touch one
+ *            control group and one slot. The first 16 control bytes are
+ *            mirrored after the end so a group never wraps.
+ *
+ *            The table grows by doubling at 7/8 load and is sized by the
+ *            number of distinct values, not by the vector size.
+ *
+ * @note      Included by dynamic_vector_template.c after the private
+ *            structure and the allocation macros; uses both.
+ *
+ * @see       vector_index_template.h
+ */
+
+#if defined(T) && VECTOR_HAS_INDEX
+
+#include "vector_simd.h"
+
+#include <stdint.h>
+#include <string.h>
+
+
+#ifndef VECTOR_INDEX_GROUP
+#define VECTOR_INDEX_GROUP 			16
+#define VECTOR_INDEX_EMPTY 			((uint8_t)0x80)
+#define VECTOR_INDEX_DELETED 		((uint8_t)0xFE)
+#define VECTOR_INDEX_MIN_CAPACITY 	16
+#endif // VECTOR_INDEX_GROUP
+
+#ifndef VECTOR_INDEX_SLOT
+#define VECTOR_INDEX_SLOT 			TEMPLATE(vector_hash_slot, T)
+#endif // VECTOR_INDEX_SLOT
+
+#ifndef VECTOR_INDEX
+#define VECTOR_INDEX 				TEMPLATE(vector_hash_index, T)
+#endif // VECTOR_INDEX
+
+
+typedef struct TEMPLATE(vector_hash_slot_t, T)
+{
+	T key;
+	vector_index_t first;
+	vector_index_t last;
+} VECTOR_INDEX_SLOT;
+
+typedef struct TEMPLATE(vector_hash_index_t, T)
+{
+	VECTOR_INDEX_SLOT *slots;
+	uint8_t *ctrl;
+	size_t capacity;
+	size_t used;
+	bool dirty;
+} VECTOR_INDEX;
+
+
+static size_t VECTOR_FUNC(index_bytes)(size_t capacity)
+{
+	return capacity * sizeof(VECTOR_INDEX_SLOT) + capacity + VECTOR_INDEX_GROUP;
+}
+
+static VECTOR_INLINE void VECTOR_FUNC(index_set_ctrl)(VECTOR_INDEX *index, size_t pos, uint8_t value)
+{
+	index->ctrl[pos] = value;
+	if (pos < VECTOR_INDEX_GROUP)
+		index->ctrl[index->capacity + pos] = value;
+}
+
+/* Slots and control bytes share one block, the caller frees the old one */
+static bool VECTOR_FUNC(index_alloc)(const VECTOR *vec, VECTOR_INDEX *index, size_t capacity)
+{
+	(void)vec;
+
+	void *block = VECTOR_MALLOC(vec, VECTOR_FUNC(index_bytes)(capacity));
+	if (block == NULL)
+		return false;
+
+	index->slots = (VECTOR_INDEX_SLOT *)block;
+	index->ctrl = (uint8_t *)(index->slots + capacity);
+	index->capacity = capacity;
+	index->used = 0;
+	memset(index->ctrl, VECTOR_INDEX_EMPTY, capacity + VECTOR_INDEX_GROUP);
+
+	return true;
+}
+
+static VECTOR_INDEX_SLOT *VECTOR_FUNC(index_find)(const VECTOR_INDEX *index, T value, size_t hash)
+{
+	const size_t mask = index->capacity - 1;
+	const uint8_t h2 = (uint8_t)(hash & 0x7F);
+
+	for (size_t pos = (hash >> 7) & mask, probed = 0; probed < index->capacity; probed += VECTOR_INDEX_GROUP)
+	{
+		const uint8_t *group = index->ctrl + pos;
+
+		for (uint32_t match = vector_simd_match16(group, h2); match != 0; match &= match - 1)
+		{
+			VECTOR_INDEX_SLOT *slot = &index->slots[(pos + vector_ctz32(match)) & mask];
+
+			if (VECTOR_EQ(slot->key, value))
+				return slot;
+		}
+
+		if (vector_simd_match16(group, VECTOR_INDEX_EMPTY) != 0)
+			return NULL;
+
+		pos = (pos + VECTOR_INDEX_GROUP) & mask;
+	}
+
+	return NULL;
+}
+
+/* The value must be absent and the table must have a free slot */
+static VECTOR_INDEX_SLOT *VECTOR_FUNC(index_place)(VECTOR_INDEX *index, size_t hash)
+{
+	const size_t mask = index->capacity - 1;
+
+	for (size_t pos = (hash >> 7) & mask;; pos = (pos + VECTOR_INDEX_GROUP) & mask)
+	{
+		const uint8_t *group = index->ctrl + pos;
+		const uint32_t free_mask =
+			vector_simd_match16(group, VECTOR_INDEX_EMPTY) |
+			vector_simd_match16(group, VECTOR_INDEX_DELETED);
+
+		if (free_mask != 0)
+		{
+			const size_t slot = (pos + vector_ctz32(free_mask)) & mask;
+
+			if (index->ctrl[slot] == VECTOR_INDEX_EMPTY)
+				++index->used;
+			VECTOR_FUNC(index_set_ctrl)(index, slot, (uint8_t)(hash & 0x7F));
+
+			return &index->slots[slot];
+		}
+	}
+}
+
+/* Rehash into @p capacity slots, dropping DELETED entries */
+static bool VECTOR_FUNC(index_rehash)(const VECTOR *vec, VECTOR_INDEX *index, size_t capacity)
+{
+	VECTOR_INDEX old = *index;
+
+	if (!VECTOR_FUNC(index_alloc)(vec, index, capacity))
+	{
+		*index = old;
+		return false;
+	}
+
+	for (size_t i = 0; i < old.capacity; ++i)
+	{
+		if ((old.ctrl[i] & VECTOR_INDEX_EMPTY) != 0)
+			continue;
+
+		*VECTOR_FUNC(index_place)(index, VECTOR_HASH(old.slots[i].key)) = old.slots[i];
+	}
+
+	VECTOR_FREE(vec, old.slots);
+
+	return true;
+}
+
+/* Record that @p value is stored at @p position */
+static bool VECTOR_FUNC(index_add)(const VECTOR *vec, VECTOR_INDEX *index, T value, vector_index_t position)
+{
+	const size_t hash = VECTOR_HASH(value);
+	VECTOR_INDEX_SLOT *slot = VECTOR_FUNC(index_find)(index, value, hash);
+
+	if (slot != NULL)
+	{
+		if (position < slot->first)
+			slot->first = position;
+		if (position > slot->last)
+			slot->last = position;
+
+		return true;
+	}
+
+	if ((index->used + 1) * 8 > index->capacity * 7)
+		if (!VECTOR_FUNC(index_rehash)(vec, index, index->capacity * 2))
+			return false;
+
+	slot = VECTOR_FUNC(index_place)(index, hash);
+	slot->key = value;
+	slot->first = position;
+	slot->last = position;
+
+	return true;
+}
+
+/*
+ * Forget that @p value was stored at @p position. Only the cases that do
+ * not need a scan are handled; false means the index has to be rebuilt.
+ */
+static bool VECTOR_FUNC(index_remove)(VECTOR_INDEX *index, T value, vector_index_t position)
+{
+	VECTOR_INDEX_SLOT *slot = VECTOR_FUNC(index_find)(index, value, VECTOR_HASH(value));
+
+	if (slot == NULL)
+		return false;
+
+	if (slot->first == position && slot->last == position)
+	{
+		VECTOR_FUNC(index_set_ctrl)(index, (size_t)(slot - index->slots), VECTOR_INDEX_DELETED);
+		return true;
+	}
+
+	return (slot->first != position && slot->last != position);
+}
+
+static bool VECTOR_FUNC(index_rebuild)(const VECTOR *vec, VECTOR_INDEX *index)
+{
+	memset(index->ctrl, VECTOR_INDEX_EMPTY, index->capacity + VECTOR_INDEX_GROUP);
+	index->used = 0;
+
+	for (vector_size_t i = 0; i < PRIVATE(vec)->__size; ++i)
+		if (!VECTOR_FUNC(index_add)(vec, index, VECTOR_DATA(vec, i), (vector_index_t)i))
+			return false;
+
+	index->dirty = false;
+
+	return true;
+}
+
+/*
+ * Answer find_first_of / find_last_of from the index.
+ * Returns false when there is no usable index and the caller must scan.
+ */
+static VECTOR_INLINE bool VECTOR_FUNC(index_lookup)(
+	const VECTOR *vec,
+	T value,
+	bool last,
+	vector_index_t *found
+)
+{
+	VECTOR_INDEX *index = PRIVATE(vec)->__index;
+
+	if (index == NULL)
+		return false;
+	if (index->dirty && !VECTOR_FUNC(index_rebuild)(vec, index))
+		return false;
+
+	const VECTOR_INDEX_SLOT *slot = VECTOR_FUNC(index_find)(index, value, VECTOR_HASH(value));
+
+	*found = (slot == NULL)
+		? VECTOR_INVALID_INDEX
+		: (last ? slot->last : slot->first);
+
+	return true;
+}
+
+static VECTOR_INLINE void VECTOR_FUNC(index_dirty)(const VECTOR *vec)
+{
+	if (PRIVATE(vec)->__index != NULL)
+		PRIVATE(vec)->__index->dirty = true;
+}
+
+/* push_back() stored @p value at @p position */
+static VECTOR_INLINE void VECTOR_FUNC(index_push)(const VECTOR *vec, T value, vector_index_t position)
+{
+	VECTOR_INDEX *index = PRIVATE(vec)->__index;
+
+	if (index != NULL && !index->dirty)
+		index->dirty = !VECTOR_FUNC(index_add)(vec, index, value, position);
+}
+
+/* pop_back() removed @p value from @p position */
+static VECTOR_INLINE void VECTOR_FUNC(index_pop)(const VECTOR *vec, T value, vector_index_t position)
+{
+	VECTOR_INDEX *index = PRIVATE(vec)->__index;
+
+	if (index != NULL && !index->dirty)
+		index->dirty = !VECTOR_FUNC(index_remove)(index, value, position);
+}
+
+/* emplace_indx() replaced @p old_value with @p value at @p position */
+static VECTOR_INLINE void VECTOR_FUNC(index_replace)(
+	const VECTOR *vec,
+	T old_value,
+	T value,
+	vector_index_t position
+)
+{
+	VECTOR_INDEX *index = PRIVATE(vec)->__index;
+
+	if (index == NULL || index->dirty || VECTOR_EQ(old_value, value))
+		return;
+
+	index->dirty =
+		!VECTOR_FUNC(index_remove)(index, old_value, position) ||
+		!VECTOR_FUNC(index_add)(vec, index, value, position);
+}
+
+static void VECTOR_FUNC(index_free)(const VECTOR *vec)
+{
+	VECTOR_INDEX *index = PRIVATE(vec)->__index;
+
+	if (index == NULL)
+		return;
+
+	VECTOR_FREE(vec, index->slots);
+	VECTOR_FREE(vec, index);
+	PRIVATE(vec)->__index = NULL;
+}
+
+
+VECTOR_API bool VECTOR_FUNC(index_enable)(VECTOR **self, vector_error_t *error)
+{
+	VECTOR_CHECK_INPUT_RANGE(self, error, false)
+
+	VECTOR *vec = *self;
+	VECTOR_INDEX *index = PRIVATE(vec)->__index;
+
+	if (index == NULL)
+	{
+		index = (VECTOR_INDEX *)VECTOR_MALLOC(vec, sizeof(VECTOR_INDEX));
+		if (index == NULL || !VECTOR_FUNC(index_alloc)(vec, index, VECTOR_INDEX_MIN_CAPACITY))
+		{
+			if (index != NULL)
+				VECTOR_FREE(vec, index);
+			if (error != NULL)
+				*error = VECTOR_ERROR_ALLOC;
+			return false;
+		}
+
+		PRIVATE(vec)->__index = index;
+	}
+
+	if (!VECTOR_FUNC(index_rebuild)(vec, index))
+	{
+		VECTOR_FUNC(index_free)(vec);
+		if (error != NULL)
+			*error = VECTOR_ERROR_ALLOC;
+		return false;
+	}
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return true;
+}
+
+VECTOR_API void VECTOR_FUNC(index_disable)(VECTOR **self)
+{
+	if (self == NULL || *self == NULL)
+		return;
+
+	VECTOR_FUNC(index_free)(*self);
+}
+
+VECTOR_API void VECTOR_FUNC(index_invalidate)(VECTOR **self)
+{
+	if (self == NULL || *self == NULL)
+		return;
+
+	VECTOR_FUNC(index_dirty)(*self);
+}
+
+VECTOR_API size_t VECTOR_FUNC(index_memory)(const VECTOR **self)
+{
+	if (self == NULL || *self == NULL || PRIVATE(*self)->__index == NULL)
+		return 0;
+
+	return sizeof(VECTOR_INDEX) + VECTOR_FUNC(index_bytes)(PRIVATE(*self)->__index->capacity);
+}
+
+VECTOR_API size_t VECTOR_FUNC(index_memory_estimate)(vector_size_t distinct)
+{
+	size_t capacity = VECTOR_INDEX_MIN_CAPACITY;
+
+	while ((size_t)distinct * 8 > capacity * 7)
+		capacity *= 2;
+
+	return sizeof(VECTOR_INDEX) + VECTOR_FUNC(index_bytes)(capacity);
+}
+
+
+#undef VECTOR_INDEX_SLOT
+#undef VECTOR_INDEX
+
+
+#endif // T && VECTOR_HAS_INDEX
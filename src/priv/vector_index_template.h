@@ -0,0 +1,73 @@
+/**
+ * @file      vector_index_template.h
+ * @brief     Template declarations for the vector hash index
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   The hash index is an optional side structure of a dynamic vector
+ *            that maps every distinct value to the first and the last index
+ *            holding it. While it is enabled find_first_of and find_last_of
+ *            are answered from the index instead of scanning the vector.
+ *
+ *            push_back, pop_back and emplace_indx update the index in place
+ *            when they can; every other modification marks it dirty and it
+ *            is rebuilt by the next lookup. Writes through data() or
+ *            iterators are not seen, call index_invalidate() after them.
+ *
+ *            Built with VECTOR_HASH_INDEX for types that have VECTOR_HASH
+ *            (integers, BITWISE_EQ types, types with a hash hook).
+ *
+ * @see       vector_index_template.c
+ * @see       vector_traits.h
+ */
+
+#ifdef T
+
+#include "template.h"
+#include "vector_traits.h"
+#include "vector_error.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+
+#ifndef VECTOR
+#define VECTOR 					TEMPLATE(vector, T)
+#endif // VECTOR
+
+#ifndef VECTOR_FUNC
+#define VECTOR_FUNC(_name) 		TEMPLATE(vector, TEMPLATE(_name, T))
+#endif // VECTOR_FUNC
+
+
+#if VECTOR_HAS_INDEX
+/**
+ * @brief  Build the hash index of the vector (rebuild if already enabled)
+ * @return false if the index could not be allocated
+ */
+VECTOR_API bool VECTOR_FUNC(index_enable)(VECTOR **self, vector_error_t *error);
+/**
+ * @brief  Free the hash index, finds scan the vector again
+ */
+VECTOR_API void VECTOR_FUNC(index_disable)(VECTOR **self);
+/**
+ * @brief  Mark the index dirty after writes through data() or iterators
+ */
+VECTOR_API void VECTOR_FUNC(index_invalidate)(VECTOR **self);
+/**
+ * @brief  Bytes used by the hash index of the vector, 0 when disabled
+ */
+VECTOR_API size_t VECTOR_FUNC(index_memory)(const VECTOR **self);
+/**
+ * @brief  Bytes an index over @p distinct different values would use
+ */
+VECTOR_API size_t VECTOR_FUNC(index_memory_estimate)(vector_size_t distinct);
+#endif // VECTOR_HAS_INDEX
+
+
+#undef VECTOR
+#undef VECTOR_FUNC
+
+
+#endif // T
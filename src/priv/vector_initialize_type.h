@@ -26,5 +26,112 @@
 #define VECTOR_INITIALIZE_TYPE(_type)
 #endif // VECTOR_INITIALIZE_TYPE
 
+/**
+ * @def   VECTOR_INITIALIZE_TYPE_EX
+ * @brief Initialize a vector type with explicit traits (placeholder)
+ *
+ * @param _type    Type to initialize
+ * @param _traits  Traits joined with '|': TRIVIAL, BITWISE_EQ, ORDERED,
+ *                 ZERO_IS_DEFAULT, RADIX, ARITHMETIC (VECTOR_TRAIT_ prefix
+ *                 is optional)
+ *
+ * @note   Traits are a promise about the type: BITWISE_EQ means equal values
+ *         have equal bytes (no padding, no floats), ZERO_IS_DEFAULT means
+ *         the all-zero object is the default value.
+ *         Builtin types passed to VECTOR_INITIALIZE_TYPE get their traits
+ *         inferred by vector_gen.py.
+ *
+ * @see    vector_traits.h
+ */
+#ifndef VECTOR_INITIALIZE_TYPE_EX
+#define VECTOR_INITIALIZE_TYPE_EX(_type, _traits)
+#endif // VECTOR_INITIALIZE_TYPE_EX
+
+/**
+ * @def   VECTOR_INITIALIZE_TYPE_HOOKS
+ * @brief Initialize a vector type with traits and comparison hooks (placeholder)
+ *
+ * @param _type    Type to initialize
+ * @param _traits  Traits as in VECTOR_INITIALIZE_TYPE_EX (may be empty)
+ * @param _equal   bool (*)(const T *, const T *) or macro, may be empty
+ * @param _less    bool (*)(const T *, const T *) or macro, may be empty
+ * @param _hash    size_t (*)(const T *) or macro, may be empty
+ *
+ * @note   Hooks are called directly by the generated find, sort and hash
+ *         code, so they must be declared before vector_decl.h is included
+ *         (static inline functions in vector.h inline best).
+ *
+ * @see    vector_traits.h
+ */
+#ifndef VECTOR_INITIALIZE_TYPE_HOOKS
+#define VECTOR_INITIALIZE_TYPE_HOOKS(_type, _traits, _equal, _less, _hash)
+#endif // VECTOR_INITIALIZE_TYPE_HOOKS
+
+/**
+ * @def   VECTOR_INITIALIZE_TYPE_POOL
+ * @brief Initialize a vector type with its own static pool (placeholder)
+ *
+ * @param _type         Type to initialize, traits are inferred
+ * @param _n_vectors    Vectors of the type, VECTOR_MAX_N_VECTORS when empty
+ * @param _buffer_size  Arena elements per vector, VECTOR_STATIC_BUFFER_SIZE
+ *                      when empty
+ * @param _section      Linker section of the arena, e.g. .dtcm (may be empty)
+ * @param _align        Alignment of every vector buffer and pool entry in
+ *                      bytes, VECTOR_STATIC_ALIGN when empty
+ *
+ * @note   Only used with VECTOR_NO_DYNAMIC_ALLOC. Also applies to a type
+ *         initialized by another VECTOR_INITIALIZE_ macro. vector_gen.py
+ *         writes the static footprint of every type to vector_pools.txt.
+ *
+ * @see    static_vector_template.c
+ */
+#ifndef VECTOR_INITIALIZE_TYPE_POOL
+#define VECTOR_INITIALIZE_TYPE_POOL(_type, _n_vectors, _buffer_size, _section, _align)
+#endif // VECTOR_INITIALIZE_TYPE_POOL
+
+/**
+ * @def   VECTOR_INITIALIZE_TYPE_BITS
+ * @brief Initialize a bit-packed boolean vector type (placeholder)
+ *
+ * @param _type  bool or _Bool
+ *
+ * @note   Elements are stored as 64 bits per word (dynamic vectors only).
+ *
+ * @see    bit_vector_template.h
+ */
+#ifndef VECTOR_INITIALIZE_TYPE_BITS
+#define VECTOR_INITIALIZE_TYPE_BITS(_type)
+#endif // VECTOR_INITIALIZE_TYPE_BITS
+
+/**
+ * @def   VECTOR_INITIALIZE_SOA
+ * @brief Initialize a structure-of-arrays vector type (placeholder)
+ *
+ * @param _type  Row type (struct with the listed fields)
+ * @param ...    Fields stored as columns, each as "type name"
+ *
+ * @note   Only vector_gen.py generates SoA types.
+ *
+ * @see    soa_vector_template.h
+ */
+#ifndef VECTOR_INITIALIZE_SOA
+#define VECTOR_INITIALIZE_SOA(_type, ...)
+#endif // VECTOR_INITIALIZE_SOA
+
+/**
+ * @def   VECTOR_INITIALIZE_TYPE_SEGMENTED
+ * @brief Initialize a segmented vector type with stable element addresses (placeholder)
+ *
+ * @param _type  Type to initialize
+ *
+ * @note   Generates vector_seg_T next to any ordinary vector of the same
+ *         type (dynamic vectors only).
+ *
+ * @see    segmented_vector_template.h
+ */
+#ifndef VECTOR_INITIALIZE_TYPE_SEGMENTED
+#define VECTOR_INITIALIZE_TYPE_SEGMENTED(_type)
+#endif // VECTOR_INITIALIZE_TYPE_SEGMENTED
+
 
 #endif // __VECTOR_INITIALIZE_TYPE_H__
@@ -0,0 +1,733 @@
+/**
+ * @file      vector_numeric_template.c
+ * @brief     Template implementation of element-wise numeric kernels
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Each operation checks its arguments once and then runs a plain
+ *            counted loop over the element buffers; the loop bodies are
+ *            simple enough for the compiler to vectorize and unroll.
+ *
+ * @note      This file should not be included directly.
+ *            Use the generated vector_impl.c instead.
+ *
+ * @see       vector_numeric_template.h
+ */
+
+#ifdef T
+
+#include "template.h"
+#include "vector_traits.h"
+#include "vector_error.h"
+#include "vector_simd.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(VECTOR_OPENMP) && defined(_OPENMP)
+#include <omp.h>
+#endif // VECTOR_OPENMP && _OPENMP
+
+
+#if VECTOR_HAS_TRAIT(ARITHMETIC)
+
+
+#ifndef VECTOR_NUMERIC_OP
+#define VECTOR_NUMERIC_OP
+typedef enum
+{
+	VECTOR_NUMERIC_ADD,
+	VECTOR_NUMERIC_SUB,
+	VECTOR_NUMERIC_MUL,
+	VECTOR_NUMERIC_AXPY
+} vector_numeric_op_t;
+#endif // VECTOR_NUMERIC_OP
+
+#ifndef VECTOR_DOT_CHUNK
+#define VECTOR_DOT_CHUNK 			4096
+#endif // VECTOR_DOT_CHUNK
+
+/* Upper bound of the blocks (threads) of a parallel scan */
+#ifndef VECTOR_SCAN_MAX_BLOCKS
+#define VECTOR_SCAN_MAX_BLOCKS 		64
+#endif // VECTOR_SCAN_MAX_BLOCKS
+
+
+#ifndef VECTOR
+#define VECTOR 						TEMPLATE(vector, T)
+#endif // VECTOR
+
+#ifndef VECTOR_FUNC
+#define VECTOR_FUNC(_name) 			TEMPLATE(vector, TEMPLATE(_name, T))
+#endif // VECTOR_FUNC
+
+#ifndef PRIVATE
+#define PRIVATE(_range)				((_range)->__private)
+#endif // PRIVATE
+
+#ifndef VECTOR_ACC
+#if VECTOR_HAS_TRAIT(RADIX)
+#define VECTOR_ACC 					int64_t
+#else // VECTOR_HAS_TRAIT(RADIX)
+#define VECTOR_ACC 					double
+#endif // VECTOR_HAS_TRAIT(RADIX)
+#endif // VECTOR_ACC
+
+/* Static vectors never share buffers nor keep a hash index */
+#ifndef VECTOR_COW_DETACH
+#define VECTOR_COW_DETACH(_range, _err_ptr, _ret) ;
+#endif // VECTOR_COW_DETACH
+
+#ifndef VECTOR_INDEX_DIRTY
+#define VECTOR_INDEX_DIRTY(_range) ;
+#endif // VECTOR_INDEX_DIRTY
+
+
+/* dst and src are different buffers */
+static void VECTOR_FUNC(binary_kernel)(
+	T *VECTOR_RESTRICT dst,
+	const T *VECTOR_RESTRICT src,
+	vector_size_t count,
+	vector_numeric_op_t op,
+	T alpha
+)
+{
+	switch (op)
+	{
+	case VECTOR_NUMERIC_ADD:
+		VECTOR_PARALLEL_FOR(count)
+		for (vector_size_t i = 0; i < count; ++i)
+			dst[i] += src[i];
+		break;
+
+	case VECTOR_NUMERIC_SUB:
+		VECTOR_PARALLEL_FOR(count)
+		for (vector_size_t i = 0; i < count; ++i)
+			dst[i] -= src[i];
+		break;
+
+	case VECTOR_NUMERIC_MUL:
+		VECTOR_PARALLEL_FOR(count)
+		for (vector_size_t i = 0; i < count; ++i)
+			dst[i] *= src[i];
+		break;
+
+	case VECTOR_NUMERIC_AXPY:
+		VECTOR_PARALLEL_FOR(count)
+		for (vector_size_t i = 0; i < count; ++i)
+			dst[i] += alpha * src[i];
+		break;
+	}
+}
+
+/* A vector combined with itself */
+static void VECTOR_FUNC(binary_kernel_self)(
+	T *dst,
+	vector_size_t count,
+	vector_numeric_op_t op,
+	T alpha
+)
+{
+	switch (op)
+	{
+	case VECTOR_NUMERIC_ADD:
+		VECTOR_PARALLEL_FOR(count)
+		for (vector_size_t i = 0; i < count; ++i)
+			dst[i] += dst[i];
+		break;
+
+	case VECTOR_NUMERIC_SUB:
+		VECTOR_PARALLEL_FOR(count)
+		for (vector_size_t i = 0; i < count; ++i)
+			dst[i] = 0;
+		break;
+
+	case VECTOR_NUMERIC_MUL:
+		VECTOR_PARALLEL_FOR(count)
+		for (vector_size_t i = 0; i < count; ++i)
+			dst[i] *= dst[i];
+		break;
+
+	case VECTOR_NUMERIC_AXPY:
+		VECTOR_PARALLEL_FOR(count)
+		for (vector_size_t i = 0; i < count; ++i)
+			dst[i] += alpha * dst[i];
+		break;
+	}
+}
+
+static void VECTOR_FUNC(binary)(
+	VECTOR_SELF self,
+	VECTOR_CSELF other,
+	vector_numeric_op_t op,
+	T alpha,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK_INPUT_RANGE(self, error, )
+	VECTOR_CHECK_INPUT_RANGE(other, error, )
+
+	const vector_size_t count = VECTOR_SIZE(VECTOR_DEREF(self));
+
+	VECTOR_CHECK(
+		VECTOR_SIZE(VECTOR_DEREF(other)) == count,
+		error,
+		VECTOR_ERROR_INDEX,
+	)
+
+	/* Detach first: a shared buffer of other is then no longer ours */
+	VECTOR_COW_DETACH(VECTOR_DEREF(self), error, )
+
+	T *dst = VECTOR_BEGIN(VECTOR_DEREF(self));
+	const T *src = VECTOR_BEGIN(VECTOR_DEREF(other));
+
+	if (dst == src)
+		VECTOR_FUNC(binary_kernel_self)(dst, count, op, alpha);
+	else
+		VECTOR_FUNC(binary_kernel)(dst, src, count, op, alpha);
+
+	VECTOR_INDEX_DIRTY(VECTOR_DEREF(self))
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API void VECTOR_FUNC(add)(
+	VECTOR_SELF self,
+	VECTOR_CSELF other,
+	vector_error_t *error
+)
+{
+	VECTOR_FUNC(binary)(self, other, VECTOR_NUMERIC_ADD, (T)0, error);
+}
+
+VECTOR_API void VECTOR_FUNC(sub)(
+	VECTOR_SELF self,
+	VECTOR_CSELF other,
+	vector_error_t *error
+)
+{
+	VECTOR_FUNC(binary)(self, other, VECTOR_NUMERIC_SUB, (T)0, error);
+}
+
+VECTOR_API void VECTOR_FUNC(mul)(
+	VECTOR_SELF self,
+	VECTOR_CSELF other,
+	vector_error_t *error
+)
+{
+	VECTOR_FUNC(binary)(self, other, VECTOR_NUMERIC_MUL, (T)0, error);
+}
+
+VECTOR_API void VECTOR_FUNC(axpy)(
+	VECTOR_SELF self,
+	T alpha,
+	VECTOR_CSELF x,
+	vector_error_t *error
+)
+{
+	VECTOR_FUNC(binary)(self, x, VECTOR_NUMERIC_AXPY, alpha, error);
+}
+
+VECTOR_API void VECTOR_FUNC(scale)(
+	VECTOR_SELF self,
+	T factor,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK_INPUT_RANGE(self, error, )
+	VECTOR_COW_DETACH(VECTOR_DEREF(self), error, )
+
+	T *data = VECTOR_BEGIN(VECTOR_DEREF(self));
+	const vector_size_t count = VECTOR_SIZE(VECTOR_DEREF(self));
+
+	VECTOR_PARALLEL_FOR(count)
+	for (vector_size_t i = 0; i < count; ++i)
+		data[i] *= factor;
+
+	VECTOR_INDEX_DIRTY(VECTOR_DEREF(self))
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API void VECTOR_FUNC(clamp)(
+	VECTOR_SELF self,
+	T lo,
+	T hi,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK_INPUT_RANGE(self, error, )
+	VECTOR_CHECK(!(hi < lo), error, VECTOR_ERROR_INDEX, )
+	VECTOR_COW_DETACH(VECTOR_DEREF(self), error, )
+
+	T *data = VECTOR_BEGIN(VECTOR_DEREF(self));
+	const vector_size_t count = VECTOR_SIZE(VECTOR_DEREF(self));
+
+	VECTOR_PARALLEL_FOR(count)
+	for (vector_size_t i = 0; i < count; ++i)
+	{
+		const T value = data[i];
+
+		data[i] = (value < lo) ? lo : ((hi < value) ? hi : value);
+	}
+
+	VECTOR_INDEX_DIRTY(VECTOR_DEREF(self))
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API void VECTOR_FUNC(abs)(VECTOR_SELF self, vector_error_t *error)
+{
+	VECTOR_CHECK_INPUT_RANGE(self, error, )
+
+	/* Unsigned types are left untouched */
+	if ((T)-1 > (T)0)
+	{
+		if (error != NULL)
+			*error = VECTOR_ERROR_SUCCESS;
+		return;
+	}
+
+	VECTOR_COW_DETACH(VECTOR_DEREF(self), error, )
+
+	T *data = VECTOR_BEGIN(VECTOR_DEREF(self));
+	const vector_size_t count = VECTOR_SIZE(VECTOR_DEREF(self));
+
+	VECTOR_PARALLEL_FOR(count)
+	for (vector_size_t i = 0; i < count; ++i)
+	{
+		const T value = data[i];
+
+#if VECTOR_HAS_TRAIT(RADIX)
+		/* Negated in unsigned arithmetic: no overflow for the minimum */
+		data[i] = (value < 0) ? (T)(0 - (uint64_t)value) : value;
+#else // VECTOR_HAS_TRAIT(RADIX)
+		data[i] = (value < 0) ? -value : value;
+#endif // VECTOR_HAS_TRAIT(RADIX)
+	}
+
+	VECTOR_INDEX_DIRTY(VECTOR_DEREF(self))
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+#if VECTOR_HAS_TRAIT(RADIX)
+
+/*
+ * Products of elements up to 16 bits are summed in int64_t chunks the
+ * compiler vectorizes; wider elements check every product and sum.
+ */
+VECTOR_API int64_t VECTOR_FUNC(dot)(
+	VECTOR_CSELF a,
+	VECTOR_CSELF b,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK_INPUT_RANGE(a, error, 0)
+	VECTOR_CHECK_INPUT_RANGE(b, error, 0)
+
+	const vector_size_t count = VECTOR_SIZE(VECTOR_DEREF(a));
+
+	VECTOR_CHECK(VECTOR_SIZE(VECTOR_DEREF(b)) == count, error, VECTOR_ERROR_INDEX, 0)
+
+	const T *VECTOR_RESTRICT x = VECTOR_BEGIN(VECTOR_DEREF(a));
+	const T *VECTOR_RESTRICT y = VECTOR_BEGIN(VECTOR_DEREF(b));
+	const bool is_unsigned = (T)-1 > (T)0;
+	int64_t total = 0;
+	bool overflow = false;
+
+	for (vector_size_t begin = 0; begin < count && !overflow; )
+	{
+		const vector_size_t end = (count - begin > VECTOR_DOT_CHUNK) ? begin + VECTOR_DOT_CHUNK : count;
+		int64_t chunk = 0;
+
+		if (sizeof(T) <= 2)
+		{
+			for (vector_size_t i = begin; i < end; ++i)
+				chunk += (int64_t)x[i] * (int64_t)y[i];
+		}
+		else
+		{
+			for (vector_size_t i = begin; i < end && !overflow; ++i)
+			{
+				int64_t product;
+
+				overflow = is_unsigned
+					&& ((uint64_t)x[i] > (uint64_t)INT64_MAX || (uint64_t)y[i] > (uint64_t)INT64_MAX);
+				overflow = overflow
+					|| vector_mul_overflow_i64((int64_t)x[i], (int64_t)y[i], &product)
+					|| vector_add_overflow_i64(chunk, product, &chunk);
+			}
+		}
+
+		overflow = overflow || vector_add_overflow_i64(total, chunk, &total);
+		begin = end;
+	}
+
+	if (error != NULL)
+		*error = overflow ? VECTOR_ERROR_OVERFLOW : VECTOR_ERROR_SUCCESS;
+
+	return total;
+}
+
+#else // VECTOR_HAS_TRAIT(RADIX)
+
+VECTOR_API double VECTOR_FUNC(dot)(
+	VECTOR_CSELF a,
+	VECTOR_CSELF b,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK_INPUT_RANGE(a, error, 0.0)
+	VECTOR_CHECK_INPUT_RANGE(b, error, 0.0)
+
+	const vector_size_t count = VECTOR_SIZE(VECTOR_DEREF(a));
+
+	VECTOR_CHECK(VECTOR_SIZE(VECTOR_DEREF(b)) == count, error, VECTOR_ERROR_INDEX, 0.0)
+
+	const T *VECTOR_RESTRICT x = VECTOR_BEGIN(VECTOR_DEREF(a));
+	const T *VECTOR_RESTRICT y = VECTOR_BEGIN(VECTOR_DEREF(b));
+
+	/* Independent lanes: the sum order is fixed, so no -ffast-math is needed */
+	double acc[8] = { 0 };
+	vector_size_t i = 0;
+
+	for (; i + 8 <= count; i += 8)
+	{
+		for (unsigned lane = 0; lane < 8; ++lane)
+			acc[lane] += (double)x[i + lane] * (double)y[i + lane];
+	}
+
+	for (; i < count; ++i)
+		acc[0] += (double)x[i] * (double)y[i];
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return ((acc[0] + acc[1]) + (acc[2] + acc[3])) + ((acc[4] + acc[5]) + (acc[6] + acc[7]));
+}
+
+#endif // VECTOR_HAS_TRAIT(RADIX)
+
+/* Make self hold count elements to be overwritten, false on failure */
+static bool VECTOR_FUNC(convert_target)(
+	VECTOR_SELF self,
+	vector_size_t count,
+	vector_error_t *error
+)
+{
+#ifdef VECTOR_NO_DYNAMIC_ALLOC
+	if (count > self->__capacity)
+	{
+		VECTOR_FUNC(reserve)(self, (vector_index_t)count, error);
+
+		if (count > self->__capacity)
+			return false;
+	}
+
+	self->__size = count;
+#else // VECTOR_NO_DYNAMIC_ALLOC
+	if (!VECTOR_FUNC(ensure_capacity)(self, count, error))
+		return false;
+
+	VECTOR_COW_DETACH(*self, error, false)
+
+	PRIVATE(*self)->__size = count;
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+
+	VECTOR_INDEX_DIRTY(VECTOR_DEREF(self))
+
+	return true;
+}
+
+#if VECTOR_HAS_TRAIT(RADIX)
+/* Integer sums wrap like unsigned arithmetic instead of overflowing */
+#define VECTOR_SCAN_ADD(_a, _b) 	((T)((uint64_t)(_a) + (uint64_t)(_b)))
+#else // VECTOR_HAS_TRAIT(RADIX)
+#define VECTOR_SCAN_ADD(_a, _b) 	((_a) + (_b))
+#endif // VECTOR_HAS_TRAIT(RADIX)
+
+/* Sequential prefix sums of one block starting from carry, returns the total */
+static T VECTOR_FUNC(scan_sum_block)(
+	T *dst,
+	const T *src,
+	vector_size_t count,
+	T carry,
+	bool exclusive
+)
+{
+	vector_size_t i = 0;
+
+#if VECTOR_HAS_TRAIT(RADIX)
+	if (sizeof(T) == sizeof(uint32_t))
+	{
+		uint32_t total = (uint32_t)carry;
+
+		i = (vector_size_t)vector_simd_prefix_sum_u32(dst, src, count, exclusive, &total);
+		carry = (T)total;
+	}
+#endif // VECTOR_HAS_TRAIT(RADIX)
+
+	if (exclusive)
+	{
+		for (; i < count; ++i)
+		{
+			const T value = src[i];
+
+			dst[i] = carry;
+			carry = VECTOR_SCAN_ADD(carry, value);
+		}
+	}
+	else
+	{
+		for (; i < count; ++i)
+		{
+			carry = VECTOR_SCAN_ADD(carry, src[i]);
+			dst[i] = carry;
+		}
+	}
+
+	return carry;
+}
+
+/* Sequential fold of one block, has_carry is false only for an inclusive start */
+static T VECTOR_FUNC(scan_op_block)(
+	T *dst,
+	const T *src,
+	vector_size_t count,
+	TEMPLATE(vector_scan_fn, T) op,
+	void *ctx,
+	T carry,
+	bool has_carry,
+	bool exclusive
+)
+{
+	for (vector_size_t i = 0; i < count; ++i)
+	{
+		const T value = src[i];
+
+		if (exclusive)
+		{
+			dst[i] = carry;
+			carry = op(carry, value, ctx);
+		}
+		else
+		{
+			carry = has_carry ? op(carry, value, ctx) : value;
+			has_carry = true;
+			dst[i] = carry;
+		}
+	}
+
+	return carry;
+}
+
+/*
+ * op == NULL scans with +. Large inputs are split into one block per
+ * thread: the first pass folds every block (read only), the block totals
+ * are scanned sequentially and the second pass scans every block from its
+ * offset. Each pass touches disjoint ranges, so dst may be src.
+ */
+static void VECTOR_FUNC(scan)(
+	T *dst,
+	const T *src,
+	vector_size_t count,
+	TEMPLATE(vector_scan_fn, T) op,
+	void *ctx,
+	T init,
+	bool exclusive
+)
+{
+#if defined(VECTOR_OPENMP) && defined(_OPENMP)
+	int blocks = omp_get_max_threads();
+
+	if (blocks > VECTOR_SCAN_MAX_BLOCKS)
+		blocks = VECTOR_SCAN_MAX_BLOCKS;
+
+	if (count >= VECTOR_PARALLEL_THRESHOLD && blocks > 1)
+	{
+		const vector_size_t block = (count + (vector_size_t)blocks - 1) / (vector_size_t)blocks;
+		T offsets[VECTOR_SCAN_MAX_BLOCKS];
+
+		VECTOR_PRAGMA(omp parallel for schedule(static))
+		for (int b = 0; b < blocks; ++b)
+		{
+			const vector_size_t begin = (vector_size_t)b * block;
+			const vector_size_t end = (count - begin > block) ? begin + block : count;
+			T total = (begin < end) ? src[begin] : (T)0;
+
+			for (vector_size_t i = begin + 1; i < end; ++i)
+				total = (op != NULL) ? op(total, src[i], ctx) : VECTOR_SCAN_ADD(total, src[i]);
+
+			offsets[b] = total;
+		}
+
+		/* offsets[b] becomes the fold of everything before block b */
+		T carry = init;
+
+		for (int b = 0; b < blocks; ++b)
+		{
+			const T total = offsets[b];
+			const bool first = (b == 0) && !exclusive && (op != NULL);
+
+			offsets[b] = carry;
+			carry = first ? total
+				: ((op != NULL) ? op(carry, total, ctx) : VECTOR_SCAN_ADD(carry, total));
+		}
+
+		VECTOR_PRAGMA(omp parallel for schedule(static))
+		for (int b = 0; b < blocks; ++b)
+		{
+			const vector_size_t begin = (vector_size_t)b * block;
+			const vector_size_t end = (count - begin > block) ? begin + block : count;
+
+			if (begin >= end)
+				continue;
+
+			if (op != NULL)
+				VECTOR_FUNC(scan_op_block)(
+					dst + begin, src + begin, end - begin, op, ctx,
+					offsets[b], exclusive || b > 0, exclusive
+				);
+			else
+				VECTOR_FUNC(scan_sum_block)(dst + begin, src + begin, end - begin, offsets[b], exclusive);
+		}
+
+		return;
+	}
+#endif // VECTOR_OPENMP && _OPENMP
+
+	if (op != NULL)
+		VECTOR_FUNC(scan_op_block)(dst, src, count, op, ctx, init, exclusive, exclusive);
+	else
+		VECTOR_FUNC(scan_sum_block)(dst, src, count, init, exclusive);
+}
+
+static void VECTOR_FUNC(scan_vector)(
+	VECTOR_SELF self,
+	VECTOR_CSELF src,
+	TEMPLATE(vector_scan_fn, T) op,
+	void *ctx,
+	T init,
+	bool exclusive,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK_INPUT_RANGE(self, error, )
+	VECTOR_CHECK_INPUT_RANGE(src, error, )
+
+	const vector_size_t count = VECTOR_SIZE(VECTOR_DEREF(src));
+
+	if (!VECTOR_FUNC(convert_target)(self, count, error))
+		return;
+
+	/* Taken after convert_target: it may detach a buffer shared with src */
+	VECTOR_FUNC(scan)(
+		VECTOR_BEGIN(VECTOR_DEREF(self)),
+		VECTOR_BEGIN(VECTOR_DEREF(src)),
+		count,
+		op,
+		ctx,
+		init,
+		exclusive
+	);
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+VECTOR_API void VECTOR_FUNC(inclusive_scan)(
+	VECTOR_SELF self,
+	VECTOR_CSELF src,
+	vector_error_t *error
+)
+{
+	VECTOR_FUNC(scan_vector)(self, src, NULL, NULL, (T)0, false, error);
+}
+
+VECTOR_API void VECTOR_FUNC(exclusive_scan)(
+	VECTOR_SELF self,
+	VECTOR_CSELF src,
+	T init,
+	vector_error_t *error
+)
+{
+	VECTOR_FUNC(scan_vector)(self, src, NULL, NULL, init, true, error);
+}
+
+VECTOR_API void VECTOR_FUNC(inclusive_scan_op)(
+	VECTOR_SELF self,
+	VECTOR_CSELF src,
+	TEMPLATE(vector_scan_fn, T) op,
+	void *ctx,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(op != NULL, error, VECTOR_ERROR_NULL, )
+
+	VECTOR_FUNC(scan_vector)(self, src, op, ctx, (T)0, false, error);
+}
+
+VECTOR_API void VECTOR_FUNC(exclusive_scan_op)(
+	VECTOR_SELF self,
+	VECTOR_CSELF src,
+	T init,
+	TEMPLATE(vector_scan_fn, T) op,
+	void *ctx,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(op != NULL, error, VECTOR_ERROR_NULL, )
+
+	VECTOR_FUNC(scan_vector)(self, src, op, ctx, init, true, error);
+}
+
+#undef VECTOR_SCAN_ADD
+
+#ifdef VECTOR_ARITHMETIC_TYPES
+
+#define VECTOR_CONVERT_FROM_IMPL(_src) \
+	VECTOR_API void VECTOR_FUNC(TEMPLATE(convert_from, _src))( \
+		VECTOR_SELF self, \
+		const _src *data, \
+		vector_size_t count, \
+		vector_error_t *error \
+	) \
+	{ \
+		VECTOR_CHECK_INPUT_RANGE(self, error, ) \
+		VECTOR_CHECK(data != NULL || count == 0, error, VECTOR_ERROR_NULL, ) \
+		\
+		if (!VECTOR_FUNC(convert_target)(self, count, error)) \
+			return; \
+		\
+		T *VECTOR_RESTRICT dst = VECTOR_BEGIN(VECTOR_DEREF(self)); \
+		\
+		VECTOR_PARALLEL_FOR(count) \
+		for (vector_size_t i = 0; i < count; ++i) \
+			dst[i] = (T)data[i]; \
+		\
+		if (error != NULL) \
+			*error = VECTOR_ERROR_SUCCESS; \
+	}
+
+VECTOR_ARITHMETIC_TYPES(VECTOR_CONVERT_FROM_IMPL)
+
+#undef VECTOR_CONVERT_FROM_IMPL
+
+#endif // VECTOR_ARITHMETIC_TYPES
+
+
+#undef VECTOR
+#undef VECTOR_FUNC
+#undef PRIVATE
+#undef VECTOR_ACC
+
+
+#endif // VECTOR_HAS_TRAIT(ARITHMETIC)
+
+#endif // T
@@ -0,0 +1,202 @@
+/**
+ * @file      vector_numeric_template.h
+ * @brief     Template declarations for element-wise numeric kernels
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   BLAS level 1 style operations for ARITHMETIC types, shared by
+ *            dynamic and static vectors like the algorithms: element-wise
+ *            add/sub/mul of two vectors of the same size, scale, axpy, dot,
+ *            clamp and abs.
+ *
+ *            The kernels work on the element buffers directly. Buffers of
+ *            two different vectors never overlap, so they are passed as
+ *            VECTOR_RESTRICT pointers and the loops vectorize without alias
+ *            checks; a vector combined with itself takes a separate
+ *            in-place path. With VECTOR_OPENMP the loops are split across
+ *            threads above VECTOR_PARALLEL_THRESHOLD elements.
+ *
+ *            inclusive_scan and exclusive_scan compute prefix sums (or
+ *            prefix folds of an associative operation) in place or into
+ *            another vector; with VECTOR_OPENMP large inputs are scanned by
+ *            blocks in two parallel passes.
+ *
+ *            For every pair of arithmetic types convert_from_S copies an
+ *            array of S into the vector with C conversions, e.g.
+ *            vector_convert_from_int_t_double_t() fills a double vector
+ *            from ints.
+ *
+ * @note      Included after the container template for every T.
+ *
+ * @see       vector_numeric_template.c
+ * @see       vector_algorithm_template.h
+ */
+
+#ifdef T
+
+#include "template.h"
+#include "vector_traits.h"
+#include "vector_error.h"
+
+#include <stdint.h>
+
+
+#if VECTOR_HAS_TRAIT(ARITHMETIC)
+
+
+#ifndef VECTOR
+#define VECTOR 					TEMPLATE(vector, T)
+#endif // VECTOR
+
+#ifndef VECTOR_FUNC
+#define VECTOR_FUNC(_name) 		TEMPLATE(vector, TEMPLATE(_name, T))
+#endif // VECTOR_FUNC
+
+/* Accumulator of dot(): 64-bit integer or double */
+#ifndef VECTOR_ACC
+#if VECTOR_HAS_TRAIT(RADIX)
+#define VECTOR_ACC 				int64_t
+#else // VECTOR_HAS_TRAIT(RADIX)
+#define VECTOR_ACC 				double
+#endif // VECTOR_HAS_TRAIT(RADIX)
+#endif // VECTOR_ACC
+
+
+/**
+ * @brief self[i] += other[i], VECTOR_ERROR_INDEX when the sizes differ
+ */
+VECTOR_API void VECTOR_FUNC(add)(
+	VECTOR_SELF self,
+	VECTOR_CSELF other,
+	vector_error_t *error
+);
+/**
+ * @brief self[i] -= other[i]
+ */
+VECTOR_API void VECTOR_FUNC(sub)(
+	VECTOR_SELF self,
+	VECTOR_CSELF other,
+	vector_error_t *error
+);
+/**
+ * @brief self[i] *= other[i]
+ */
+VECTOR_API void VECTOR_FUNC(mul)(
+	VECTOR_SELF self,
+	VECTOR_CSELF other,
+	vector_error_t *error
+);
+/**
+ * @brief self[i] += alpha * x[i]
+ */
+VECTOR_API void VECTOR_FUNC(axpy)(
+	VECTOR_SELF self,
+	T alpha,
+	VECTOR_CSELF x,
+	vector_error_t *error
+);
+/**
+ * @brief self[i] *= factor
+ */
+VECTOR_API void VECTOR_FUNC(scale)(
+	VECTOR_SELF self,
+	T factor,
+	vector_error_t *error
+);
+/**
+ * @brief Limit every element to [lo, hi], VECTOR_ERROR_INDEX when hi < lo
+ */
+VECTOR_API void VECTOR_FUNC(clamp)(
+	VECTOR_SELF self,
+	T lo,
+	T hi,
+	vector_error_t *error
+);
+/**
+ * @brief Absolute value of every element (the minimum of a signed type stays)
+ */
+VECTOR_API void VECTOR_FUNC(abs)(VECTOR_SELF self, vector_error_t *error);
+/**
+ * @brief Sum of a[i] * b[i]
+ *
+ * Integer types report VECTOR_ERROR_OVERFLOW when a product or the sum does
+ * not fit int64_t, floating-point types are accumulated in double.
+ */
+VECTOR_API VECTOR_ACC VECTOR_FUNC(dot)(
+	VECTOR_CSELF a,
+	VECTOR_CSELF b,
+	vector_error_t *error
+);
+
+/* Associative operation of the generic scans */
+typedef T (*TEMPLATE(vector_scan_fn, T))(T acc, T value, void *ctx);
+
+/**
+ * @brief self[i] = src[0] + ... + src[i]
+ *
+ * @p src may be @p self (in place), a dynamic @p self is resized to the
+ * size of @p src. Integer sums wrap around like unsigned arithmetic.
+ */
+VECTOR_API void VECTOR_FUNC(inclusive_scan)(
+	VECTOR_SELF self,
+	VECTOR_CSELF src,
+	vector_error_t *error
+);
+/**
+ * @brief self[0] = init, self[i] = init + src[0] + ... + src[i - 1]
+ */
+VECTOR_API void VECTOR_FUNC(exclusive_scan)(
+	VECTOR_SELF self,
+	VECTOR_CSELF src,
+	T init,
+	vector_error_t *error
+);
+/**
+ * @brief self[i] = op(...op(src[0], src[1])..., src[i])
+ *
+ * @p op must be associative: large inputs are scanned in blocks.
+ */
+VECTOR_API void VECTOR_FUNC(inclusive_scan_op)(
+	VECTOR_SELF self,
+	VECTOR_CSELF src,
+	TEMPLATE(vector_scan_fn, T) op,
+	void *ctx,
+	vector_error_t *error
+);
+/**
+ * @brief self[0] = init, self[i] = op(self[i - 1], src[i - 1])
+ */
+VECTOR_API void VECTOR_FUNC(exclusive_scan_op)(
+	VECTOR_SELF self,
+	VECTOR_CSELF src,
+	T init,
+	TEMPLATE(vector_scan_fn, T) op,
+	void *ctx,
+	vector_error_t *error
+);
+
+#ifdef VECTOR_ARITHMETIC_TYPES
+/* vector_convert_from_S_T(self, const S *data, count, error) for every S */
+#define VECTOR_CONVERT_FROM_DECL(_src) \
+	VECTOR_API void VECTOR_FUNC(TEMPLATE(convert_from, _src))( \
+		VECTOR_SELF self, \
+		const _src *data, \
+		vector_size_t count, \
+		vector_error_t *error \
+	);
+
+VECTOR_ARITHMETIC_TYPES(VECTOR_CONVERT_FROM_DECL)
+
+#undef VECTOR_CONVERT_FROM_DECL
+#endif // VECTOR_ARITHMETIC_TYPES
+
+
+#undef VECTOR
+#undef VECTOR_FUNC
+#undef VECTOR_ACC
+
+
+#endif // VECTOR_HAS_TRAIT(ARITHMETIC)
+
+#endif // T
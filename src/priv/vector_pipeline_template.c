@@ -0,0 +1,409 @@
+/**
+ * @file      vector_pipeline_template.c
+ * @brief     Template implementation of lazy pipelines
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   All consumers share next_block(): it loads the next block of
+ *            the source and runs the stages over it in order until the
+ *            block is non-empty or the source (or a take) is exhausted.
+ *
+ * @note      This file should not be included directly.
+ *            Use the generated vector_impl.c instead.
+ *
+ * @see       vector_pipeline_template.h
+ */
+
+#ifdef T
+
+#include "template.h"
+#include "vector_traits.h"
+#include "vector_error.h"
+
+
+#ifndef VECTOR
+#define VECTOR 						TEMPLATE(vector, T)
+#endif // VECTOR
+
+#ifndef VECTOR_FUNC
+#define VECTOR_FUNC(_name) 			TEMPLATE(vector, TEMPLATE(_name, T))
+#endif // VECTOR_FUNC
+
+#ifndef VECTOR_SPAN
+#define VECTOR_SPAN 				TEMPLATE(vector_span, T)
+#endif // VECTOR_SPAN
+
+#ifndef VECTOR_PIPE
+#define VECTOR_PIPE 				TEMPLATE(vector_pipe, T)
+#endif // VECTOR_PIPE
+
+#ifndef VECTOR_PIPE_FUNC
+#define VECTOR_PIPE_FUNC(_name) 	TEMPLATE(vector_pipe, TEMPLATE(_name, T))
+#endif // VECTOR_PIPE_FUNC
+
+#ifndef VECTOR_PIPE_CURSOR
+#define VECTOR_PIPE_CURSOR 			TEMPLATE(vector_pipe_cursor, T)
+#endif // VECTOR_PIPE_CURSOR
+
+
+/**
+ * @var position   Next source element to load
+ * @var remaining  Elements left to take or skip, per stage
+ * @var done       A take stage is exhausted, nothing more is yielded
+ */
+typedef struct TEMPLATE(vector_pipe_cursor_t, T)
+{
+	vector_size_t position;
+	vector_size_t remaining[VECTOR_PIPE_MAX_STAGES];
+	bool done;
+} VECTOR_PIPE_CURSOR;
+
+
+static VECTOR_INLINE void VECTOR_PIPE_FUNC(add_stage)(
+	VECTOR_PIPE *pipe,
+	TEMPLATE(vector_pipe_stage, T) stage,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(pipe != NULL, error, VECTOR_ERROR_NULL, )
+	VECTOR_CHECK(
+		pipe->stage_count < VECTOR_PIPE_MAX_STAGES,
+		error,
+		VECTOR_ERROR_CAPACITY,
+	)
+
+	pipe->stages[pipe->stage_count++] = stage;
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+}
+
+static VECTOR_INLINE void VECTOR_PIPE_FUNC(start)(
+	const VECTOR_PIPE *pipe,
+	VECTOR_PIPE_CURSOR *cursor
+)
+{
+	cursor->position = 0;
+	cursor->done = false;
+
+	for (vector_size_t s = 0; s < pipe->stage_count; ++s)
+		cursor->remaining[s] = pipe->stages[s].count;
+}
+
+/*
+ * Fill block with the next elements of the pipeline, 0 when it is finished.
+ * A take stage that runs out marks the cursor done, so the rest of the
+ * source is never loaded.
+ */
+static vector_size_t VECTOR_PIPE_FUNC(next_block)(
+	const VECTOR_PIPE *pipe,
+	VECTOR_PIPE_CURSOR *cursor,
+	T *block
+)
+{
+	const VECTOR_SPAN source = pipe->source;
+
+	while (!cursor->done && cursor->position < source.size)
+	{
+		const vector_size_t left = source.size - cursor->position;
+		vector_size_t count = (left < (vector_size_t)VECTOR_PIPE_BLOCK)
+			? left
+			: (vector_size_t)VECTOR_PIPE_BLOCK;
+
+		for (vector_size_t i = 0; i < count; ++i)
+			block[i] = VECTOR_SPAN_DATA(source, cursor->position + i);
+
+		cursor->position += count;
+
+		for (vector_size_t s = 0; s < pipe->stage_count && count > 0; ++s)
+		{
+			const TEMPLATE(vector_pipe_stage, T) *stage = &pipe->stages[s];
+			vector_size_t *remaining = &cursor->remaining[s];
+
+			switch (stage->kind)
+			{
+			case VECTOR_PIPE_MAP:
+				for (vector_size_t i = 0; i < count; ++i)
+					block[i] = stage->map(block[i], stage->ctx);
+				break;
+
+			case VECTOR_PIPE_FILTER:
+			{
+				/* Branchless compaction: always write, advance on match */
+				vector_size_t kept = 0;
+
+				for (vector_size_t i = 0; i < count; ++i)
+				{
+					block[kept] = block[i];
+					kept += stage->pred(block[i], stage->ctx) ? 1 : 0;
+				}
+
+				count = kept;
+				break;
+			}
+
+			case VECTOR_PIPE_SKIP:
+			{
+				const vector_size_t dropped = (*remaining < count) ? *remaining : count;
+
+				for (vector_size_t i = dropped; i < count; ++i)
+					block[i - dropped] = block[i];
+
+				*remaining -= dropped;
+				count -= dropped;
+				break;
+			}
+
+			case VECTOR_PIPE_TAKE:
+				if (count >= *remaining)
+				{
+					count = *remaining;
+					cursor->done = true;
+				}
+
+				*remaining -= count;
+				break;
+			}
+		}
+
+		if (count > 0)
+			return count;
+	}
+
+	return 0;
+}
+
+
+VECTOR_API VECTOR_INLINE VECTOR_PIPE VECTOR_PIPE_FUNC(from)(VECTOR_SPAN source)
+{
+	return (VECTOR_PIPE){ .source = source, .stage_count = 0 };
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_PIPE_FUNC(filter)(
+	VECTOR_PIPE *pipe,
+	TEMPLATE(vector_pipe_pred_fn, T) pred,
+	void *ctx,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(pred != NULL, error, VECTOR_ERROR_NULL, )
+
+	VECTOR_PIPE_FUNC(add_stage)(
+		pipe,
+		(TEMPLATE(vector_pipe_stage, T)){
+			.kind = VECTOR_PIPE_FILTER,
+			.pred = pred,
+			.ctx = ctx
+		},
+		error
+	);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_PIPE_FUNC(map)(
+	VECTOR_PIPE *pipe,
+	TEMPLATE(vector_pipe_map_fn, T) map,
+	void *ctx,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(map != NULL, error, VECTOR_ERROR_NULL, )
+
+	VECTOR_PIPE_FUNC(add_stage)(
+		pipe,
+		(TEMPLATE(vector_pipe_stage, T)){
+			.kind = VECTOR_PIPE_MAP,
+			.map = map,
+			.ctx = ctx
+		},
+		error
+	);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_PIPE_FUNC(take)(
+	VECTOR_PIPE *pipe,
+	vector_size_t count,
+	vector_error_t *error
+)
+{
+	VECTOR_PIPE_FUNC(add_stage)(
+		pipe,
+		(TEMPLATE(vector_pipe_stage, T)){
+			.kind = VECTOR_PIPE_TAKE,
+			.count = count
+		},
+		error
+	);
+}
+
+VECTOR_API VECTOR_INLINE void VECTOR_PIPE_FUNC(skip)(
+	VECTOR_PIPE *pipe,
+	vector_size_t count,
+	vector_error_t *error
+)
+{
+	VECTOR_PIPE_FUNC(add_stage)(
+		pipe,
+		(TEMPLATE(vector_pipe_stage, T)){
+			.kind = VECTOR_PIPE_SKIP,
+			.count = count
+		},
+		error
+	);
+}
+
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_PIPE_FUNC(estimate)(const VECTOR_PIPE *pipe)
+{
+	vector_size_t estimate = pipe->source.size;
+
+	for (vector_size_t s = 0; s < pipe->stage_count; ++s)
+	{
+		const vector_size_t count = pipe->stages[s].count;
+
+		if (pipe->stages[s].kind == VECTOR_PIPE_SKIP)
+			estimate = (estimate > count) ? estimate - count : 0;
+		else if (pipe->stages[s].kind == VECTOR_PIPE_TAKE && estimate > count)
+			estimate = count;
+	}
+
+	return estimate;
+}
+
+VECTOR_API vector_size_t VECTOR_PIPE_FUNC(drain)(
+	const VECTOR_PIPE *pipe,
+	T *out,
+	vector_size_t capacity,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(pipe != NULL, error, VECTOR_ERROR_NULL, 0)
+	VECTOR_CHECK(out != NULL || capacity == 0, error, VECTOR_ERROR_NULL, 0)
+
+	VECTOR_PIPE_CURSOR cursor;
+	T block[VECTOR_PIPE_BLOCK];
+	vector_size_t written = 0;
+
+	VECTOR_PIPE_FUNC(start)(pipe, &cursor);
+
+	while (written < capacity)
+	{
+		vector_size_t count = VECTOR_PIPE_FUNC(next_block)(pipe, &cursor, block);
+
+		if (count == 0)
+			break;
+
+		if (count > capacity - written)
+			count = capacity - written;
+
+		for (vector_size_t i = 0; i < count; ++i)
+			out[written + i] = block[i];
+
+		written += count;
+	}
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return written;
+}
+
+VECTOR_API T VECTOR_PIPE_FUNC(reduce)(
+	const VECTOR_PIPE *pipe,
+	T init,
+	TEMPLATE(vector_pipe_fold_fn, T) fold,
+	void *ctx,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(pipe != NULL && fold != NULL, error, VECTOR_ERROR_NULL, init)
+
+	VECTOR_PIPE_CURSOR cursor;
+	T block[VECTOR_PIPE_BLOCK];
+	T acc = init;
+
+	VECTOR_PIPE_FUNC(start)(pipe, &cursor);
+
+	for (vector_size_t count; (count = VECTOR_PIPE_FUNC(next_block)(pipe, &cursor, block)) > 0; )
+	{
+		for (vector_size_t i = 0; i < count; ++i)
+			acc = fold(acc, block[i], ctx);
+	}
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return acc;
+}
+
+VECTOR_API vector_size_t VECTOR_PIPE_FUNC(count)(
+	const VECTOR_PIPE *pipe,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(pipe != NULL, error, VECTOR_ERROR_NULL, 0)
+
+	VECTOR_PIPE_CURSOR cursor;
+	T block[VECTOR_PIPE_BLOCK];
+	vector_size_t total = 0;
+
+	VECTOR_PIPE_FUNC(start)(pipe, &cursor);
+
+	for (vector_size_t count; (count = VECTOR_PIPE_FUNC(next_block)(pipe, &cursor, block)) > 0; )
+		total += count;
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return total;
+}
+
+#ifndef VECTOR_NO_DYNAMIC_ALLOC
+
+VECTOR_API void VECTOR_PIPE_FUNC(collect)(
+	const VECTOR_PIPE *pipe,
+	VECTOR **dst,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(pipe != NULL && dst != NULL && *dst != NULL, error, VECTOR_ERROR_NULL, )
+
+	VECTOR_FUNC(reserve)(
+		dst,
+		VECTOR_FUNC(size)((const VECTOR **)dst) + VECTOR_PIPE_FUNC(estimate)(pipe),
+		error
+	);
+
+	VECTOR_PIPE_CURSOR cursor;
+	T block[VECTOR_PIPE_BLOCK];
+	vector_error_t append_error = VECTOR_ERROR_SUCCESS;
+
+	VECTOR_PIPE_FUNC(start)(pipe, &cursor);
+
+	for (vector_size_t count; (count = VECTOR_PIPE_FUNC(next_block)(pipe, &cursor, block)) > 0; )
+	{
+		VECTOR_FUNC(append_span)(
+			dst,
+			TEMPLATE(vector_span, TEMPLATE(from, T))(block, count),
+			&append_error
+		);
+
+		if (append_error != VECTOR_ERROR_SUCCESS)
+			break;
+	}
+
+	if (error != NULL)
+		*error = append_error;
+}
+
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+
+
+#undef VECTOR
+#undef VECTOR_FUNC
+#undef VECTOR_SPAN
+#undef VECTOR_PIPE
+#undef VECTOR_PIPE_FUNC
+#undef VECTOR_PIPE_CURSOR
+
+
+#endif // T
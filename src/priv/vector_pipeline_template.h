@@ -0,0 +1,208 @@
+/**
+ * @file      vector_pipeline_template.h
+ * @brief     Template declarations for lazy pipelines
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   vector_pipe_T describes a chain of stages (filter, map, take,
+ *            skip) over a span. Building the chain does no work: the stages
+ *            run when the pipeline is consumed by collect, drain, reduce or
+ *            count, in one fused pass over the source.
+ *
+ *            The source is read VECTOR_PIPE_BLOCK elements at a time into a
+ *            buffer on the stack. Every stage then runs as a tight loop over
+ *            the block (a map is one call per element, a filter compacts the
+ *            block without branches), so no intermediate vector is created
+ *            and the loops stay simple enough to vectorize.
+ *
+ * @note      The source span must stay valid while the pipeline is consumed.
+ *
+ * @see       vector_pipeline_template.c
+ * @see       vector_span_template.h
+ */
+
+#ifdef T
+
+#include "template.h"
+#include "vector_config.h"
+#include "vector_error.h"
+
+#include <stdbool.h>
+
+
+/**
+ * @def   VECTOR_PIPE_MAX_STAGES
+ * @brief Maximum number of stages of a pipeline
+ */
+#ifndef VECTOR_PIPE_MAX_STAGES
+#define VECTOR_PIPE_MAX_STAGES 		8
+#endif // VECTOR_PIPE_MAX_STAGES
+
+/**
+ * @def   VECTOR_PIPE_BLOCK
+ * @brief Elements processed per block (the stack buffer holds this many T)
+ *
+ * At most VECTOR_INDEX_MASK, so a block length fits vector_size_t
+ * (255 with VECTOR_8BIT_SIZE).
+ */
+#ifndef VECTOR_PIPE_BLOCK
+#if VECTOR_INDEX_MASK < 256
+#define VECTOR_PIPE_BLOCK 			VECTOR_INDEX_MASK
+#else // VECTOR_INDEX_MASK < 256
+#define VECTOR_PIPE_BLOCK 			256
+#endif // VECTOR_INDEX_MASK < 256
+#endif // VECTOR_PIPE_BLOCK
+
+#if VECTOR_PIPE_BLOCK > VECTOR_INDEX_MASK
+#error "VECTOR_PIPE_BLOCK does not fit vector_size_t"
+#endif // VECTOR_PIPE_BLOCK > VECTOR_INDEX_MASK
+
+#ifndef VECTOR_PIPE_STAGE_KIND
+#define VECTOR_PIPE_STAGE_KIND
+typedef enum
+{
+	VECTOR_PIPE_FILTER,
+	VECTOR_PIPE_MAP,
+	VECTOR_PIPE_TAKE,
+	VECTOR_PIPE_SKIP
+} vector_pipe_stage_kind_t;
+#endif // VECTOR_PIPE_STAGE_KIND
+
+
+#ifndef VECTOR
+#define VECTOR 						TEMPLATE(vector, T)
+#endif // VECTOR
+
+#ifndef VECTOR_SPAN
+#define VECTOR_SPAN 				TEMPLATE(vector_span, T)
+#endif // VECTOR_SPAN
+
+#ifndef VECTOR_PIPE
+#define VECTOR_PIPE 				TEMPLATE(vector_pipe, T)
+#endif // VECTOR_PIPE
+
+#ifndef VECTOR_PIPE_FUNC
+#define VECTOR_PIPE_FUNC(_name) 	TEMPLATE(vector_pipe, TEMPLATE(_name, T))
+#endif // VECTOR_PIPE_FUNC
+
+
+typedef bool (*TEMPLATE(vector_pipe_pred_fn, T))(T value, void *ctx);
+typedef T (*TEMPLATE(vector_pipe_map_fn, T))(T value, void *ctx);
+typedef T (*TEMPLATE(vector_pipe_fold_fn, T))(T acc, T value, void *ctx);
+
+/**
+ * @var kind    Stage kind
+ * @var pred    Predicate of a filter stage
+ * @var map     Function of a map stage
+ * @var ctx     User pointer passed to pred or map
+ * @var count   Number of elements of a take or skip stage
+ */
+typedef struct TEMPLATE(vector_pipe_stage_t, T)
+{
+	vector_pipe_stage_kind_t kind;
+	TEMPLATE(vector_pipe_pred_fn, T) pred;
+	TEMPLATE(vector_pipe_map_fn, T) map;
+	void *ctx;
+	vector_size_t count;
+} TEMPLATE(vector_pipe_stage, T);
+
+typedef struct TEMPLATE(vector_pipe_t, T)
+{
+	VECTOR_SPAN source;
+	vector_size_t stage_count;
+	TEMPLATE(vector_pipe_stage, T) stages[VECTOR_PIPE_MAX_STAGES];
+} VECTOR_PIPE;
+
+/**
+ * @brief  Pipeline without stages over @p source
+ */
+VECTOR_API VECTOR_INLINE VECTOR_PIPE VECTOR_PIPE_FUNC(from)(VECTOR_SPAN source);
+/**
+ * @brief  Keep the elements for which @p pred returns true
+ */
+VECTOR_API VECTOR_INLINE void VECTOR_PIPE_FUNC(filter)(
+	VECTOR_PIPE *pipe,
+	TEMPLATE(vector_pipe_pred_fn, T) pred,
+	void *ctx,
+	vector_error_t *error
+);
+/**
+ * @brief  Replace every element with @p map of it
+ */
+VECTOR_API VECTOR_INLINE void VECTOR_PIPE_FUNC(map)(
+	VECTOR_PIPE *pipe,
+	TEMPLATE(vector_pipe_map_fn, T) map,
+	void *ctx,
+	vector_error_t *error
+);
+/**
+ * @brief  Stop after @p count elements, the rest of the source is not read
+ */
+VECTOR_API VECTOR_INLINE void VECTOR_PIPE_FUNC(take)(
+	VECTOR_PIPE *pipe,
+	vector_size_t count,
+	vector_error_t *error
+);
+/**
+ * @brief  Drop the first @p count elements
+ */
+VECTOR_API VECTOR_INLINE void VECTOR_PIPE_FUNC(skip)(
+	VECTOR_PIPE *pipe,
+	vector_size_t count,
+	vector_error_t *error
+);
+/**
+ * @brief  Upper bound of the number of elements the pipeline yields
+ */
+VECTOR_API VECTOR_INLINE vector_size_t VECTOR_PIPE_FUNC(estimate)(const VECTOR_PIPE *pipe);
+/**
+ * @brief  Write at most @p capacity elements to @p out
+ *
+ * @return Number of elements written
+ */
+VECTOR_API vector_size_t VECTOR_PIPE_FUNC(drain)(
+	const VECTOR_PIPE *pipe,
+	T *out,
+	vector_size_t capacity,
+	vector_error_t *error
+);
+/**
+ * @brief  Fold the elements into @p init with @p fold
+ */
+VECTOR_API T VECTOR_PIPE_FUNC(reduce)(
+	const VECTOR_PIPE *pipe,
+	T init,
+	TEMPLATE(vector_pipe_fold_fn, T) fold,
+	void *ctx,
+	vector_error_t *error
+);
+/**
+ * @brief  Number of elements the pipeline yields
+ */
+VECTOR_API vector_size_t VECTOR_PIPE_FUNC(count)(
+	const VECTOR_PIPE *pipe,
+	vector_error_t *error
+);
+
+#ifndef VECTOR_NO_DYNAMIC_ALLOC
+/**
+ * @brief  Append the elements to @p dst
+ *
+ * @p dst is reserved for estimate() more elements before the pass.
+ */
+VECTOR_API void VECTOR_PIPE_FUNC(collect)(
+	const VECTOR_PIPE *pipe,
+	VECTOR **dst,
+	vector_error_t *error
+);
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+
+
+#undef VECTOR
+#undef VECTOR_SPAN
+#undef VECTOR_PIPE
+#undef VECTOR_PIPE_FUNC
+
+
+#endif // T
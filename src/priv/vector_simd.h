@@ -0,0 +1,404 @@
+/**
+ * @file      vector_simd.h
+ * @brief     Portable SIMD and bit helpers for vector templates
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Type-independent helpers used by the templates. SSE2 is used
+ *            when the compiler targets it (__SSE2__, always on x86-64),
+ *            otherwise a scalar version with the same result is compiled.
+ *            Define VECTOR_NO_SIMD to force the scalar versions.
+ */
+
+#ifndef __VECTOR_SIMD_H__
+#define __VECTOR_SIMD_H__
+
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__SSE2__) && !defined(VECTOR_NO_SIMD)
+#define VECTOR_SIMD_SSE2
+#include <emmintrin.h>
+#endif // __SSE2__ && !VECTOR_NO_SIMD
+
+
+/**
+ * @brief  Bit i is set when p[i] == byte, i = 0..15
+ */
+static inline uint32_t vector_simd_match16(const uint8_t *p, uint8_t byte)
+{
+#ifdef VECTOR_SIMD_SSE2
+	const __m128i group = _mm_loadu_si128((const __m128i *)p);
+
+	return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)byte)));
+#else // VECTOR_SIMD_SSE2
+	uint32_t mask = 0;
+
+	for (unsigned i = 0; i < 16; ++i)
+		mask |= (uint32_t)(p[i] == byte) << i;
+
+	return mask;
+#endif // VECTOR_SIMD_SSE2
+}
+
+/**
+ * @brief  Index of the lowest set bit, @p mask must not be 0
+ */
+static inline unsigned vector_ctz32(uint32_t mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return (unsigned)__builtin_ctz(mask);
+#else
+	unsigned n = 0;
+
+	while ((mask & 1u) == 0)
+	{
+		mask >>= 1;
+		++n;
+	}
+
+	return n;
+#endif
+}
+
+/**
+ * @brief  Index of the lowest set bit, @p word must not be 0
+ */
+static inline unsigned vector_ctz64(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return (unsigned)__builtin_ctzll(word);
+#else
+	unsigned n = 0;
+
+	while ((word & 1u) == 0)
+	{
+		word >>= 1;
+		++n;
+	}
+
+	return n;
+#endif
+}
+
+/**
+ * @brief  Number of leading zero bits, @p word must not be 0
+ */
+static inline unsigned vector_clz64(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return (unsigned)__builtin_clzll(word);
+#else
+	unsigned n = 0;
+
+	while ((word & (1ULL << 63)) == 0)
+	{
+		word <<= 1;
+		++n;
+	}
+
+	return n;
+#endif
+}
+
+/**
+ * @brief  Number of set bits (popcnt with -mpopcnt, bit tricks otherwise)
+ */
+static inline unsigned vector_popcount64(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return (unsigned)__builtin_popcountll(word);
+#else
+	word = word - ((word >> 1) & 0x5555555555555555ULL);
+	word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+	word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+	return (unsigned)((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/**
+ * @brief  Set bits in words[0..count), four independent accumulators
+ */
+static inline size_t vector_simd_popcount(const uint64_t *words, size_t count)
+{
+	size_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+	size_t i = 0;
+
+	for (; i + 4 <= count; i += 4)
+	{
+		c0 += vector_popcount64(words[i]);
+		c1 += vector_popcount64(words[i + 1]);
+		c2 += vector_popcount64(words[i + 2]);
+		c3 += vector_popcount64(words[i + 3]);
+	}
+
+	for (; i < count; ++i)
+		c0 += vector_popcount64(words[i]);
+
+	return c0 + c1 + c2 + c3;
+}
+
+/**
+ * @brief  *sum = a + b, true when the result does not fit int64_t
+ */
+static inline bool vector_add_overflow_i64(int64_t a, int64_t b, int64_t *sum)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_add_overflow(a, b, sum);
+#else
+	if ((b > 0 && a > INT64_MAX - b) || (b < 0 && a < INT64_MIN - b))
+		return true;
+
+	*sum = a + b;
+
+	return false;
+#endif
+}
+
+/**
+ * @brief  *product = a * b, true when the result does not fit int64_t
+ */
+static inline bool vector_mul_overflow_i64(int64_t a, int64_t b, int64_t *product)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_mul_overflow(a, b, product);
+#else
+	const uint64_t ua = (a < 0) ? 0 - (uint64_t)a : (uint64_t)a;
+	const uint64_t ub = (b < 0) ? 0 - (uint64_t)b : (uint64_t)b;
+	const bool negative = (a < 0) != (b < 0);
+	const uint64_t limit = negative ? (uint64_t)INT64_MAX + 1 : (uint64_t)INT64_MAX;
+
+	if (ua != 0 && ub > limit / ua)
+		return true;
+
+	*product = negative ? (int64_t)(0 - ua * ub) : (int64_t)(ua * ub);
+
+	return false;
+#endif
+}
+
+/**
+ * @brief  First i in [begin, end) with words[i] != skip, end if none
+ */
+static inline size_t vector_simd_find_word(
+	const uint64_t *words,
+	size_t begin,
+	size_t end,
+	uint64_t skip
+)
+{
+	size_t i = begin;
+
+#ifdef VECTOR_SIMD_SSE2
+	const __m128i pattern = _mm_set1_epi64x((long long)skip);
+
+	for (; i + 4 <= end; i += 4)
+	{
+		const __m128i lo = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(words + i)), pattern);
+		const __m128i hi = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(words + i + 2)), pattern);
+
+		if (_mm_movemask_epi8(_mm_and_si128(lo, hi)) != 0xFFFF)
+			break;
+	}
+#endif // VECTOR_SIMD_SSE2
+
+	for (; i < end; ++i)
+	{
+		if (words[i] != skip)
+			return i;
+	}
+
+	return end;
+}
+
+/**
+ * @brief  Last i in [begin, end) with words[i] != skip, end if none
+ */
+static inline size_t vector_simd_rfind_word(
+	const uint64_t *words,
+	size_t begin,
+	size_t end,
+	uint64_t skip
+)
+{
+	size_t i = end;
+
+#ifdef VECTOR_SIMD_SSE2
+	const __m128i pattern = _mm_set1_epi64x((long long)skip);
+
+	for (; i >= begin + 4; i -= 4)
+	{
+		const __m128i lo = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(words + i - 4)), pattern);
+		const __m128i hi = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(words + i - 2)), pattern);
+
+		if (_mm_movemask_epi8(_mm_and_si128(lo, hi)) != 0xFFFF)
+			break;
+	}
+#endif // VECTOR_SIMD_SSE2
+
+	for (; i > begin; --i)
+	{
+		if (words[i - 1] != skip)
+			return i - 1;
+	}
+
+	return end;
+}
+
+/**
+ * @def   VECTOR_SIMD_BITWISE
+ * @brief Define dst[i] = dst[i] OP src[i] over 64-bit words
+ *
+ * @param _name    Function name
+ * @param _sse2    SSE2 intrinsic taking (dst, src)
+ * @param _scalar  Scalar expression of d and s
+ */
+#define VECTOR_SIMD_BITWISE(_name, _sse2, _scalar) \
+	static inline void _name( \
+		uint64_t *dst, \
+		const uint64_t *src, \
+		size_t count \
+	) \
+	{ \
+		size_t i = 0; \
+		\
+		VECTOR_SIMD_BITWISE_SSE2(_sse2) \
+		\
+		for (; i < count; ++i) \
+		{ \
+			const uint64_t d = dst[i]; \
+			const uint64_t s = src[i]; \
+			\
+			dst[i] = (_scalar); \
+		} \
+	}
+
+#ifdef VECTOR_SIMD_SSE2
+#define VECTOR_SIMD_BITWISE_SSE2(_sse2) \
+	for (; i + 2 <= count; i += 2) \
+	{ \
+		const __m128i d = _mm_loadu_si128((const __m128i *)(dst + i)); \
+		const __m128i s = _mm_loadu_si128((const __m128i *)(src + i)); \
+		\
+		_mm_storeu_si128((__m128i *)(dst + i), _sse2(d, s)); \
+	}
+#else // VECTOR_SIMD_SSE2
+#define VECTOR_SIMD_BITWISE_SSE2(_sse2)
+#endif // VECTOR_SIMD_SSE2
+
+/* _mm_andnot_si128(a, b) is ~a & b, the operands are swapped for d & ~s */
+#define VECTOR_SIMD_ANDNOT(_d, _s) 	_mm_andnot_si128((_s), (_d))
+
+VECTOR_SIMD_BITWISE(vector_simd_and_words, _mm_and_si128, d & s)
+VECTOR_SIMD_BITWISE(vector_simd_or_words, _mm_or_si128, d | s)
+VECTOR_SIMD_BITWISE(vector_simd_xor_words, _mm_xor_si128, d ^ s)
+VECTOR_SIMD_BITWISE(vector_simd_andnot_words, VECTOR_SIMD_ANDNOT, d & ~s)
+
+#undef VECTOR_SIMD_BITWISE
+#undef VECTOR_SIMD_BITWISE_SSE2
+#undef VECTOR_SIMD_ANDNOT
+
+/**
+ * @brief  Bit k is set when a[k] equals one of b[0..3], k = 0..3
+ *
+ * All 16 pairs of two groups of 32-bit integers are compared with four
+ * compares against rotations of @p b.
+ */
+static inline uint32_t vector_simd_intersect4_u32(const void *a, const void *b)
+{
+#ifdef VECTOR_SIMD_SSE2
+	const __m128i va = _mm_loadu_si128((const __m128i *)a);
+	const __m128i vb = _mm_loadu_si128((const __m128i *)b);
+	__m128i match = _mm_cmpeq_epi32(va, vb);
+
+	match = _mm_or_si128(match, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1))));
+	match = _mm_or_si128(match, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+	match = _mm_or_si128(match, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3))));
+
+	return (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(match));
+#else // VECTOR_SIMD_SSE2
+	const uint32_t *pa = (const uint32_t *)a;
+	const uint32_t *pb = (const uint32_t *)b;
+	uint32_t mask = 0;
+
+	for (unsigned k = 0; k < 4; ++k)
+		mask |= (uint32_t)(pa[k] == pb[0] || pa[k] == pb[1] || pa[k] == pb[2] || pa[k] == pb[3]) << k;
+
+	return mask;
+#endif // VECTOR_SIMD_SSE2
+}
+
+/**
+ * @brief  true when p[k] == p[k - 1] for some k = 0..3 (p[-1] is read)
+ */
+static inline bool vector_simd_adjacent_eq4_u32(const void *p)
+{
+#ifdef VECTOR_SIMD_SSE2
+	const __m128i cur = _mm_loadu_si128((const __m128i *)p);
+	const __m128i prev = _mm_loadu_si128((const __m128i *)((const uint32_t *)p - 1));
+
+	return _mm_movemask_epi8(_mm_cmpeq_epi32(cur, prev)) != 0;
+#else // VECTOR_SIMD_SSE2
+	const uint32_t *q = (const uint32_t *)p;
+
+	return q[0] == q[-1] || q[1] == q[0] || q[2] == q[1] || q[3] == q[2];
+#endif // VECTOR_SIMD_SSE2
+}
+
+/**
+ * @brief  Prefix sums of 32-bit integers, four at a time in a register
+ *
+ * Each group is scanned with two shifted adds and the running total
+ * @p carry is broadcast onto it. The sums wrap modulo 2^32. @p dst may be
+ * @p src, both are accessed with unaligned loads and stores.
+ *
+ * @return Number of elements processed: a multiple of 4 (0 without SSE2),
+ *         the caller scans the rest
+ */
+static inline size_t vector_simd_prefix_sum_u32(
+	void *dst,
+	const void *src,
+	size_t count,
+	bool exclusive,
+	uint32_t *carry
+)
+{
+	size_t i = 0;
+
+#ifdef VECTOR_SIMD_SSE2
+	__m128i total = _mm_set1_epi32((int)*carry);
+
+	for (; i + 4 <= count; i += 4)
+	{
+		const __m128i v = _mm_loadu_si128((const __m128i *)((const uint32_t *)src + i));
+		__m128i scan = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+
+		scan = _mm_add_epi32(scan, _mm_slli_si128(scan, 8));
+		scan = _mm_add_epi32(scan, total);
+
+		_mm_storeu_si128(
+			(__m128i *)((uint32_t *)dst + i),
+			exclusive ? _mm_sub_epi32(scan, v) : scan
+		);
+
+		total = _mm_shuffle_epi32(scan, _MM_SHUFFLE(3, 3, 3, 3));
+	}
+
+	*carry = (uint32_t)_mm_cvtsi128_si32(total);
+#else // VECTOR_SIMD_SSE2
+	(void)dst;
+	(void)src;
+	(void)count;
+	(void)exclusive;
+	(void)carry;
+#endif // VECTOR_SIMD_SSE2
+
+	return i;
+}
+
+
+#endif // __VECTOR_SIMD_H__
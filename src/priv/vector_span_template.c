@@ -0,0 +1,206 @@
+/**
+ * @file      vector_span_template.c
+ * @brief     Template implementation of non-owning spans
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Included after the vector template of T, slices are taken
+ *            through VECTOR_BEGIN and VECTOR_SIZE like the algorithms.
+ *
+ * @note      This file should not be included directly.
+ *            Use the generated vector_impl.c instead.
+ *
+ * @see       vector_span_template.h
+ */
+
+#ifdef T
+
+#include "template.h"
+#include "vector_traits.h"
+#include "vector_error.h"
+
+#include <string.h>
+
+
+#ifndef VECTOR
+#define VECTOR 						TEMPLATE(vector, T)
+#endif // VECTOR
+
+#ifndef VECTOR_SPAN
+#define VECTOR_SPAN 				TEMPLATE(vector_span, T)
+#endif // VECTOR_SPAN
+
+#ifndef VECTOR_SPAN_FUNC
+#define VECTOR_SPAN_FUNC(_name) 	TEMPLATE(vector_span, TEMPLATE(_name, T))
+#endif // VECTOR_SPAN_FUNC
+
+#ifndef PRIVATE
+#define PRIVATE(_range)				((_range)->__private)
+#endif // PRIVATE
+
+#ifndef VECTOR_SPAN_DATA
+#define VECTOR_SPAN_DATA(_span, _index) \
+	((_span).data[(size_t)(_index) * (_span).stride])
+#endif // VECTOR_SPAN_DATA
+
+
+VECTOR_API VECTOR_INLINE VECTOR_SPAN VECTOR_SPAN_FUNC(from)(
+	const T *data,
+	vector_size_t size
+)
+{
+	return (VECTOR_SPAN){ .data = data, .size = size, .stride = 1 };
+}
+
+VECTOR_API VECTOR_INLINE VECTOR_SPAN VECTOR_SPAN_FUNC(strided)(
+	const T *data,
+	vector_size_t size,
+	vector_size_t stride
+)
+{
+	return (VECTOR_SPAN){ .data = data, .size = size, .stride = stride };
+}
+
+VECTOR_API VECTOR_INLINE VECTOR_SPAN VECTOR_SPAN_FUNC(of)(
+	const VECTOR *vector,
+	vector_index_t begin,
+	vector_index_t end,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(vector != NULL, error, VECTOR_ERROR_NULL, (VECTOR_SPAN){0})
+	VECTOR_CHECK(
+		(begin >= 0) && (begin <= end) && ((vector_size_t)end <= VECTOR_SIZE(vector)),
+		error,
+		VECTOR_ERROR_INDEX,
+		(VECTOR_SPAN){0}
+	)
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return VECTOR_SPAN_FUNC(from)(
+		VECTOR_BEGIN(vector) + begin,
+		(vector_size_t)(end - begin)
+	);
+}
+
+VECTOR_API VECTOR_INLINE VECTOR_SPAN VECTOR_SPAN_FUNC(sub)(
+	VECTOR_SPAN span,
+	vector_index_t begin,
+	vector_index_t end,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(
+		(begin >= 0) && (begin <= end) && ((vector_size_t)end <= span.size),
+		error,
+		VECTOR_ERROR_INDEX,
+		(VECTOR_SPAN){0}
+	)
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return VECTOR_SPAN_FUNC(strided)(
+		&VECTOR_SPAN_DATA(span, begin),
+		(vector_size_t)(end - begin),
+		span.stride
+	);
+}
+
+VECTOR_API VECTOR_INLINE T VECTOR_SPAN_FUNC(at)(
+	VECTOR_SPAN span,
+	vector_index_t index,
+	vector_error_t *error
+)
+{
+	VECTOR_CHECK(
+		(index >= 0) && ((vector_size_t)index < span.size),
+		error,
+		VECTOR_ERROR_INDEX,
+		(T){0}
+	)
+
+	if (error != NULL)
+		*error = VECTOR_ERROR_SUCCESS;
+
+	return VECTOR_SPAN_DATA(span, index);
+}
+
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_SPAN_FUNC(find_first_not_of)(
+	VECTOR_SPAN span,
+	T value
+)
+{
+	for (vector_index_t i = 0; i < (vector_index_t)span.size; ++i)
+	{
+		if (!VECTOR_EQ(VECTOR_SPAN_DATA(span, i), value))
+			return i;
+	}
+
+	return VECTOR_INVALID_INDEX;
+}
+
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_SPAN_FUNC(find_last_not_of)(
+	VECTOR_SPAN span,
+	T value
+)
+{
+	for (vector_index_t i = (vector_index_t)span.size - 1; i >= 0; --i)
+	{
+		if (!VECTOR_EQ(VECTOR_SPAN_DATA(span, i), value))
+			return i;
+	}
+
+	return VECTOR_INVALID_INDEX;
+}
+
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_SPAN_FUNC(find_first_of)(
+	VECTOR_SPAN span,
+	T value
+)
+{
+#if VECTOR_HAS_TRAIT(BITWISE_EQ) && !defined(VECTOR_HOOK_EQUAL)
+	if (sizeof(T) == 1 && span.stride == 1)
+	{
+		const T *hit = (span.size > 0)
+			? (const T *)memchr(span.data, *(const unsigned char *)&value, span.size)
+			: NULL;
+
+		return (hit != NULL) ? (vector_index_t)(hit - span.data) : VECTOR_INVALID_INDEX;
+	}
+#endif // BITWISE_EQ && !VECTOR_HOOK_EQUAL
+
+	for (vector_index_t i = 0; i < (vector_index_t)span.size; ++i)
+	{
+		if (VECTOR_EQ(VECTOR_SPAN_DATA(span, i), value))
+			return i;
+	}
+
+	return VECTOR_INVALID_INDEX;
+}
+
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_SPAN_FUNC(find_last_of)(
+	VECTOR_SPAN span,
+	T value
+)
+{
+	for (vector_index_t i = (vector_index_t)span.size - 1; i >= 0; --i)
+	{
+		if (VECTOR_EQ(VECTOR_SPAN_DATA(span, i), value))
+			return i;
+	}
+
+	return VECTOR_INVALID_INDEX;
+}
+
+
+#undef VECTOR
+#undef VECTOR_SPAN
+#undef VECTOR_SPAN_FUNC
+#undef PRIVATE
+
+
+#endif // T
@@ -0,0 +1,117 @@
+/**
+ * @file      vector_span_template.h
+ * @brief     Template declarations for non-owning spans
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   vector_span_T is a view of elements owned by someone else: a
+ *            pointer, a length and a stride in elements (1 for contiguous
+ *            data). Spans are passed by value and never allocate. They can
+ *            be taken from a raw buffer (vector_span_from_T), a strided
+ *            buffer such as one column of a matrix (vector_span_strided_T)
+ *            or a slice of a vector (vector_span_of_T).
+ *
+ *            The range functions of the vectors take spans
+ *            (vector_append_span_T, vector_insert_span_indx_T, ...), so a part
+ *            of a vector or an external array is copied in directly.
+ *
+ * @note      A span of a vector is valid until the vector reallocates.
+ *
+ * @see       vector_span_template.c
+ */
+
+#ifdef T
+
+#include "template.h"
+#include "vector_config.h"
+#include "vector_error.h"
+
+#include <stdbool.h>
+
+
+#ifndef VECTOR_SPAN
+#define VECTOR_SPAN 				TEMPLATE(vector_span, T)
+#endif // VECTOR_SPAN
+
+#ifndef VECTOR_SPAN_FUNC
+#define VECTOR_SPAN_FUNC(_name) 	TEMPLATE(vector_span, TEMPLATE(_name, T))
+#endif // VECTOR_SPAN_FUNC
+
+
+/**
+ * @var data    First element
+ * @var size    Number of elements
+ * @var stride  Distance between elements, in elements (1 = contiguous)
+ */
+typedef struct TEMPLATE(vector_span_t, T)
+{
+	const T *data;
+	vector_size_t size;
+	vector_size_t stride;
+} VECTOR_SPAN;
+
+/* Vector the span can be taken from, defined by the vector templates */
+struct TEMPLATE(vector_t, T);
+
+/**
+ * @brief  Contiguous span of @p size elements at @p data
+ */
+VECTOR_API VECTOR_INLINE VECTOR_SPAN VECTOR_SPAN_FUNC(from)(
+	const T *data,
+	vector_size_t size
+);
+/**
+ * @brief  Span of @p size elements at @p data, @p stride elements apart
+ */
+VECTOR_API VECTOR_INLINE VECTOR_SPAN VECTOR_SPAN_FUNC(strided)(
+	const T *data,
+	vector_size_t size,
+	vector_size_t stride
+);
+/**
+ * @brief  Elements [begin, end) of a vector
+ */
+VECTOR_API VECTOR_INLINE VECTOR_SPAN VECTOR_SPAN_FUNC(of)(
+	const struct TEMPLATE(vector_t, T) *vector,
+	vector_index_t begin,
+	vector_index_t end,
+	vector_error_t *error
+);
+/**
+ * @brief  Elements [begin, end) of a span
+ */
+VECTOR_API VECTOR_INLINE VECTOR_SPAN VECTOR_SPAN_FUNC(sub)(
+	VECTOR_SPAN span,
+	vector_index_t begin,
+	vector_index_t end,
+	vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE T VECTOR_SPAN_FUNC(at)(
+	VECTOR_SPAN span,
+	vector_index_t index,
+	vector_error_t *error
+);
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_SPAN_FUNC(find_first_not_of)(
+	VECTOR_SPAN span,
+	T value
+);
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_SPAN_FUNC(find_last_not_of)(
+	VECTOR_SPAN span,
+	T value
+);
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_SPAN_FUNC(find_first_of)(
+	VECTOR_SPAN span,
+	T value
+);
+VECTOR_API VECTOR_INLINE vector_index_t VECTOR_SPAN_FUNC(find_last_of)(
+	VECTOR_SPAN span,
+	T value
+);
+
+
+#undef VECTOR_SPAN
+#undef VECTOR_SPAN_FUNC
+
+
+#endif // T
@@ -8,8 +8,24 @@
 #include "vector_config.h" // только для тестирования, потом убрать
 
 
+#if defined(VECTOR_SOA_FIELDS)
+#include "soa_vector_template.c"
+#elif defined(VECTOR_SEGMENTED)
+#include "segmented_vector_template.c"
+#elif defined(VECTOR_BIT_PACKED) && !defined(VECTOR_NO_DYNAMIC_ALLOC)
+#include "bit_vector_template.c"
+#else // VECTOR_SOA_FIELDS, VECTOR_SEGMENTED, VECTOR_BIT_PACKED && !VECTOR_NO_DYNAMIC_ALLOC
+
 #ifdef VECTOR_NO_DYNAMIC_ALLOC
-#include "static_vector_template.с"
+#include "static_vector_template.c"
 #else // VECTOR_NO_DYNAMIC_ALLOC
-#include "dynamic_vector_template.с"
+#include "dynamic_vector_template.c"
 #endif // VECTOR_NO_DYNAMIC_ALLOC
+
+#include "vector_span_template.c"
+#include "vector_pipeline_template.c"
+
+#include "vector_algorithm_template.c"
+#include "vector_numeric_template.c"
+
+#endif // VECTOR_SOA_FIELDS, VECTOR_SEGMENTED, VECTOR_BIT_PACKED && !VECTOR_NO_DYNAMIC_ALLOC
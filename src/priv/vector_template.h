@@ -5,17 +5,30 @@
  *      Author: Terentev
  */
 
-#ifndef __VECTOR_TEMPLATE_H__
-#define __VECTOR_TEMPLATE_H__
-
 #include "vector_config.h" // только для тестирования, потом убрать
 
 
+/* No include guard: expanded once per T by vector_decl.h */
+#if defined(VECTOR_SOA_FIELDS)
+#include "soa_vector_template.h"
+#elif defined(VECTOR_SEGMENTED)
+#include "segmented_vector_template.h"
+#elif defined(VECTOR_BIT_PACKED) && !defined(VECTOR_NO_DYNAMIC_ALLOC)
+#include "bit_vector_template.h"
+#else // VECTOR_SOA_FIELDS, VECTOR_SEGMENTED, VECTOR_BIT_PACKED && !VECTOR_NO_DYNAMIC_ALLOC
+
+#include "vector_span_template.h"
+
 #ifdef VECTOR_NO_DYNAMIC_ALLOC
 #include "static_vector_template.h"
 #else // VECTOR_NO_DYNAMIC_ALLOC
 #include "dynamic_vector_template.h"
+#include "vector_index_template.h"
 #endif // VECTOR_NO_DYNAMIC_ALLOC
 
+#include "vector_pipeline_template.h"
+
+#include "vector_algorithm_template.h"
+#include "vector_numeric_template.h"
 
-#endif // __VECTOR_TEMPLATE_H__
+#endif // VECTOR_SOA_FIELDS, VECTOR_SEGMENTED, VECTOR_BIT_PACKED && !VECTOR_NO_DYNAMIC_ALLOC
@@ -0,0 +1,163 @@
+/**
+ * @file      vector_traits.h
+ * @brief     Per-type traits for vector templates
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   Traits are declared with VECTOR_INITIALIZE_TYPE_EX() or inferred
+ *            by the generator for builtin types, and are passed to the
+ *            templates as VECTOR_TRAITS together with T. The templates use
+ *            them to select specialized code at compile time:
+ *            - TRIVIAL          memcpy/memmove instead of element loops
+ *            - BITWISE_EQ       memcmp equality, memchr scans for 1-byte types
+ *            - ORDERED          operators == and < apply, sort is generated
+ *            - ZERO_IS_DEFAULT  memset zeroing for resize and zero fills
+ *            - RADIX            integer key, sort uses LSD radix sort
+ *            - ARITHMETIC       number type, sum and numeric kernels are generated
+ *
+ *            Comparison hooks bound with VECTOR_INITIALIZE_TYPE_HOOKS() are
+ *            passed as VECTOR_HOOK_EQUAL, VECTOR_HOOK_LESS and VECTOR_HOOK_HASH
+ *            and take precedence over the traits. They are called directly,
+ *            so the compiler can inline them into find, sort and hash loops.
+ *
+ *            The second part of this file is expanded for every T and
+ *            defines the element comparison macros of the current type.
+ *
+ * @see       vector_initialize_type.h
+ */
+
+#ifndef __VECTOR_TRAITS_H__
+#define __VECTOR_TRAITS_H__
+
+
+#include "template.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+#define VECTOR_TRAIT_NONE 				0x00
+#define VECTOR_TRAIT_TRIVIAL 			0x01
+#define VECTOR_TRAIT_BITWISE_EQ 		0x02
+#define VECTOR_TRAIT_ORDERED 			0x04
+#define VECTOR_TRAIT_ZERO_IS_DEFAULT 	0x08
+#define VECTOR_TRAIT_RADIX 				0x10
+#define VECTOR_TRAIT_ARITHMETIC 		0x20
+
+/**
+ * @def   VECTOR_HAS_TRAIT
+ * @brief Check a trait of the current type, usable in #if
+ *
+ * @param _trait  Trait name without prefix (e.g. BITWISE_EQ)
+ */
+#define VECTOR_HAS_TRAIT(_trait) \
+	(((VECTOR_TRAITS) & TEMPLATE(VECTOR_TRAIT, _trait)) != 0)
+
+/**
+ * @brief FNV-1a hash of an object representation
+ */
+static inline size_t vector_hash_bytes(const void *data, size_t size)
+{
+	const unsigned char *bytes = (const unsigned char *)data;
+	uint64_t hash = 14695981039346656037ULL;
+
+	for (size_t i = 0; i < size; ++i)
+	{
+		hash ^= bytes[i];
+		hash *= 1099511628211ULL;
+	}
+
+	return (size_t)hash;
+}
+
+/**
+ * @brief 64-bit finalizer (MurmurHash3 fmix64) for integer keys
+ */
+static inline size_t vector_hash_u64(uint64_t key)
+{
+	key ^= key >> 33;
+	key *= 0xff51afd7ed558ccdULL;
+	key ^= key >> 33;
+	key *= 0xc4ceb9fe1a85ec53ULL;
+	key ^= key >> 33;
+
+	return (size_t)key;
+}
+
+
+#endif // __VECTOR_TRAITS_H__
+
+
+#ifdef T
+
+#ifndef VECTOR_TRAITS
+#define VECTOR_TRAITS 	VECTOR_TRAIT_NONE
+#endif // VECTOR_TRAITS
+
+#undef VECTOR_EQ
+#undef VECTOR_LESS
+#undef VECTOR_HASH
+#undef VECTOR_HAS_LESS
+#undef VECTOR_HAS_HASH
+#undef VECTOR_HAS_INDEX
+
+/**
+ * @def   VECTOR_EQ
+ * @brief Element equality for the current T (arguments must be lvalues)
+ */
+#if defined(VECTOR_HOOK_EQUAL)
+#define VECTOR_EQ(_a, _b) 		(VECTOR_HOOK_EQUAL(&(_a), &(_b)))
+#elif VECTOR_HAS_TRAIT(ORDERED)
+#define VECTOR_EQ(_a, _b) 		((_a) == (_b))
+#elif VECTOR_HAS_TRAIT(BITWISE_EQ)
+#define VECTOR_EQ(_a, _b) 		(memcmp(&(_a), &(_b), sizeof(T)) == 0)
+#else
+#define VECTOR_EQ(_a, _b) 		((_a) == (_b))
+#endif
+
+/**
+ * @def   VECTOR_LESS
+ * @brief Strict weak ordering for the current T
+ *
+ * VECTOR_HAS_LESS is 1 when the ordering exists (ORDERED or a less hook).
+ */
+#if defined(VECTOR_HOOK_LESS)
+#define VECTOR_LESS(_a, _b) 	(VECTOR_HOOK_LESS(&(_a), &(_b)))
+#define VECTOR_HAS_LESS 		1
+#else
+#define VECTOR_LESS(_a, _b) 	((_a) < (_b))
+#define VECTOR_HAS_LESS 		VECTOR_HAS_TRAIT(ORDERED)
+#endif
+
+/**
+ * @def   VECTOR_HASH
+ * @brief Element hash for the current T, consistent with VECTOR_EQ
+ *
+ * VECTOR_HAS_HASH is 1 when the hash exists (BITWISE_EQ or a hash hook).
+ */
+#if defined(VECTOR_HOOK_HASH)
+#define VECTOR_HASH(_a) 		((size_t)VECTOR_HOOK_HASH(&(_a)))
+#define VECTOR_HAS_HASH 		1
+#elif VECTOR_HAS_TRAIT(RADIX) && !defined(VECTOR_HOOK_EQUAL)
+#define VECTOR_HASH(_a) 		(vector_hash_u64((uint64_t)(_a)))
+#define VECTOR_HAS_HASH 		1
+#elif VECTOR_HAS_TRAIT(BITWISE_EQ) && !defined(VECTOR_HOOK_EQUAL)
+#define VECTOR_HASH(_a) 		(vector_hash_bytes(&(_a), sizeof(T)))
+#define VECTOR_HAS_HASH 		1
+#else
+#define VECTOR_HASH(_a) 		((size_t)0)
+#define VECTOR_HAS_HASH 		0
+#endif
+
+/**
+ * @def   VECTOR_HAS_INDEX
+ * @brief 1 when dynamic vectors of the current T support the hash index
+ */
+#if defined(VECTOR_HASH_INDEX) && !defined(VECTOR_NO_DYNAMIC_ALLOC) && VECTOR_HAS_HASH
+#define VECTOR_HAS_INDEX 		1
+#else
+#define VECTOR_HAS_INDEX 		0
+#endif
+
+#endif // T
@@ -1,3 +1,5 @@
 #include "vector.h"
 
+#ifndef VECTOR_HEADER_ONLY
 #include "vector_impl.c"
+#endif // VECTOR_HEADER_ONLY
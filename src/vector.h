@@ -9,8 +9,11 @@
  *            It initializes vector types and includes the generated declarations.
  *
  * @note      To use this library, include this file in your project.
+ *            With VECTOR_HEADER_ONLY the implementations are included too
+ *            and nothing has to be linked.
  * @see       vector_initialize_type.h
  * @see       vector_decl.h
+ * @see       vector_inline.h
  */
 
 #ifndef __VECTOR_H__
@@ -22,9 +25,15 @@
 
 VECTOR_INITIALIZE_TYPE(int)
 VECTOR_INITIALIZE_TYPE(char)
+VECTOR_INITIALIZE_TYPE_BITS(bool)
+VECTOR_INITIALIZE_TYPE_SEGMENTED(int)
 
 
 #include "vector_decl.h"
 
+#ifdef VECTOR_HEADER_ONLY
+#include "vector_inline.h"
+#endif // VECTOR_HEADER_ONLY
+
 
 #endif // __VECTOR_H__
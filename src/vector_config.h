@@ -90,9 +90,126 @@
 #endif // VECTOR_INITIAL_CAPACITY
 #endif // VECTOR_SMALL_MEMORY
 
+/*
+ * Static pools: defaults of every type, VECTOR_INITIALIZE_TYPE_POOL()
+ * overrides them per type. The smallest block of the element arena is in
+ * elements, a power of two.
+ */
+#ifndef VECTOR_MAX_N_VECTORS
+#define VECTOR_MAX_N_VECTORS 		10
+#endif // VECTOR_MAX_N_VECTORS
+
+#ifndef VECTOR_STATIC_BUFFER_SIZE
+#define VECTOR_STATIC_BUFFER_SIZE 	1024
+#endif // VECTOR_STATIC_BUFFER_SIZE
+
+#ifndef VECTOR_STATIC_MIN_BLOCK
+#define VECTOR_STATIC_MIN_BLOCK 	16
+#endif // VECTOR_STATIC_MIN_BLOCK
+
+/*
+ * Critical section of a static element arena: _lock is the lock word of the
+ * type, _state a VECTOR_ARENA_STATE local the hook may save a mask in.
+ * VECTOR_ARENA_LOCK() is an expression, true when the section was entered,
+ * and must not wait for another holder. The default tries the lock word
+ * VECTOR_ARENA_LOCK_TRIES times: a create or grow that loses fails with
+ * VECTOR_ERROR_NO_FREE_VECTOR / VECTOR_ERROR_CAPACITY, a free that loses is
+ * left to the next holder, so an interrupt handler never deadlocks on the
+ * code it interrupted. Masking interrupts always enters, e.g.
+ *   #define VECTOR_ARENA_LOCK(_lock, _state) \
+ *       ((_state) = __get_PRIMASK(), __disable_irq(), true)
+ *   #define VECTOR_ARENA_UNLOCK(_lock, _state) __set_PRIMASK(_state)
+ */
+#ifndef VECTOR_ARENA_STATE
+#define VECTOR_ARENA_STATE 			uint32_t
+#endif // VECTOR_ARENA_STATE
+
+#ifndef VECTOR_ARENA_LOCK_TRIES
+#define VECTOR_ARENA_LOCK_TRIES 	64
+#endif // VECTOR_ARENA_LOCK_TRIES
+
+#ifndef VECTOR_ARENA_LOCK
+#define VECTOR_ARENA_LOCK(_lock, _state) \
+	((void)(_state), vector_atomic_bits_try_lock(&(_lock), VECTOR_ARENA_LOCK_TRIES))
+#endif // VECTOR_ARENA_LOCK
+
+#ifndef VECTOR_ARENA_UNLOCK
+#define VECTOR_ARENA_UNLOCK(_lock, _state) \
+	((void)(_state), vector_atomic_bits_clear(&(_lock), 1))
+#endif // VECTOR_ARENA_UNLOCK
+
+/*
+ * VECTOR_STATIC_ALIGN: boundary in bytes (a power of two) of the buffer and
+ * the pool entry of every static vector, e.g. VECTOR_CACHE_LINE, so vectors
+ * used by different cores never share a cache line and data() is aligned
+ * for SIMD loads. Arena blocks are rounded up to it. Not defined by default.
+ */
+#ifndef VECTOR_CACHE_LINE
+#define VECTOR_CACHE_LINE 			64
+#endif // VECTOR_CACHE_LINE
+
+/*
+ * Placement of a static pool: VECTOR_SECTION(".dtcm") puts it in a linker
+ * section (MSVC needs a matching #pragma section), VECTOR_ALIGNED(32) aligns
+ * it. Both go before the declaration.
+ */
+#ifndef VECTOR_SECTION
+#if defined(__GNUC__) || defined(__clang__)
+#define VECTOR_SECTION(_name) 		__attribute__((section(_name)))
+#elif defined(_MSC_VER)
+#define VECTOR_SECTION(_name) 		__declspec(allocate(_name))
+#else
+#define VECTOR_SECTION(_name)
+#endif
+#endif // VECTOR_SECTION
+
+#ifndef VECTOR_ALIGNED
+#if defined(__GNUC__) || defined(__clang__)
+#define VECTOR_ALIGNED(_align) 		__attribute__((aligned(_align)))
+#elif defined(_MSC_VER)
+#define VECTOR_ALIGNED(_align) 		__declspec(align(_align))
+#else
+#define VECTOR_ALIGNED(_align)
+#endif
+#endif // VECTOR_ALIGNED
+
+/*
+ * VECTOR_HEADER_ONLY: the implementations are compiled into every
+ * translation unit that includes vector.h (see vector_inline.h), so
+ * the public functions become static inline and can be inlined into the
+ * caller; unused ones are dropped without warnings.
+ * VECTOR_API marks the functions exported by the library.
+ *
+ * Static pools are not header-only: every translation unit would get its
+ * own pools and vectors could not be destroyed outside the one that
+ * created them.
+ */
+#ifdef VECTOR_HEADER_ONLY
+#ifdef VECTOR_NO_DYNAMIC_ALLOC
+#error "VECTOR_HEADER_ONLY cannot be combined with VECTOR_NO_DYNAMIC_ALLOC, link vector.c instead"
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+#ifndef VECTOR_API
+#define VECTOR_API static inline
+#endif // VECTOR_API
+#ifndef VECTOR_INLINE
+#ifdef VECTOR_USE_INLINE
+#define VECTOR_INLINE inline __attribute__((always_inline))
+#else // VECTOR_USE_INLINE
+#define VECTOR_INLINE inline
+#endif // VECTOR_USE_INLINE
+#endif // VECTOR_INLINE
+#else // VECTOR_HEADER_ONLY
+#ifndef VECTOR_API
+#define VECTOR_API
+#endif // VECTOR_API
+#ifndef VECTOR_INLINE
+#define VECTOR_INLINE
+#endif // VECTOR_INLINE
+#endif // VECTOR_HEADER_ONLY
+
 #ifdef VECTOR_LITE
 #ifndef VECTOR_STATIC
-#define VECTOR_STATIC
+#define VECTOR_STATIC VECTOR_API
 #endif // VECTOR_STATIC
 #else // VECTOR_LITE
 #ifndef VECTOR_STATIC
@@ -100,6 +217,97 @@
 #endif // VECTOR_STATIC
 #endif // VECTOR_LITE
 
+/*
+ * Receiver of the vector functions: VECTOR ** for dynamic vectors,
+ * VECTOR * for static ones. Used by the mode-independent templates.
+ */
+#ifdef VECTOR_NO_DYNAMIC_ALLOC
+#ifndef VECTOR_SELF
+#define VECTOR_SELF 			VECTOR *
+#endif // VECTOR_SELF
+#ifndef VECTOR_CSELF
+#define VECTOR_CSELF 			const VECTOR *
+#endif // VECTOR_CSELF
+#ifndef VECTOR_DEREF
+#define VECTOR_DEREF(_self) 	(_self)
+#endif // VECTOR_DEREF
+#else // VECTOR_NO_DYNAMIC_ALLOC
+#ifndef VECTOR_SELF
+#define VECTOR_SELF 			VECTOR **
+#endif // VECTOR_SELF
+#ifndef VECTOR_CSELF
+#define VECTOR_CSELF 			const VECTOR **
+#endif // VECTOR_CSELF
+#ifndef VECTOR_DEREF
+#define VECTOR_DEREF(_self) 	(*(_self))
+#endif // VECTOR_DEREF
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+
+/*
+ * Pointers of kernels that never see overlapping buffers, so the
+ * compiler can vectorize without runtime alias checks.
+ */
+#ifndef VECTOR_RESTRICT
+#ifdef _MSC_VER
+#define VECTOR_RESTRICT 		__restrict
+#else // _MSC_VER
+#define VECTOR_RESTRICT 		restrict
+#endif // _MSC_VER
+#endif // VECTOR_RESTRICT
+
+/*
+ * Branch hints for the rare paths of the hot functions, e.g. growing the
+ * buffer in push_back. Plain conditions where __builtin_expect is missing.
+ */
+#ifndef VECTOR_LIKELY
+#if defined(__GNUC__) || defined(__clang__)
+#define VECTOR_LIKELY(_cond) 	__builtin_expect(!!(_cond), 1)
+#define VECTOR_UNLIKELY(_cond) 	__builtin_expect(!!(_cond), 0)
+#else // __GNUC__ || __clang__
+#define VECTOR_LIKELY(_cond) 	(_cond)
+#define VECTOR_UNLIKELY(_cond) 	(_cond)
+#endif // __GNUC__ || __clang__
+#endif // VECTOR_LIKELY
+
+/*
+ * Software prefetch for reading, used by the strided loops of
+ * vector_range.h: VECTOR_PREFETCH_DISTANCE elements (strides) ahead once
+ * a stride spans a cache line, where the hardware prefetcher stops helping.
+ */
+#ifndef VECTOR_PREFETCH
+#if defined(__GNUC__) || defined(__clang__)
+#define VECTOR_PREFETCH(_addr) 	__builtin_prefetch((_addr), 0, 3)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#define VECTOR_PREFETCH(_addr) 	_mm_prefetch((const char *)(_addr), _MM_HINT_T0)
+#else // __GNUC__ || __clang__
+#define VECTOR_PREFETCH(_addr) 	((void)(_addr))
+#endif // __GNUC__ || __clang__
+#endif // VECTOR_PREFETCH
+
+#ifndef VECTOR_PREFETCH_DISTANCE
+#define VECTOR_PREFETCH_DISTANCE 	8
+#endif // VECTOR_PREFETCH_DISTANCE
+
+/*
+ * VECTOR_OPENMP: element-wise numeric kernels are split across threads
+ * when they process at least VECTOR_PARALLEL_THRESHOLD elements.
+ * Without OpenMP (or without -fopenmp) VECTOR_PARALLEL_FOR is empty.
+ */
+#ifndef VECTOR_PARALLEL_THRESHOLD
+#define VECTOR_PARALLEL_THRESHOLD 	65536
+#endif // VECTOR_PARALLEL_THRESHOLD
+
+#ifndef VECTOR_PARALLEL_FOR
+#if defined(VECTOR_OPENMP) && defined(_OPENMP)
+#define VECTOR_PRAGMA(_x) 			_Pragma(#_x)
+#define VECTOR_PARALLEL_FOR(_count) \
+	VECTOR_PRAGMA(omp parallel for if((_count) >= VECTOR_PARALLEL_THRESHOLD))
+#else // VECTOR_OPENMP && _OPENMP
+#define VECTOR_PARALLEL_FOR(_count)
+#endif // VECTOR_OPENMP && _OPENMP
+#endif // VECTOR_PARALLEL_FOR
+
 #ifndef VECTOR_INVALID_INDEX
 #define VECTOR_INVALID_INDEX	((vector_index_t)-1)
 #endif // VECTOR_INVALID_INDEX
@@ -19,10 +19,11 @@
  *
  * @var    	VECTOR_ERROR_SUCCESS		Operation completed successfully
  * @var    	VECTOR_ERROR_ALLOC			Memory allocation failed (VECTOR_NO_DYNAMIC_ALLOC=OFF)
- * @var		VECTOR_ERROR_NO_FREE_VECTOR	VECTOR_MAX_N_VECTORS are used (VECTOR_NO_DYNAMIC_ALLOC=ON)
+ * @var		VECTOR_ERROR_NO_FREE_VECTOR	No free vector slot or arena block (VECTOR_NO_DYNAMIC_ALLOC=ON)
  * @var    	VECTOR_ERROR_INDEX  		Index out of bounds
  * @var    	VECTOR_ERROR_NULL   		NULL pointer encountered
- * @var    	VECTOR_ERROR_CAPACITY  		Capacity operation failed (VECTOR_NO_DYNAMIC_ALLOC=OFF)
+ * @var    	VECTOR_ERROR_CAPACITY  		Capacity operation failed
+ * @var    	VECTOR_ERROR_OVERFLOW  		Result does not fit its type
  */
 typedef enum vector_error
 {
@@ -31,7 +32,8 @@ typedef enum vector_error
 	VECTOR_ERROR_NO_FREE_VECTOR,
     VECTOR_ERROR_INDEX,
     VECTOR_ERROR_NULL,
-    VECTOR_ERROR_CAPACITY
+    VECTOR_ERROR_CAPACITY,
+    VECTOR_ERROR_OVERFLOW
 } vector_error_t;
 
 
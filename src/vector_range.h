@@ -7,14 +7,24 @@
  *
  * @details   This file provides macros for convenient iteration over vectors
  *            using both iterators and indices, with bounds checking support.
+ *
+ *            The VECTOR_FOREACH_ macros go through the function pointers of
+ *            the vector. The VECTOR_EACH_ macros take the type alias instead
+ *            (int_t, ...), fetch the buffer and the size once with
+ *            vector_view_T() and loop over a raw pointer, so they also work
+ *            in LITE builds and compile to the loop over a plain array.
  */
 
 #ifndef __VECTOR_RANGE_H__
 #define __VECTOR_RANGE_H__
 
 
+#include "template.h"
+#include "vector_config.h"
 #include "vector_size.h"
 
+#include <stddef.h>
+
 
 #ifndef VECTOR_RANGE_CHECK
 #define VECTOR_RANGE_CHECK(_range) \
@@ -34,14 +44,12 @@
 
 #ifndef VECTOR_RANGE_INDX_CHECK
 #define VECTOR_RANGE_INDX_CHECK(_range, _indxb, _indxe) \
-    do { \
-        const typeof((_range)->begin(&(_range))) _itb \
-            = (_range)->iterator(&(_range), _indxb); \
-        const typeof((_range)->end(&(_range))) _ite \
-            = (_range)->iterator(&(_range), _indxe); \
-        \
-        VECTOR_RANGE_IT_CHECK(_range, _itb, _ite); \
-    } while (0)
+    for ( \
+        int _ok = ((_indxb) >= 0 && (_indxb) <= (_indxe) \
+            && (_range)->begin(&(_range)) + (_indxe) <= (_range)->end(&(_range))); \
+        _ok != 0; \
+        _ok = 0 \
+    )
 #endif // VECTOR_RANGE_INDX_CHECK
 
 
@@ -90,8 +98,11 @@
 #define VECTOR_FOREACH_INDX(_range, _indxb, _indxe, _it) \
 	VECTOR_RANGE_CHECK(_range) \
 	VECTOR_RANGE_INDX_CHECK(_range, _indxb, _indxe) \
-	_it = _range->iterator(&_range, _indxb) \
-	for (ssize_t _indx = _itb; _indx < _indxe; ++_indx, ++_it)
+	for ( \
+		ssize_t _indx = ((_it) = (_range)->begin(&(_range)) + (_indxb), (_indxb)); \
+		_indx < (ssize_t)(_indxe); \
+		++_indx, ++(_it) \
+	)
 #endif // VECTOR_FOREACH_INDX
 
 /**
@@ -99,17 +110,206 @@
  * @brief Reverse iterate over vector using indices
  *
  * @param _range  	Vector pointer (VECTOR **)
- * @param _rindxb	Begin reverse index
- * @param _rindxe   End reverse index
+ * @param _rindxb	Begin reverse index (first element visited)
+ * @param _rindxe   End reverse index (one before the last visited, may be -1)
  * @param _it     	Iterator variable name
  */
 #ifndef VECTOR_FOREACH_INDX_R
 #define VECTOR_FOREACH_INDX_R(_range, _rindxb, _rindxe, _it) \
 	VECTOR_RANGE_CHECK(_range) \
-	VECTOR_RANGE_INDX_CHECK(_range, _rindxe, _rindxb) \
-	_it = _range->iterator(&_range, _rindxb); \
-	for (ssize_t _indx = _rindxb; _indx < _rindxe; --_indx, --_it)
+	VECTOR_RANGE_INDX_CHECK(_range, (_rindxe) + 1, (_rindxb) + 1) \
+	for ( \
+		ssize_t _indx = ((_it) = (_range)->begin(&(_range)) + (_rindxb), (_rindxb)); \
+		_indx > (ssize_t)(_rindxe); \
+		--_indx, --(_it) \
+	)
 #endif // VECTOR_FOREACH_INDX_R
 
 
+/*
+ * Buffer and size of a vector in one call: _range is what the functions of
+ * the vector take (&vec for dynamic vectors, vec for static ones).
+ */
+#ifndef VECTOR_RANGE_VIEW
+#ifdef VECTOR_NO_DYNAMIC_ALLOC
+#define VECTOR_RANGE_VIEW(_T, _range, _size) \
+	TEMPLATE(vector_view, _T)((const TEMPLATE(vector, _T) *)(_range), &(_size))
+#else // VECTOR_NO_DYNAMIC_ALLOC
+#define VECTOR_RANGE_VIEW(_T, _range, _size) \
+	TEMPLATE(vector_view, _T)((const TEMPLATE(vector, _T) **)(_range), &(_size))
+#endif // VECTOR_NO_DYNAMIC_ALLOC
+#endif // VECTOR_RANGE_VIEW
+
+/* One past the last element, without offsetting the NULL of an empty vector */
+#ifndef VECTOR_RANGE_END
+#define VECTOR_RANGE_END(_data, _size) \
+	((_size) != 0 ? (_data) + (_size) : (_data))
+#endif // VECTOR_RANGE_END
+
+/*
+ * Prefetch VECTOR_PREFETCH_DISTANCE strides ahead of _it when a stride spans
+ * a cache line and that element is among the _left elements from _it on.
+ */
+#ifndef VECTOR_RANGE_PREFETCH
+#define VECTOR_RANGE_PREFETCH(_it, _left, _stride) \
+	((size_t)(_stride) * sizeof(*(_it)) >= VECTOR_CACHE_LINE \
+		&& (size_t)(_left) > (size_t)(_stride) * VECTOR_PREFETCH_DISTANCE \
+		? VECTOR_PREFETCH((_it) + (size_t)(_stride) * VECTOR_PREFETCH_DISTANCE) \
+		: (void)0)
+#endif // VECTOR_RANGE_PREFETCH
+
+/**
+ * @def   VECTOR_EACH
+ * @brief Iterate over all elements with a pointer
+ *
+ * @param _T      	Type alias (int_t, ...)
+ * @param _range  	&vec (dynamic) or vec (static)
+ * @param _it     	Name of the _T * declared for the body
+ *
+ * @note  The vector must not grow or shrink inside the loop.
+ */
+#ifndef VECTOR_EACH
+#define VECTOR_EACH(_T, _range, _it) \
+	for (vector_size_t _vec_n = 0, _vec_once = 1; _vec_once != 0; _vec_once = 0) \
+	for ( \
+		_T *_it = VECTOR_RANGE_VIEW(_T, _range, _vec_n), \
+			*const _vec_end = VECTOR_RANGE_END(_it, _vec_n); \
+		_it != _vec_end; \
+		++_it \
+	)
+#endif // VECTOR_EACH
+
+/**
+ * @def   VECTOR_EACH_INDX
+ * @brief Iterate over all elements with an index and a pointer
+ *
+ * @param _T      	Type alias
+ * @param _range  	&vec (dynamic) or vec (static)
+ * @param _indx   	Name of the vector_size_t index
+ * @param _it     	Name of the _T * to element _indx
+ */
+#ifndef VECTOR_EACH_INDX
+#define VECTOR_EACH_INDX(_T, _range, _indx, _it) \
+	for (vector_size_t _vec_n = 0, _indx = 0, _vec_once = 1; _vec_once != 0; _vec_once = 0) \
+	for ( \
+		_T *_it = VECTOR_RANGE_VIEW(_T, _range, _vec_n); \
+		_indx < _vec_n; \
+		++_indx, ++_it \
+	)
+#endif // VECTOR_EACH_INDX
+
+/**
+ * @def   VECTOR_EACH_BLOCK
+ * @brief Iterate over the elements in blocks of at most _block elements
+ *
+ * @param _T      	Type alias
+ * @param _range  	&vec (dynamic) or vec (static)
+ * @param _block  	Elements per block (the last block may be shorter)
+ * @param _ptr    	Name of the _T * to the first element of the block
+ * @param _count  	Name of the vector_size_t element count of the block
+ *
+ * @note  For kernels that work on a block at a time, e.g. through a stack
+ *        buffer or with SIMD loads.
+ */
+#ifndef VECTOR_EACH_BLOCK
+#define VECTOR_EACH_BLOCK(_T, _range, _block, _ptr, _count) \
+	for (vector_size_t _vec_n = 0, _count = 0, _vec_once = 1; _vec_once != 0; _vec_once = 0) \
+	for ( \
+		_T *_ptr = VECTOR_RANGE_VIEW(_T, _range, _vec_n), \
+			*const _vec_end = VECTOR_RANGE_END(_ptr, _vec_n); \
+		_ptr != _vec_end \
+			&& ((_count) = (vector_size_t)((size_t)(_vec_end - _ptr) < (size_t)(_block) \
+				? (size_t)(_vec_end - _ptr) : (size_t)(_block)), 1); \
+		_ptr += (_count) \
+	)
+#endif // VECTOR_EACH_BLOCK
+
+/**
+ * @def   VECTOR_EACH_UNROLL4
+ * @brief VECTOR_EACH with the body unrolled 4 times
+ *
+ * @param _T      	Type alias
+ * @param _range  	&vec (dynamic) or vec (static)
+ * @param _it     	Name of the _T * declared for the body
+ * @param ...     	Body, a statement or a block
+ *
+ * @note  The body is expanded 5 times and must not use break or continue.
+ */
+#ifndef VECTOR_EACH_UNROLL4
+#define VECTOR_EACH_UNROLL4(_T, _range, _it, ...) \
+	for (vector_size_t _vec_n = 0, _vec_once = 1; _vec_once != 0; _vec_once = 0) \
+	for ( \
+		_T *_it = VECTOR_RANGE_VIEW(_T, _range, _vec_n), \
+			*const _vec_end = VECTOR_RANGE_END(_it, _vec_n), \
+			*const _vec_end4 = VECTOR_RANGE_END(_it, _vec_n & ~(vector_size_t)3); \
+		_vec_once != 0; \
+		_vec_once = 0 \
+	) \
+	{ \
+		while (_it != _vec_end4) \
+		{ \
+			{ __VA_ARGS__ } ++_it; \
+			{ __VA_ARGS__ } ++_it; \
+			{ __VA_ARGS__ } ++_it; \
+			{ __VA_ARGS__ } ++_it; \
+		} \
+		for (; _it != _vec_end; ++_it) \
+		{ __VA_ARGS__ } \
+	}
+#endif // VECTOR_EACH_UNROLL4
+
+/**
+ * @def   VECTOR_EACH_STRIDED
+ * @brief Iterate over every _stride-th element, from the first
+ *
+ * @param _T      	Type alias
+ * @param _range  	&vec (dynamic) or vec (static)
+ * @param _stride 	Distance between the elements visited, at least 1
+ * @param _it     	Name of the _T * declared for the body
+ *
+ * @note  Prefetches VECTOR_PREFETCH_DISTANCE strides ahead once a stride
+ *        is a cache line or more.
+ */
+#ifndef VECTOR_EACH_STRIDED
+#define VECTOR_EACH_STRIDED(_T, _range, _stride, _it) \
+	for (vector_size_t _vec_n = 0, _vec_once = 1; _vec_once != 0; _vec_once = 0) \
+	for ( \
+		_T *_it = VECTOR_RANGE_VIEW(_T, _range, _vec_n), \
+			*const _vec_end = VECTOR_RANGE_END(_it, _vec_n); \
+		_it != _vec_end && (VECTOR_RANGE_PREFETCH(_it, _vec_end - _it, _stride), 1); \
+		_it = (size_t)(_vec_end - _it) > (size_t)(_stride) ? _it + (_stride) : _vec_end \
+	)
+#endif // VECTOR_EACH_STRIDED
+
+/**
+ * @def   VECTOR_EACH_SPAN
+ * @brief Iterate over the elements of a span (vector_span_T), any stride
+ *
+ * @param _T      	Type alias
+ * @param _span   	Span
+ * @param _it     	Name of the const _T * declared for the body
+ *
+ * @note  Prefetches like VECTOR_EACH_STRIDED, e.g. down a matrix column.
+ */
+#ifndef VECTOR_EACH_SPAN
+#define VECTOR_EACH_SPAN(_T, _span, _it) \
+	for ( \
+		vector_size_t _vec_i = 0, _vec_n = (_span).size, _vec_stride = (_span).stride, \
+			_vec_once = 1; \
+		_vec_once != 0; \
+		_vec_once = 0 \
+	) \
+	for ( \
+		const _T *_it = (_span).data; \
+		_vec_i < _vec_n \
+			&& (VECTOR_RANGE_PREFETCH( \
+				_it, \
+				(size_t)(_vec_n - _vec_i - 1) * _vec_stride + 1, \
+				_vec_stride \
+			), 1); \
+		_it = ++_vec_i < _vec_n ? _it + _vec_stride : _it \
+	)
+#endif // VECTOR_EACH_SPAN
+
+
 #endif // __VECTOR_RANGE_H__
@@ -0,0 +1,175 @@
+/**
+ * @file      vector_trace.c
+ * @brief     Binary operation trace for vectors
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @see       vector_trace.h
+ */
+
+#include "vector_trace.h"
+
+#include <stdio.h>
+#include <string.h>
+
+
+#ifndef VECTOR_TRACE_MAX_TYPES
+#define VECTOR_TRACE_MAX_TYPES		64
+#endif // VECTOR_TRACE_MAX_TYPES
+
+#ifndef VECTOR_TRACE_MAX_ALIAS
+#define VECTOR_TRACE_MAX_ALIAS		64
+#endif // VECTOR_TRACE_MAX_ALIAS
+
+
+typedef struct vector_trace_type_entry
+{
+	char alias[VECTOR_TRACE_MAX_ALIAS];
+	uint32_t element_size;
+} vector_trace_type_entry_t;
+
+
+static FILE *__vector_trace_file = NULL;
+static vector_trace_record_t __vector_trace_buffer[VECTOR_TRACE_BUFFER_SIZE];
+static size_t __vector_trace_used = 0;
+static vector_trace_type_entry_t __vector_trace_types[VECTOR_TRACE_MAX_TYPES];
+static uint16_t __vector_trace_n_types = 0;
+static uint32_t __vector_trace_next_id = 0;
+
+
+static void vector_trace_flush(void)
+{
+	if (__vector_trace_file == NULL || __vector_trace_used == 0)
+		return;
+
+	fwrite(
+		__vector_trace_buffer,
+		sizeof(vector_trace_record_t),
+		__vector_trace_used,
+		__vector_trace_file
+	);
+	__vector_trace_used = 0;
+}
+
+static void vector_trace_write_type(uint16_t type_id)
+{
+	const vector_trace_type_entry_t *entry = &__vector_trace_types[type_id];
+	const vector_trace_record_t record =
+	{
+		.vector_id = 0,
+		.type_id = type_id,
+		.op = VECTOR_TRACE_OP_TYPE,
+		.reserved = 0,
+		.index = entry->element_size,
+		.arg = 0,
+		.size = (uint32_t)strlen(entry->alias),
+		.capacity = 0
+	};
+
+	vector_trace_flush();
+	fwrite(&record, sizeof(record), 1, __vector_trace_file);
+	fwrite(entry->alias, 1, record.size, __vector_trace_file);
+}
+
+
+bool vector_trace_open(const char *path)
+{
+	if (__vector_trace_file != NULL)
+		vector_trace_close();
+
+	__vector_trace_file = fopen(path, "wb");
+	if (__vector_trace_file == NULL)
+		return false;
+
+	const vector_trace_header_t header =
+	{
+		.magic = VECTOR_TRACE_MAGIC,
+		.version = VECTOR_TRACE_VERSION,
+		.record_size = sizeof(vector_trace_record_t)
+	};
+	fwrite(&header, sizeof(header), 1, __vector_trace_file);
+
+	for (uint16_t i = 0; i < __vector_trace_n_types; ++i)
+		vector_trace_write_type(i);
+
+	return true;
+}
+
+void vector_trace_close(void)
+{
+	if (__vector_trace_file == NULL)
+		return;
+
+	vector_trace_flush();
+	fclose(__vector_trace_file);
+	__vector_trace_file = NULL;
+}
+
+bool vector_trace_enabled(void)
+{
+	return (__vector_trace_file != NULL);
+}
+
+uint16_t vector_trace_type(const char *alias, size_t element_size)
+{
+	for (uint16_t i = 0; i < __vector_trace_n_types; ++i)
+		if (strcmp(__vector_trace_types[i].alias, alias) == 0)
+			return i;
+
+	if (__vector_trace_n_types == VECTOR_TRACE_MAX_TYPES)
+	{
+		fprintf(
+			stderr,
+			"[vector_trace] more than %d types, %s is not traced (raise VECTOR_TRACE_MAX_TYPES)\n",
+			VECTOR_TRACE_MAX_TYPES,
+			alias
+		);
+
+		return VECTOR_TRACE_TYPE_OVERFLOW;
+	}
+
+	vector_trace_type_entry_t *entry = &__vector_trace_types[__vector_trace_n_types];
+
+	strncpy(entry->alias, alias, VECTOR_TRACE_MAX_ALIAS - 1);
+	entry->alias[VECTOR_TRACE_MAX_ALIAS - 1] = '\0';
+	entry->element_size = (uint32_t)element_size;
+
+	if (__vector_trace_file != NULL)
+		vector_trace_write_type(__vector_trace_n_types);
+
+	return __vector_trace_n_types++;
+}
+
+uint32_t vector_trace_vector_id(void)
+{
+	return ++__vector_trace_next_id;
+}
+
+void vector_trace_record(
+	uint32_t vector_id,
+	uint16_t type_id,
+	vector_trace_op_t op,
+	vector_index_t index,
+	vector_index_t arg,
+	vector_size_t size,
+	vector_size_t capacity
+)
+{
+	if (__vector_trace_file == NULL || type_id == VECTOR_TRACE_TYPE_OVERFLOW)
+		return;
+
+	vector_trace_record_t *record = &__vector_trace_buffer[__vector_trace_used];
+
+	record->vector_id = vector_id;
+	record->type_id = type_id;
+	record->op = (uint8_t)op;
+	record->reserved = 0;
+	record->index = (uint32_t)index;
+	record->arg = (uint32_t)arg;
+	record->size = (uint32_t)size;
+	record->capacity = (uint32_t)capacity;
+
+	if (++__vector_trace_used == VECTOR_TRACE_BUFFER_SIZE)
+		vector_trace_flush();
+}
@@ -0,0 +1,170 @@
+/**
+ * @file      vector_trace.h
+ * @brief     Binary operation trace for vectors
+ * @author    Sasha729
+ * @version   1.0.1
+ * @date      18.10.2026
+ *
+ * @details   When the library is built with VECTOR_TRACE, every vector
+ *            operation of the generated types is appended to a compact
+ *            binary trace once vector_trace_open() has been called.
+ *            The trace is replayed offline by bench/vector_replay.c.
+ *
+ *            File layout (host byte order):
+ *            - vector_trace_header_t
+ *            - a stream of vector_trace_record_t; a record with op
+ *              VECTOR_TRACE_OP_TYPE declares a type id and is followed
+ *              by record.size bytes of the type alias (no terminator)
+ *
+ * @note      Recording is not synchronized, trace one thread at a time.
+ */
+
+#ifndef __VECTOR_TRACE_H__
+#define __VECTOR_TRACE_H__
+
+
+#include "vector_config.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+#ifndef VECTOR_TRACE_MAGIC
+#define VECTOR_TRACE_MAGIC			0x43525456u /* "VTRC" */
+#endif // VECTOR_TRACE_MAGIC
+
+#ifndef VECTOR_TRACE_VERSION
+#define VECTOR_TRACE_VERSION		2u
+#endif // VECTOR_TRACE_VERSION
+
+/* Returned by vector_trace_type() once VECTOR_TRACE_MAX_TYPES are declared */
+#ifndef VECTOR_TRACE_TYPE_OVERFLOW
+#define VECTOR_TRACE_TYPE_OVERFLOW	UINT16_MAX
+#endif // VECTOR_TRACE_TYPE_OVERFLOW
+
+#ifndef VECTOR_TRACE_BUFFER_SIZE
+#define VECTOR_TRACE_BUFFER_SIZE	4096
+#endif // VECTOR_TRACE_BUFFER_SIZE
+
+
+/**
+ * @enum   vector_trace_op
+ * @brief  Traced operations
+ *
+ * @note   The values are part of the file format, append new ones only.
+ */
+typedef enum vector_trace_op
+{
+	VECTOR_TRACE_OP_TYPE = 0,
+	VECTOR_TRACE_OP_CREATE,
+	VECTOR_TRACE_OP_COPY_CREATE,
+	VECTOR_TRACE_OP_MOVE_CREATE,
+	VECTOR_TRACE_OP_DESTROY,
+	VECTOR_TRACE_OP_ASSIGN,
+	VECTOR_TRACE_OP_ASSIGN_RANGE,
+	VECTOR_TRACE_OP_AT,
+	VECTOR_TRACE_OP_CLEAR,
+	VECTOR_TRACE_OP_EMPLACE,
+	VECTOR_TRACE_OP_EMPLACE_RANGE,
+	VECTOR_TRACE_OP_ERASE,
+	VECTOR_TRACE_OP_FIND_FIRST_NOT_OF,
+	VECTOR_TRACE_OP_FIND_LAST_NOT_OF,
+	VECTOR_TRACE_OP_FIND_FIRST_OF,
+	VECTOR_TRACE_OP_FIND_LAST_OF,
+	VECTOR_TRACE_OP_INSERT,
+	VECTOR_TRACE_OP_INSERT_RANGE,
+	VECTOR_TRACE_OP_POP_BACK,
+	VECTOR_TRACE_OP_PUSH_BACK,
+	VECTOR_TRACE_OP_RESERVE,
+	VECTOR_TRACE_OP_RESIZE,
+	VECTOR_TRACE_OP_REVERSE,
+	VECTOR_TRACE_OP_SWAP,
+	VECTOR_TRACE_OP_COUNT
+} vector_trace_op_t;
+
+/**
+ * @struct vector_trace_header
+ * @brief  Trace file header
+ */
+typedef struct vector_trace_header
+{
+	uint32_t magic;
+	uint16_t version;
+	uint16_t record_size;
+} vector_trace_header_t;
+
+/**
+ * @struct vector_trace_record
+ * @brief  One traced operation
+ *
+ * @var    vector_id	Sequential id of the vector instance (0 is never used)
+ * @var    type_id		Id declared by a preceding VECTOR_TRACE_OP_TYPE record
+ * @var    op			vector_trace_op_t
+ * @var    index		Operation index (find result, insert position, ...)
+ * @var    arg			Second operand: range length of EMPLACE_RANGE and
+ * 						INSERT_RANGE, end (exclusive) of REVERSE, second
+ * 						index of SWAP, 0 otherwise
+ * @var    size			Vector size after the operation
+ * @var    capacity		Vector capacity after the operation
+ */
+typedef struct vector_trace_record
+{
+	uint32_t vector_id;
+	uint16_t type_id;
+	uint8_t op;
+	uint8_t reserved;
+	uint32_t index;
+	uint32_t arg;
+	uint32_t size;
+	uint32_t capacity;
+} vector_trace_record_t;
+
+
+/**
+ * @brief  Start recording into @p path (truncated)
+ * @return false if the file cannot be opened
+ */
+bool vector_trace_open(const char *path);
+
+/**
+ * @brief  Flush and stop recording
+ */
+void vector_trace_close(void);
+
+/**
+ * @brief  Whether a trace file is open
+ */
+bool vector_trace_enabled(void);
+
+/**
+ * @brief  Declare a type alias and return its id
+ *
+ * @note   Called once per generated type, the id stays valid after
+ *         vector_trace_close() so it can be cached by the caller.
+ *         Past VECTOR_TRACE_MAX_TYPES types the overflow is reported on
+ *         stderr and VECTOR_TRACE_TYPE_OVERFLOW is returned; records of
+ *         that id are not written.
+ */
+uint16_t vector_trace_type(const char *alias, size_t element_size);
+
+/**
+ * @brief  Allocate an id for a new vector instance
+ */
+uint32_t vector_trace_vector_id(void);
+
+/**
+ * @brief  Append one record (no-op when no trace is open)
+ */
+void vector_trace_record(
+	uint32_t vector_id,
+	uint16_t type_id,
+	vector_trace_op_t op,
+	vector_index_t index,
+	vector_index_t arg,
+	vector_size_t size,
+	vector_size_t capacity
+);
+
+
+#endif // __VECTOR_TRACE_H__